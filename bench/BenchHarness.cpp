@@ -0,0 +1,141 @@
+// bench/BenchHarness.cpp
+#include "BenchHarness.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> g_allocationCount{0};
+
+    void* CountedAlloc(std::size_t size)
+    {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        if (size == 0) size = 1;
+
+        void* ptr = std::malloc(size);
+        if (!ptr) throw std::bad_alloc();
+        return ptr;
+    }
+
+    double Percentile(std::vector<double>& sorted, double fraction)
+    {
+        if (sorted.empty()) return 0.0;
+        size_t index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+}
+
+// Global allocation hooks - every heap allocation in the process goes through here
+void* operator new(std::size_t size) { return CountedAlloc(size); }
+void* operator new[](std::size_t size) { return CountedAlloc(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace Bench
+{
+    uint64_t GetAllocationCount()
+    {
+        return g_allocationCount.load(std::memory_order_relaxed);
+    }
+
+    Runner::Runner(const std::string& filter, double scale, const std::string& workDir)
+        : m_filter(filter)
+        , m_scale(scale > 0.0 ? scale : 1.0)
+        , m_workDir(workDir)
+    {
+    }
+
+    bool Runner::IsEnabled(const std::string& name) const
+    {
+        return m_filter.empty() || name.compare(0, m_filter.size(), m_filter) == 0;
+    }
+
+    bool Runner::IsSuiteEnabled(const std::string& suite) const
+    {
+        // "kanban" enables kanban.*, "kanban.card_move" still needs the kanban setup
+        return m_filter.empty() ||
+               suite.compare(0, m_filter.size(), m_filter) == 0 ||
+               m_filter.compare(0, suite.size(), suite) == 0;
+    }
+
+    size_t Runner::Scaled(size_t n) const
+    {
+        return std::max<size_t>(1, static_cast<size_t>(static_cast<double>(n) * m_scale));
+    }
+
+    std::string Runner::GetWorkPath(const std::string& fileName) const
+    {
+        return (std::filesystem::path(m_workDir) / fileName).string();
+    }
+
+    void Runner::Measure(const std::string& name, size_t iterations, const std::function<void(size_t)>& op)
+    {
+        if (!IsEnabled(name) || iterations == 0) return;
+
+        using Clock = std::chrono::steady_clock;
+
+        // Warm caches (page cache, SQLite statement compilation, allocator pools)
+        size_t warmup = std::min<size_t>(iterations, 8);
+        for (size_t i = 0; i < warmup; ++i)
+        {
+            op(i);
+        }
+
+        std::vector<double> samples;
+        samples.reserve(iterations);
+
+        uint64_t allocsBefore = GetAllocationCount();
+        auto totalStart = Clock::now();
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            auto start = Clock::now();
+            op(i);
+            auto end = Clock::now();
+            samples.push_back(static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+        }
+
+        auto totalEnd = Clock::now();
+        // samples.reserve() above keeps the harness itself out of the count
+        uint64_t allocs = GetAllocationCount() - allocsBefore;
+
+        Result result;
+        result.name = name;
+        result.iterations = iterations;
+        result.nsPerOp = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(totalEnd - totalStart).count()) /
+            static_cast<double>(iterations);
+        result.allocsPerOp = static_cast<double>(allocs) / static_cast<double>(iterations);
+
+        std::sort(samples.begin(), samples.end());
+        result.p50Ns = Percentile(samples, 0.50);
+        result.p99Ns = Percentile(samples, 0.99);
+
+        PrintResult(result);
+        m_results.push_back(result);
+    }
+
+    void Runner::PrintHeader()
+    {
+        std::printf("%-40s %10s %14s %12s %14s %14s\n",
+                    "benchmark", "iters", "ns/op", "allocs/op", "p50(ns)", "p99(ns)");
+        std::fflush(stdout);
+    }
+
+    void Runner::PrintResult(const Result& result)
+    {
+        std::printf("%-40s %10zu %14.0f %12.1f %14.0f %14.0f\n",
+                    result.name.c_str(), result.iterations, result.nsPerOp,
+                    result.allocsPerOp, result.p50Ns, result.p99Ns);
+        std::fflush(stdout);
+    }
+}
@@ -0,0 +1,63 @@
+// bench/BenchHarness.h
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+    struct Result
+    {
+        std::string name;
+        size_t iterations = 0;
+        double nsPerOp = 0.0;
+        double allocsPerOp = 0.0;
+        double p50Ns = 0.0;
+        double p99Ns = 0.0;
+    };
+
+    // Number of global operator new calls since startup (see BenchHarness.cpp)
+    uint64_t GetAllocationCount();
+
+    class Runner
+    {
+    public:
+        Runner(const std::string& filter, double scale, const std::string& workDir);
+
+        // Filtering - names are "<suite>.<case>", the filter is a prefix match
+        bool IsEnabled(const std::string& name) const;
+        bool IsSuiteEnabled(const std::string& suite) const;
+
+        // Dataset sizing - multiplies n by --scale, never returns less than 1
+        size_t Scaled(size_t n) const;
+
+        // Scratch directory for databases and config files, removed on exit
+        const std::string& GetWorkDir() const { return m_workDir; }
+        std::string GetWorkPath(const std::string& fileName) const;
+
+        // Runs op(0..iterations-1) after a short warmup, timing every call on its own
+        // so that percentiles can be reported alongside the mean
+        void Measure(const std::string& name, size_t iterations, const std::function<void(size_t)>& op);
+
+        const std::vector<Result>& GetResults() const { return m_results; }
+
+        static void PrintHeader();
+        static void PrintResult(const Result& result);
+
+    private:
+        std::string m_filter;
+        double m_scale = 1.0;
+        std::string m_workDir;
+        std::vector<Result> m_results;
+    };
+
+    // Suites - one translation unit each
+    void RunKanbanBenchmarks(Runner& runner);
+    void RunClipboardBenchmarks(Runner& runner);
+    void RunPomodoroBenchmarks(Runner& runner);
+    void RunTodoBenchmarks(Runner& runner);
+    void RunConfigBenchmarks(Runner& runner);
+    void RunDatabaseBenchmarks(Runner& runner);
+}
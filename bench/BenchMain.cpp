@@ -0,0 +1,68 @@
+// bench/BenchMain.cpp
+#include "BenchHarness.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+namespace
+{
+    void PrintUsage(const char* program)
+    {
+        std::printf("Usage: %s [--filter <prefix>] [--scale <factor>]\n", program);
+        std::printf("  --filter  Only run benchmarks whose name starts with <prefix> (e.g. kanban)\n");
+        std::printf("  --scale   Multiply dataset sizes by <factor> (default 1.0)\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string filter;
+    double scale = 1.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "--scale" && i + 1 < argc)
+        {
+            scale = std::atof(argv[++i]);
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    // Every run gets a fresh scratch directory so results do not depend on leftovers
+    auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+    std::filesystem::path workDir = std::filesystem::temp_directory_path() /
+                                    ("potensio_bench_" + std::to_string(stamp));
+    std::error_code ec;
+    std::filesystem::create_directories(workDir, ec);
+    if (ec)
+    {
+        std::fprintf(stderr, "Failed to create work directory %s: %s\n",
+                     workDir.string().c_str(), ec.message().c_str());
+        return 1;
+    }
+
+    Bench::Runner runner(filter, scale, workDir.string());
+    Bench::Runner::PrintHeader();
+
+    Bench::RunKanbanBenchmarks(runner);
+    Bench::RunClipboardBenchmarks(runner);
+    Bench::RunPomodoroBenchmarks(runner);
+    Bench::RunTodoBenchmarks(runner);
+    Bench::RunConfigBenchmarks(runner);
+    Bench::RunDatabaseBenchmarks(runner);
+
+    std::filesystem::remove_all(workDir, ec);
+    return 0;
+}
@@ -0,0 +1,83 @@
+// bench/ClipboardBench.cpp
+#include "BenchHarness.h"
+
+#include "core/Clipboard/ClipboardManager.h"
+#include "platform/ClipboardBackend.h"
+
+#include <memory>
+#include <string>
+
+namespace
+{
+    // Scriptable clipboard: the benchmark plays the part of other applications
+    class ScriptedClipboard : public Clipboard::ClipboardBackend
+    {
+    public:
+        bool Initialize(ChangeCallback onChange) override { m_onChange = std::move(onChange); return true; }
+        void Shutdown() override { m_isMonitoring = false; }
+        bool StartMonitoring() override { m_isMonitoring = true; return true; }
+        void StopMonitoring() override { m_isMonitoring = false; }
+
+        bool Read(Clipboard::ClipboardSnapshot& snapshot, bool, bool) override
+        {
+            snapshot.format = Clipboard::ClipboardFormat::Text;
+            snapshot.text = m_text;
+            return true;
+        }
+
+        std::string ReadText() override { return m_text; }
+
+        bool WriteText(const std::string& text) override
+        {
+            m_text = text;
+            if (m_isMonitoring && m_onChange) m_onChange();
+            return true;
+        }
+
+        std::string GetActiveWindowTitle() const override { return "potensio_bench"; }
+        void SendPasteShortcut() override {}
+
+    private:
+        ChangeCallback m_onChange;
+        bool m_isMonitoring = false;
+        std::string m_text;
+    };
+
+    std::string MakeEntry(size_t i)
+    {
+        return "Clipboard entry " + std::to_string(i) +
+               " - lorem ipsum dolor sit amet, consectetur adipiscing elit " +
+               (i % 10 == 0 ? "needle " : "") + std::to_string(i * 7919);
+    }
+}
+
+namespace Bench
+{
+    void RunClipboardBenchmarks(Runner& runner)
+    {
+        if (!runner.IsSuiteEnabled("clipboard")) return;
+
+        auto backend = std::make_unique<ScriptedClipboard>();
+        ScriptedClipboard* clipboard = backend.get();
+
+        ClipboardManager manager(std::move(backend));
+        if (!manager.Initialize(nullptr)) return;
+
+        Clipboard::ClipboardConfig config = manager.GetConfig();
+        config.maxHistorySize = static_cast<int>(runner.Scaled(1000));
+        manager.SetConfig(config);
+
+        // New, unique text arriving from another application
+        runner.Measure("clipboard.add", runner.Scaled(2000), [&](size_t i) {
+            clipboard->WriteText(MakeEntry(i));
+        });
+
+        // Case-insensitive search over a full history
+        runner.Measure("clipboard.search", 200, [&](size_t i) {
+            auto results = manager.GetSearchResults(i % 2 ? "NEEDLE" : "entry 99");
+            (void)results;
+        });
+
+        manager.Shutdown();
+    }
+}
@@ -0,0 +1,28 @@
+// bench/ConfigBench.cpp
+#include "BenchHarness.h"
+
+#include "app/AppConfig.h"
+
+#include <string>
+
+namespace Bench
+{
+    void RunConfigBenchmarks(Runner& runner)
+    {
+        if (!runner.IsSuiteEnabled("config")) return;
+
+        AppConfig config(runner.GetWorkPath("config.txt"));
+
+        // Defaults plus the per-module keys a long-lived install accumulates
+        const size_t extraKeys = runner.Scaled(200);
+        for (size_t i = 0; i < extraKeys; ++i)
+        {
+            config.SetValue("bench.key_" + std::to_string(i), static_cast<int>(i));
+        }
+
+        runner.Measure("config.save", 200, [&](size_t i) {
+            config.SetValue("bench.counter", static_cast<int>(i));
+            config.Save();
+        });
+    }
+}
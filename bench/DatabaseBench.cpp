@@ -0,0 +1,74 @@
+// bench/DatabaseBench.cpp
+#include "BenchHarness.h"
+#include "DatasetGenerator.h"
+
+#include "core/Database/DatabaseManager.h"
+#include "core/Database/KanbanDatabase.h"
+#include "core/Kanban/KanbanManager.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+    namespace
+    {
+        // Insert, update and query throughput of one tuning profile on its own database.
+        // Writes run in autocommit mode, one commit per op, which is what the app does.
+        void RunProfile(Runner& runner, const std::string& profile)
+        {
+            const std::string prefix = "db." + profile;
+            if (!runner.IsSuiteEnabled(prefix)) return;
+
+            DatabaseTuning tuning;
+            DatabaseTuning::FromProfile(profile, tuning);
+
+            auto dbManager = std::make_shared<DatabaseManager>();
+            dbManager->SetTuning(tuning);
+            if (!dbManager->Initialize(runner.GetWorkPath("tuning_" + profile + ".db"))) return;
+
+            KanbanDatabase database(dbManager);
+            if (!database.Initialize()) return;
+
+            Dataset::Config config;
+            config.projects = 1;
+            config.boardsPerProject = 4;
+            config.cards = static_cast<int>(runner.Scaled(4000));
+
+            Dataset::Generator generator(config);
+            if (!generator.GenerateKanban(*dbManager, database)) return;
+
+            size_t inserted = 0;
+            runner.Measure(prefix + ".insert", runner.Scaled(500), [&](size_t) {
+                Kanban::Card card("Inserted card");
+                card.id = "card_ins_" + std::to_string(inserted++);
+                database.CreateCard(card, Dataset::ColumnId(0, 0));
+            });
+
+            auto cards = database.GetCardsByColumn(Dataset::ColumnId(1, 1));
+            if (cards.empty()) return;
+
+            runner.Measure(prefix + ".update", runner.Scaled(500), [&](size_t i) {
+                Kanban::Card& card = *cards[i % cards.size()];
+                card.title = "Updated " + std::to_string(i);
+                database.UpdateCard(card);
+            });
+
+            runner.Measure(prefix + ".query", 50, [&](size_t) {
+                auto all = database.GetAllCards();
+                (void)all;
+            });
+        }
+    }
+
+    void RunDatabaseBenchmarks(Runner& runner)
+    {
+        if (!runner.IsSuiteEnabled("db")) return;
+
+        for (const char* profile : { "durable", "balanced", "fast" })
+        {
+            RunProfile(runner, profile);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+// bench/DatagenMain.cpp
+#include "DatasetGenerator.h"
+
+#include "core/Database/DatabaseManager.h"
+#include "core/Database/KanbanDatabase.h"
+#include "core/Database/PomodoroDatabase.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace
+{
+    void PrintUsage(const char* program)
+    {
+        std::printf("Usage: %s --out <dir> [options]\n", program);
+        std::printf("  --out <dir>               Output directory (potensio.db, clipboard_history.txt)\n");
+        std::printf("  --preset small|medium|large  Base sizes (default small)\n");
+        std::printf("  --seed <n>                Random seed (default 42)\n");
+        std::printf("  --projects <n>            Kanban projects\n");
+        std::printf("  --boards <n>              Boards per project\n");
+        std::printf("  --cards <n>               Total Kanban cards\n");
+        std::printf("  --board-skew <x>          Zipf exponent for cards per board (0 = uniform)\n");
+        std::printf("  --pomodoro-days <n>       Days of pomodoro history\n");
+        std::printf("  --clipboard <n>           Clipboard history entries\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string outDir;
+    Dataset::Config config;
+
+    // The preset is applied first so that explicit sizes always win
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--preset" && !Dataset::Config::FromPreset(argv[i + 1], config))
+        {
+            std::fprintf(stderr, "Unknown preset: %s\n", argv[i + 1]);
+            return 1;
+        }
+    }
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+        if (arg == "--help" || arg == "-h") { PrintUsage(argv[0]); return 0; }
+        if (!value) { PrintUsage(argv[0]); return 1; }
+
+        if (arg == "--out")                outDir = value;
+        else if (arg == "--preset")        {}
+        else if (arg == "--seed")          config.seed = std::strtoull(value, nullptr, 10);
+        else if (arg == "--projects")      config.projects = std::atoi(value);
+        else if (arg == "--boards")        config.boardsPerProject = std::atoi(value);
+        else if (arg == "--cards")         config.cards = std::atoi(value);
+        else if (arg == "--board-skew")    config.boardSkew = std::atof(value);
+        else if (arg == "--pomodoro-days") config.pomodoroDays = std::atoi(value);
+        else if (arg == "--clipboard")     config.clipboardEntries = std::atoi(value);
+        else { PrintUsage(argv[0]); return 1; }
+        ++i;
+    }
+
+    if (outDir.empty())
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::filesystem::path outPath(outDir);
+    std::error_code ec;
+    std::filesystem::create_directories(outPath, ec);
+
+    // Always start from an empty database so the corpus is reproducible
+    std::filesystem::path dbPath = outPath / "potensio.db";
+    for (const char* suffix : { "", "-wal", "-shm" })
+    {
+        std::filesystem::remove(dbPath.string() + suffix, ec);
+    }
+
+    auto dbManager = std::make_shared<DatabaseManager>();
+    if (!dbManager->Initialize(dbPath.string()))
+    {
+        std::fprintf(stderr, "Failed to open %s\n", dbPath.string().c_str());
+        return 1;
+    }
+
+    KanbanDatabase kanbanDb(dbManager);
+    PomodoroDatabase pomodoroDb(dbManager);
+    if (!kanbanDb.Initialize() || !pomodoroDb.Initialize())
+    {
+        std::fprintf(stderr, "Failed to create schema in %s\n", dbPath.string().c_str());
+        return 1;
+    }
+
+    Dataset::Generator generator(config);
+    auto start = std::chrono::steady_clock::now();
+
+    bool ok = generator.GenerateKanban(*dbManager, kanbanDb) &&
+              generator.GeneratePomodoro(*dbManager, pomodoroDb) &&
+              generator.GenerateClipboardHistory((outPath / "clipboard_history.txt").string());
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    const Dataset::Summary& summary = generator.GetSummary();
+    std::printf("seed %llu -> %s (%lld ms)\n",
+                static_cast<unsigned long long>(config.seed), outPath.string().c_str(),
+                static_cast<long long>(elapsed));
+    std::printf("  kanban    %zu projects, %zu boards, %zu columns, %zu cards, %zu card tags\n",
+                summary.projects, summary.boards, summary.columns, summary.cards, summary.cardTags);
+    std::printf("  pomodoro  %zu sessions\n", summary.pomodoroSessions);
+    std::printf("  clipboard %zu entries\n", summary.clipboardEntries);
+
+    return ok ? 0 : 1;
+}
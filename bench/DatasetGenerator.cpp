@@ -0,0 +1,556 @@
+// bench/DatasetGenerator.cpp
+#include "DatasetGenerator.h"
+
+#include "core/Clipboard/ClipboardManager.h"
+#include "core/Database/DatabaseManager.h"
+#include "core/Database/KanbanDatabase.h"
+#include "core/Database/PomodoroDatabase.h"
+#include "core/Kanban/KanbanManager.h"
+#include "core/Todo/TodoManager.h"
+#include "core/IdGenerator.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+    // SplitMix64 - tiny, fast and identical on every standard library, unlike
+    // std::uniform_int_distribution whose output is implementation defined
+    class Rng
+    {
+    public:
+        explicit Rng(uint64_t seed) : m_state(seed) {}
+
+        uint64_t Next()
+        {
+            uint64_t z = (m_state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        // Uniform integer in [0, bound)
+        int Uniform(int bound)
+        {
+            return bound <= 0 ? 0 : static_cast<int>(Next() % static_cast<uint64_t>(bound));
+        }
+
+        // Uniform integer in [low, high]
+        int Range(int low, int high)
+        {
+            return low + Uniform(high - low + 1);
+        }
+
+        bool Chance(double probability)
+        {
+            return static_cast<double>(Next() >> 11) * (1.0 / 9007199254740992.0) < probability;
+        }
+
+        template<size_t N>
+        int Weighted(const int (&weights)[N])
+        {
+            int total = 0;
+            for (int w : weights) total += std::max(w, 0);
+            int pick = Uniform(total);
+            for (size_t i = 0; i < N; ++i)
+            {
+                pick -= std::max(weights[i], 0);
+                if (pick < 0) return static_cast<int>(i);
+            }
+            return 0;
+        }
+
+    private:
+        uint64_t m_state;
+    };
+
+    // Independent streams per module
+    constexpr uint64_t kKanbanStream = 0x4B414E42414E0001ull;
+    constexpr uint64_t kPomodoroStream = 0x504F4D4F444F0002ull;
+    constexpr uint64_t kTodoStream = 0x544F444F00000003ull;
+    constexpr uint64_t kClipboardStream = 0x434C4950424F0004ull;
+
+    const char* const kWords[] = {
+        "review", "design", "update", "release", "migrate", "fix", "refactor", "deploy",
+        "database", "kanban", "board", "card", "timer", "session", "clipboard", "history",
+        "settings", "layout", "sidebar", "export", "import", "report", "meeting", "client",
+        "invoice", "budget", "roadmap", "sprint", "backlog", "bug", "feature", "test",
+        "docs", "api", "cache", "index", "query", "schema", "build", "pipeline",
+        "draft", "proposal", "onboarding", "metrics", "latency", "memory", "render", "font",
+        "theme", "shortcut", "notification", "tray", "window", "drag", "drop", "column",
+        "priority", "deadline", "archive", "search", "filter", "sync", "backup", "restore"
+    };
+    constexpr int kWordCount = static_cast<int>(sizeof(kWords) / sizeof(kWords[0]));
+
+    const char* const kSourceApps[] = {
+        "Visual Studio Code", "Google Chrome", "Microsoft Word", "Slack", "Terminal",
+        "Outlook", "Notepad", "Firefox", "Excel", "Explorer"
+    };
+    constexpr int kSourceAppCount = static_cast<int>(sizeof(kSourceApps) / sizeof(kSourceApps[0]));
+
+    std::string Sentence(Rng& rng, int minWords, int maxWords)
+    {
+        int count = rng.Range(minWords, maxWords);
+        std::string result;
+        result.reserve(static_cast<size_t>(count) * 8);
+
+        for (int i = 0; i < count; ++i)
+        {
+            if (i > 0) result += ' ';
+            result += kWords[rng.Uniform(kWordCount)];
+        }
+
+        if (!result.empty())
+        {
+            result[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(result[0])));
+        }
+        return result;
+    }
+
+    // Multi-paragraph text; kept free of '|' so it survives the clipboard export format
+    std::string Paragraphs(Rng& rng, int words)
+    {
+        std::string result;
+        int written = 0;
+        while (written < words)
+        {
+            int sentenceWords = std::min(words - written, rng.Range(6, 18));
+            if (!result.empty())
+            {
+                result += (rng.Uniform(5) == 0) ? "\n\n" : " ";
+            }
+            result += Sentence(rng, sentenceWords, sentenceWords);
+            result += '.';
+            written += sentenceWords;
+        }
+        return result;
+    }
+
+    std::chrono::system_clock::time_point TimeFromDay(int64_t day, int secondsIntoDay = 0)
+    {
+        return std::chrono::system_clock::time_point(
+            std::chrono::seconds(day * 86400 + secondsIntoDay));
+    }
+
+    std::string EscapeHistoryField(const std::string& input)
+    {
+        // Mirrors ClipboardManager::EscapeDelimited
+        std::string result;
+        result.reserve(input.size());
+        for (char c : input)
+        {
+            switch (c)
+            {
+                case '|':  result += "\\|"; break;
+                case '\n': result += "\\n"; break;
+                case '\r': result += "\\r"; break;
+                default:   result += c; break;
+            }
+        }
+        return result;
+    }
+
+    std::string Preview(const std::string& content)
+    {
+        std::string preview;
+        preview.reserve(std::min<size_t>(content.size(), 100));
+        bool lastSpace = false;
+        for (char c : content)
+        {
+            bool space = (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+            if (space && (lastSpace || preview.empty())) continue;
+            preview += space ? ' ' : c;
+            lastSpace = space;
+            if (preview.size() > 100) break;
+        }
+        if (preview.size() > 100)
+        {
+            preview = preview.substr(0, 97) + "...";
+        }
+        return preview;
+    }
+}
+
+namespace Dataset
+{
+    // Howard Hinnant's days_from_civil / civil_from_days
+    int64_t DaysFromCivil(int year, int month, int day)
+    {
+        year -= month <= 2;
+        const int64_t era = (year >= 0 ? year : year - 399) / 400;
+        const unsigned yoe = static_cast<unsigned>(year - era * 400);
+        const unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + static_cast<int64_t>(doe) - 719468;
+    }
+
+    std::string FormatDay(int64_t daysSinceEpoch)
+    {
+        int64_t z = daysSinceEpoch + 719468;
+        const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+        const unsigned doe = static_cast<unsigned>(z - era * 146097);
+        const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const int64_t y = static_cast<int64_t>(yoe) + era * 400;
+        const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const unsigned mp = (5 * doy + 2) / 153;
+        const unsigned d = doy - (153 * mp + 2) / 5 + 1;
+        const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", static_cast<int>(y + (m <= 2)), m, d);
+        return buffer;
+    }
+
+    bool ParseDay(const std::string& date, int64_t& daysSinceEpoch)
+    {
+        int year = 0, month = 0, day = 0;
+        if (std::sscanf(date.c_str(), "%d-%d-%d", &year, &month, &day) != 3) return false;
+        if (month < 1 || month > 12 || day < 1 || day > 31) return false;
+
+        daysSinceEpoch = DaysFromCivil(year, month, day);
+        return true;
+    }
+
+    std::string ProjectId(size_t project) { return IdGenerator::ToString((1ull << 40) | project); }
+    std::string BoardId(size_t board) { return IdGenerator::ToString((2ull << 40) | board); }
+    std::string ColumnId(size_t board, size_t column) { return IdGenerator::ToString((3ull << 40) | board << 8 | column); }
+    std::string CardId(size_t card) { return IdGenerator::ToString((4ull << 40) | card); }
+
+    Config Config::Small()
+    {
+        return Config();
+    }
+
+    Config Config::Medium()
+    {
+        Config config;
+        config.projects = 5;
+        config.boardsPerProject = 10;
+        config.cards = 10000;
+        config.boardSkew = 0.8;
+        config.tagPool = 50;
+        config.pomodoroDays = 365;
+        config.todoDays = 365;
+        config.tasksPerDay = 5;
+        config.clipboardEntries = 50000;
+        return config;
+    }
+
+    Config Config::Large()
+    {
+        Config config;
+        config.projects = 10;
+        config.boardsPerProject = 20;
+        config.cards = 50000;
+        config.boardSkew = 1.0;
+        config.tagPool = 100;
+        config.maxTagsPerCard = 4;
+        config.pomodoroDays = 3650;
+        config.todoDays = 3650;
+        config.tasksPerDay = 5;
+        config.clipboardEntries = 1000000;
+        return config;
+    }
+
+    bool Config::FromPreset(const std::string& name, Config& config)
+    {
+        if (name == "small")  { config = Small();  return true; }
+        if (name == "medium") { config = Medium(); return true; }
+        if (name == "large")  { config = Large();  return true; }
+        return false;
+    }
+
+    Generator::Generator(const Config& config)
+        : m_config(config)
+    {
+        if (!ParseDay(m_config.startDate, m_startDay))
+        {
+            m_startDay = DaysFromCivil(2024, 1, 1);
+        }
+    }
+
+    std::string Generator::GetDate(int dayOffset) const
+    {
+        return FormatDay(m_startDay + dayOffset);
+    }
+
+    std::vector<int> Generator::DistributeCards() const
+    {
+        const int boardCount = std::max(1, m_config.projects * m_config.boardsPerProject);
+
+        // Zipf-like weights: board k gets 1 / (k + 1)^skew of the cards
+        std::vector<double> weights(static_cast<size_t>(boardCount));
+        double totalWeight = 0.0;
+        for (int b = 0; b < boardCount; ++b)
+        {
+            weights[static_cast<size_t>(b)] = 1.0 / std::pow(static_cast<double>(b + 1), m_config.boardSkew);
+            totalWeight += weights[static_cast<size_t>(b)];
+        }
+
+        std::vector<int> counts(static_cast<size_t>(boardCount), 0);
+        int assigned = 0;
+        for (int b = 0; b < boardCount; ++b)
+        {
+            counts[static_cast<size_t>(b)] = static_cast<int>(
+                std::floor(m_config.cards * weights[static_cast<size_t>(b)] / totalWeight));
+            assigned += counts[static_cast<size_t>(b)];
+        }
+
+        // Hand out the rounding remainder from the front so the total is exact
+        for (int b = 0; assigned < m_config.cards; b = (b + 1) % boardCount, ++assigned)
+        {
+            ++counts[static_cast<size_t>(b)];
+        }
+        return counts;
+    }
+
+    bool Generator::GenerateKanban(DatabaseManager& dbManager, KanbanDatabase& database)
+    {
+        static const char* const kColumnNames[] = { "To Do", "In Progress", "Review", "Done" };
+
+        Rng rng(m_config.seed ^ kKanbanStream);
+        const std::vector<int> cardsPerBoard = DistributeCards();
+        const int columnsPerBoard = std::max(1, m_config.columnsPerBoard);
+
+        std::vector<std::string> tags;
+        for (int t = 0; t < m_config.tagPool; ++t)
+        {
+            char name[32];
+            std::snprintf(name, sizeof(name), "tag-%03d", t);
+            tags.emplace_back(name);
+        }
+
+        if (!dbManager.BeginTransaction()) return false;
+
+        bool ok = true;
+        for (const auto& tag : tags)
+        {
+            ok = ok && database.CreateTag(tag);
+        }
+
+        size_t boardIndex = 0;
+        size_t cardIndex = 0;
+        for (int p = 0; ok && p < m_config.projects; ++p)
+        {
+            Kanban::Project project("Project " + std::to_string(p + 1));
+            project.id = ProjectId(p);
+            project.description = Sentence(rng, 5, 12);
+            project.createdAt = TimeFromDay(m_startDay, p * 60);
+            project.modifiedAt = project.createdAt;
+            ok = database.CreateProject(project);
+            ++m_summary.projects;
+
+            for (int b = 0; ok && b < m_config.boardsPerProject; ++b, ++boardIndex)
+            {
+                Kanban::Board board("Board " + std::to_string(boardIndex + 1));
+                board.id = BoardId(boardIndex);
+                board.description = Sentence(rng, 4, 10);
+                board.createdAt = TimeFromDay(m_startDay, static_cast<int>(boardIndex) * 60);
+                board.modifiedAt = board.createdAt;
+                ok = database.CreateBoard(board, project.id);
+                ++m_summary.boards;
+
+                std::vector<std::string> columnIds;
+                for (int c = 0; ok && c < columnsPerBoard; ++c)
+                {
+                    Kanban::Column column(c < 4 ? kColumnNames[c] : "Stage " + std::to_string(c + 1));
+                    column.id = ColumnId(boardIndex, c);
+                    ok = database.CreateColumn(column, board.id);
+                    columnIds.push_back(column.id);
+                    ++m_summary.columns;
+                }
+
+                for (int i = 0; ok && i < cardsPerBoard[boardIndex]; ++i, ++cardIndex)
+                {
+                    const int columnIdx = rng.Uniform(columnsPerBoard);
+
+                    Kanban::Card card(Sentence(rng, 2, 7));
+                    card.id = CardId(cardIndex);
+                    card.description = rng.Chance(m_config.longDescriptionRatio)
+                        ? Paragraphs(rng, m_config.longDescriptionWords)
+                        : Sentence(rng, 0, 20);
+                    card.priority = static_cast<Kanban::Priority>(rng.Weighted(m_config.priorityWeights));
+                    card.status = (columnIdx == columnsPerBoard - 1) ? Kanban::CardStatus::Completed
+                                                                      : Kanban::CardStatus::Active;
+                    card.assignee = rng.Chance(0.7) ? "user" + std::to_string(rng.Uniform(12)) : "";
+                    if (rng.Chance(m_config.dueDateRatio))
+                    {
+                        card.dueDate = FormatDay(m_startDay + rng.Range(-30, 180));
+                    }
+                    card.createdAt = TimeFromDay(m_startDay + rng.Uniform(365), rng.Uniform(86400));
+                    card.modifiedAt = card.createdAt;
+
+                    ok = database.CreateCard(card, columnIds[static_cast<size_t>(columnIdx)]);
+                    ++m_summary.cards;
+
+                    // Distinct tags drawn from the pool
+                    int tagCount = tags.empty() ? 0 : rng.Uniform(std::max(0, m_config.maxTagsPerCard) + 1);
+                    std::vector<int> picked;
+                    for (int t = 0; ok && t < tagCount; ++t)
+                    {
+                        int tag = rng.Uniform(static_cast<int>(tags.size()));
+                        if (std::find(picked.begin(), picked.end(), tag) != picked.end()) continue;
+                        picked.push_back(tag);
+                        ok = database.AddTagToCard(card.id, tags[static_cast<size_t>(tag)]);
+                        ++m_summary.cardTags;
+                    }
+                }
+            }
+        }
+
+        if (!ok)
+        {
+            Logger::Error("Dataset: Kanban generation failed: {}", database.GetLastError());
+            dbManager.RollbackTransaction();
+            return false;
+        }
+
+        return dbManager.CommitTransaction();
+    }
+
+    bool Generator::GeneratePomodoro(DatabaseManager& dbManager, PomodoroDatabase& database)
+    {
+        Rng rng(m_config.seed ^ kPomodoroStream);
+
+        if (!dbManager.BeginTransaction()) return false;
+
+        bool ok = true;
+        for (int d = 0; ok && d < m_config.pomodoroDays; ++d)
+        {
+            const std::string date = GetDate(d);
+
+            // Some days are skipped entirely, the rest vary around sessionsPerDay
+            if (rng.Chance(0.15)) continue;
+            int sessions = std::max(1, m_config.sessionsPerDay + rng.Range(-3, 3));
+
+            int workCount = 0;
+            for (int s = 1; ok && s <= sessions; ++s)
+            {
+                const bool isWork = (s % 2) == 1;
+                const char* type = "work";
+                if (isWork)
+                {
+                    ++workCount;
+                }
+                else
+                {
+                    type = (workCount % 4 == 0) ? "long_break" : "short_break";
+                }
+
+                int sessionId = database.StartSession(type, s, date);
+                ok = sessionId > 0 &&
+                     database.EndSession(sessionId, rng.Chance(0.85), rng.Chance(0.3) ? rng.Range(5, 300) : 0);
+                ++m_summary.pomodoroSessions;
+            }
+        }
+
+        if (!ok)
+        {
+            Logger::Error("Dataset: Pomodoro generation failed: {}", dbManager.GetLastError());
+            dbManager.RollbackTransaction();
+            return false;
+        }
+
+        return dbManager.CommitTransaction();
+    }
+
+    void Generator::GenerateTodo(TodoManager& manager)
+    {
+        static const char* const kCategories[] = { "Work", "Personal", "Errands", "Health", "Learning" };
+
+        Rng rng(m_config.seed ^ kTodoStream);
+
+        for (int d = 0; d < m_config.todoDays; ++d)
+        {
+            const std::string date = GetDate(d);
+            int count = rng.Range(0, std::max(0, m_config.tasksPerDay * 2));
+
+            for (int i = 0; i < count; ++i)
+            {
+                auto task = manager.CreateTask(Sentence(rng, 2, 6), date);
+                if (!task) continue;
+
+                task->description = rng.Chance(0.3) ? Sentence(rng, 5, 30) : "";
+                task->priority = static_cast<Todo::Priority>(rng.Weighted(m_config.priorityWeights));
+                task->category = kCategories[rng.Uniform(5)];
+                task->isAllDay = rng.Chance(0.5);
+                if (!task->isAllDay)
+                {
+                    char time[8];
+                    std::snprintf(time, sizeof(time), "%02d:%02d", rng.Range(7, 20), rng.Uniform(4) * 15);
+                    task->dueTime = time;
+                }
+                if (rng.Chance(0.6))
+                {
+                    task->status = Todo::Status::Completed;
+                    task->completedAt = TimeFromDay(m_startDay + d, rng.Uniform(86400));
+                }
+                else if (rng.Chance(0.1))
+                {
+                    task->status = Todo::Status::InProgress;
+                }
+                for (int t = rng.Uniform(3); t > 0; --t)
+                {
+                    task->tags.emplace_back(kWords[rng.Uniform(kWordCount)]);
+                }
+                task->createdAt = TimeFromDay(m_startDay + d, rng.Uniform(86400));
+                ++m_summary.todoTasks;
+            }
+        }
+    }
+
+    bool Generator::GenerateClipboardHistory(const std::string& filePath)
+    {
+        Rng rng(m_config.seed ^ kClipboardStream);
+
+        std::ofstream file(filePath, std::ios::binary);
+        if (!file.is_open())
+        {
+            Logger::Error("Dataset: Failed to open clipboard history file: {}", filePath);
+            return false;
+        }
+
+        file << "# Potensio Clipboard History Export\n";
+        file << "# Version: 1.0\n";
+        file << "# Exported at: " << (m_startDay * 86400) << "\n";
+        file << "# Format: ID|Title|Preview|Content|Format|Timestamp|Size|Favorite|Pinned|Source\n";
+        file << "#\n";
+
+        // Roughly one copy every 90 seconds, newest first like ExportHistory
+        const int64_t newest = m_startDay * 86400 + static_cast<int64_t>(m_config.clipboardEntries) * 90;
+
+        std::string line;
+        for (int i = 0; i < m_config.clipboardEntries; ++i)
+        {
+            std::string content = rng.Chance(m_config.longClipboardRatio)
+                ? Paragraphs(rng, rng.Range(200, 1500))
+                : Sentence(rng, 1, 25);
+
+            std::string preview = Preview(content);
+            std::string title = preview.length() > 50 ? preview.substr(0, 47) + "..." : preview;
+
+            line.clear();
+            line += "clip_gen_" + std::to_string(i);
+            line += '|'; line += EscapeHistoryField(title);
+            line += '|'; line += EscapeHistoryField(preview);
+            line += '|'; line += EscapeHistoryField(content);
+            line += '|'; line += std::to_string(static_cast<int>(Clipboard::ClipboardFormat::Text));
+            line += '|'; line += std::to_string(newest - static_cast<int64_t>(i) * 90 - rng.Uniform(60));
+            line += '|'; line += std::to_string(content.size());
+            line += '|'; line += rng.Chance(0.01) ? '1' : '0';
+            line += '|'; line += rng.Chance(0.005) ? '1' : '0';
+            line += '|'; line += kSourceApps[rng.Uniform(kSourceAppCount)];
+            line += '\n';
+
+            file << line;
+            ++m_summary.clipboardEntries;
+        }
+
+        return static_cast<bool>(file);
+    }
+}
@@ -0,0 +1,106 @@
+// bench/DatasetGenerator.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class DatabaseManager;
+class KanbanDatabase;
+class PomodoroDatabase;
+class TodoManager;
+
+namespace Dataset
+{
+    // Sizes and distributions of a synthetic corpus. Every section draws from its own
+    // random stream derived from `seed`, so resizing one module never changes another.
+    struct Config
+    {
+        uint64_t seed = 42;
+        std::string startDate = "2024-01-01"; // First day of generated history
+
+        // Kanban
+        int projects = 1;
+        int boardsPerProject = 4;
+        int columnsPerBoard = 4;
+        int cards = 1000;                       // Total across all boards
+        double boardSkew = 0.0;                 // Zipf exponent for cards per board, 0 = uniform
+        int priorityWeights[4] = { 3, 4, 2, 1 }; // Low, Medium, High, Urgent
+        int tagPool = 20;
+        int maxTagsPerCard = 3;
+        double dueDateRatio = 0.4;              // Fraction of cards with a due date
+        double longDescriptionRatio = 0.1;      // Fraction of cards with a long description
+        int longDescriptionWords = 600;
+
+        // Pomodoro
+        int pomodoroDays = 30;
+        int sessionsPerDay = 8;
+
+        // Todo
+        int todoDays = 30;
+        int tasksPerDay = 4;
+
+        // Clipboard
+        int clipboardEntries = 1000;
+        double longClipboardRatio = 0.05;       // Fraction of multi-line, multi-KB entries
+
+        // Presets
+        static Config Small();
+        static Config Medium();
+        static Config Large();  // 50k cards / 200 boards, 10 years of sessions, 1M clipboard entries
+        static bool FromPreset(const std::string& name, Config& config);
+    };
+
+    struct Summary
+    {
+        size_t projects = 0;
+        size_t boards = 0;
+        size_t columns = 0;
+        size_t cards = 0;
+        size_t cardTags = 0;
+        size_t pomodoroSessions = 0;
+        size_t todoTasks = 0;
+        size_t clipboardEntries = 0;
+    };
+
+    class Generator
+    {
+    public:
+        explicit Generator(const Config& config);
+
+        // Fill potensio.db tables - each section runs inside a single transaction
+        bool GenerateKanban(DatabaseManager& dbManager, KanbanDatabase& database);
+        bool GeneratePomodoro(DatabaseManager& dbManager, PomodoroDatabase& database);
+
+        // Tasks go straight into the manager; without a TodoDatabase it keeps them in memory
+        void GenerateTodo(TodoManager& manager);
+
+        // Writes a file in ClipboardManager::ExportHistory format (newest first)
+        bool GenerateClipboardHistory(const std::string& filePath);
+
+        const Summary& GetSummary() const { return m_summary; }
+        const Config& GetConfig() const { return m_config; }
+
+        // Dates of the generated history, YYYY-MM-DD
+        std::string GetDate(int dayOffset) const;
+
+    private:
+        Config m_config;
+        Summary m_summary;
+        int64_t m_startDay = 0; // Days since 1970-01-01
+
+        std::vector<int> DistributeCards() const;
+    };
+
+    // Civil date helpers shared with the benchmarks
+    int64_t DaysFromCivil(int year, int month, int day);
+    std::string FormatDay(int64_t daysSinceEpoch);
+    bool ParseDay(const std::string& date, int64_t& daysSinceEpoch);
+
+    // Ids of the generated Kanban rows - fixed, so benchmarks can name them, and well
+    // below anything IdGenerator hands out
+    std::string ProjectId(size_t project);
+    std::string BoardId(size_t board);
+    std::string ColumnId(size_t board, size_t column);
+    std::string CardId(size_t card);
+}
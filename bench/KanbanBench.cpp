@@ -0,0 +1,810 @@
+// bench/KanbanBench.cpp
+#include "BenchHarness.h"
+#include "DatasetGenerator.h"
+
+#include "core/Database/DatabaseManager.h"
+#include "core/Database/KanbanDatabase.h"
+#include "core/Database/PersistenceWorker.h"
+#include "core/Kanban/KanbanManager.h"
+#include "core/Kanban/KanbanTransfer.h"
+#include "core/Utils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+    namespace
+    {
+        size_t CountCards(const std::vector<std::unique_ptr<Kanban::Project>>& projects, size_t& tags)
+        {
+            size_t cards = 0;
+            tags = 0;
+            for (const auto& project : projects)
+                for (const auto& board : project->boards)
+                    for (const auto& column : board->columns)
+                        for (const auto& card : column->cards)
+                        {
+                            ++cards;
+                            tags += card->tags.size();
+                        }
+            return cards;
+        }
+
+        // Whole-tree load, per-row queries (GetAllProjects) against one scan per table
+        // (GetAllProjectsBulk). Fixed sizes so runs stay comparable across machines.
+        void RunHydrationBenchmarks(Runner& runner, int cards, const std::string& label)
+        {
+            const std::string n1Name = "kanban.hydrate_n1_" + label;
+            const std::string bulkName = "kanban.hydrate_bulk_" + label;
+            const std::string lazyName = "kanban.startup_lazy_" + label;
+            if (!runner.IsEnabled(n1Name) && !runner.IsEnabled(bulkName) && !runner.IsEnabled(lazyName)) return;
+
+            auto dbManager = std::make_shared<DatabaseManager>();
+            if (!dbManager->Initialize(runner.GetWorkPath("kanban_hydrate_" + label + ".db"))) return;
+
+            KanbanDatabase database(dbManager);
+            if (!database.Initialize()) return;
+
+            Dataset::Config config;
+            config.projects = 4;
+            config.boardsPerProject = 10;
+            config.cards = cards;
+
+            Dataset::Generator generator(config);
+            if (!generator.GenerateKanban(*dbManager, database)) return;
+
+            const size_t iterations = cards >= 100000 ? 3 : 10;
+
+            runner.Measure(n1Name, iterations, [&](size_t) {
+                auto projects = database.GetAllProjects();
+            });
+
+            runner.Measure(bulkName, iterations, [&](size_t) {
+                auto projects = database.GetAllProjectsBulk();
+            });
+
+            // Startup in lazy mode: headers for every project, contents of one board
+            size_t loadedBytes = 0;
+            runner.Measure(lazyName, iterations, [&](size_t) {
+                KanbanManager manager(database);
+                manager.SetLazyLoading(true);
+                manager.loadProjectsFromDB(&database);
+                manager.SetCurrentProject(manager.GetProjects().front()->id);
+                manager.GetCurrentBoard();
+                loadedBytes = manager.GetLoadedBoardBytes();
+            });
+            if (runner.IsEnabled(lazyName))
+            {
+                std::printf("  (lazy startup keeps ~%zu KiB of board contents)\n", loadedBytes / 1024);
+            }
+
+            // Both paths have to build the same tree
+            size_t n1Tags = 0;
+            size_t bulkTags = 0;
+            size_t n1Cards = CountCards(database.GetAllProjects(), n1Tags);
+            size_t bulkCards = CountCards(database.GetAllProjectsBulk(), bulkTags);
+            std::printf("  (%zu/%zu cards, %zu/%zu tags%s)\n", n1Cards, bulkCards, n1Tags, bulkTags,
+                        n1Cards == bulkCards && n1Tags == bulkTags ? "" : " - MISMATCH");
+        }
+
+        // In-memory card lookups and drags on one board, no database: the per-frame work of
+        // the drag and drop and card editor paths. Should stay flat from 1k to 10k cards.
+        void RunCardIndexBenchmarks(Runner& runner, size_t cards, const std::string& label)
+        {
+            const std::string findName = "kanban.card_find_" + label;
+            const std::string dragName = "kanban.card_drag_" + label;
+            if (!runner.IsEnabled(findName) && !runner.IsEnabled(dragName)) return;
+
+            Kanban::Board board("Bench");
+            board.CreateDefaultColumns();
+
+            std::vector<std::string> cardIds;
+            cardIds.reserve(cards);
+            for (size_t i = 0; i < cards; ++i)
+            {
+                auto card = std::make_shared<Kanban::Card>("Card " + std::to_string(i));
+                card->id = Dataset::CardId(i);
+                cardIds.push_back(card->id);
+                board.columns[i % board.columns.size()]->cards.push_back(std::move(card));
+            }
+
+            // 100 lookups per op, spread over the whole board
+            size_t found = 0;
+            runner.Measure(findName, 2000, [&](size_t i) {
+                for (size_t k = 0; k < 100; ++k)
+                {
+                    found += board.FindCard(cardIds[(i * 100 + k) * 7919 % cards]) != nullptr;
+                }
+            });
+
+            runner.Measure(dragName, 2000, [&](size_t i) {
+                const auto& target = board.columns[i % board.columns.size()];
+                const int targetIndex = static_cast<int>((i * 31) % (target->cards.size() + 1));
+                board.MoveCard(cardIds[i * 7919 % cards], target->id, targetIndex);
+            });
+
+            size_t total = 0;
+            for (const auto& column : board.columns)
+            {
+                total += column->cards.size();
+            }
+            std::printf("  (%zu cards on the board, %zu found)\n", total, found);
+        }
+
+        // What one frame of the statistics header reads, and the cost of keeping it current
+        // when a card is edited
+        void RunStatisticsBenchmarks(Runner& runner, size_t cards, const std::string& label)
+        {
+            const std::string readName = "kanban.stats_read_" + label;
+            const std::string updateName = "kanban.stats_update_" + label;
+            if (!runner.IsEnabled(readName) && !runner.IsEnabled(updateName)) return;
+
+            Kanban::Board board("Bench");
+            board.CreateDefaultColumns();
+
+            const int64_t today = Utils::GetTodayDayNumber();
+            std::vector<std::string> cardIds;
+            cardIds.reserve(cards);
+            for (size_t i = 0; i < cards; ++i)
+            {
+                auto card = std::make_shared<Kanban::Card>("Card " + std::to_string(i));
+                card->id = Dataset::CardId(i);
+                card->priority = static_cast<Kanban::Priority>(i % 4);
+                card->status = i % 5 == 0 ? Kanban::CardStatus::Completed : Kanban::CardStatus::Active;
+                if (i % 2 == 0)
+                {
+                    card->dueDate = Utils::FormatDayNumber(today + static_cast<int64_t>(i % 61) - 30);
+                }
+                cardIds.push_back(card->id);
+                board.columns[i % board.columns.size()]->cards.push_back(std::move(card));
+            }
+            board.InvalidateCardIndex();
+
+            int checksum = 0;
+            runner.Measure(readName, 20000, [&](size_t) {
+                checksum += board.GetTotalCardCount() + board.GetCompletedCardCount() + board.GetOverdueCardCount();
+                for (const auto& column : board.columns)
+                {
+                    checksum += column->GetActiveCardCount() + column->GetUrgentCardCount();
+                }
+            });
+
+            runner.Measure(updateName, 20000, [&](size_t i) {
+                auto card = board.FindCard(cardIds[i * 7919 % cards]);
+                card->priority = static_cast<Kanban::Priority>((static_cast<int>(card->priority) + 1) % 4);
+                card->dueDate = Utils::FormatDayNumber(today + static_cast<int64_t>(i % 61) - 30);
+                board.RefreshCardCounts(card->id);
+            });
+
+            std::printf("  (%d overdue of %d cards, checksum %d)\n", board.GetOverdueCardCount(),
+                        board.GetTotalCardCount(), checksum);
+        }
+
+        // A compound board filter (two priorities, active, one tag, due window) from the bitset
+        // index: applying it, reading it in a frame, an edit while it is on, and the per-card
+        // scan a frame would otherwise do
+        void RunFilterBenchmarks(Runner& runner, size_t cards, const std::string& label)
+        {
+            const std::string applyName = "kanban.filter_apply_" + label;
+            const std::string frameName = "kanban.filter_frame_" + label;
+            const std::string editName = "kanban.filter_edit_" + label;
+            const std::string scanName = "kanban.filter_scan_" + label;
+            if (!runner.IsEnabled(applyName) && !runner.IsEnabled(frameName) && !runner.IsEnabled(editName) &&
+                !runner.IsEnabled(scanName)) return;
+
+            Kanban::Board board("Bench");
+            board.CreateDefaultColumns();
+
+            const int64_t today = Utils::GetTodayDayNumber();
+            const char* tags[] = { "backend", "frontend", "design", "bug", "infra", "docs", "qa", "ops" };
+            const char* assignees[] = { "", "ana", "ben", "chen", "dara" };
+            std::vector<std::string> cardIds;
+            cardIds.reserve(cards);
+            for (size_t i = 0; i < cards; ++i)
+            {
+                auto card = std::make_shared<Kanban::Card>("Card " + std::to_string(i));
+                card->id = Dataset::CardId(i);
+                card->priority = static_cast<Kanban::Priority>(i % 4);
+                card->status = i % 5 == 0 ? Kanban::CardStatus::Completed : Kanban::CardStatus::Active;
+                card->assignee = assignees[i % 5];
+                card->tags = { tags[i % 8], tags[(i / 8) % 8] };
+                if (i % 2 == 0)
+                {
+                    card->dueDate = Utils::FormatDayNumber(today + static_cast<int64_t>(i % 61) - 30);
+                }
+                cardIds.push_back(card->id);
+                board.columns[i % board.columns.size()]->cards.push_back(std::move(card));
+            }
+            board.InvalidateCardIndex();
+
+            Kanban::CardFilter filters[2];
+            filters[0].priorities = (1u << static_cast<int>(Kanban::Priority::High)) |
+                                    (1u << static_cast<int>(Kanban::Priority::Urgent));
+            filters[0].statuses = 1u << static_cast<int>(Kanban::CardStatus::Active);
+            filters[0].tags = { "bug" };
+            filters[0].dueFrom = today - 7;
+            filters[0].dueTo = today + 14;
+            filters[1] = filters[0];
+            filters[1].assignee = "ben";
+
+            size_t visible = 0;
+            runner.Measure(applyName, 2000, [&](size_t i) {
+                board.SetFilter(filters[i % 2]);
+                visible = board.GetVisibleCardCount();
+            });
+
+            board.SetFilter(filters[0]);
+            size_t checksum = 0;
+            runner.Measure(frameName, 20000, [&](size_t) {
+                for (const auto& column : board.columns)
+                {
+                    checksum += board.GetVisibleCards(*column).size();
+                }
+            });
+
+            runner.Measure(editName, 2000, [&](size_t i) {
+                auto card = board.FindCard(cardIds[i * 7919 % cards]);
+                card->priority = static_cast<Kanban::Priority>((static_cast<int>(card->priority) + 1) % 4);
+                board.RefreshCardCounts(card->id);
+                checksum += board.GetVisibleCardCount();
+            });
+
+            const Kanban::CardFilter& filter = filters[0];
+            size_t scanned = 0;
+            runner.Measure(scanName, 200, [&](size_t) {
+                scanned = 0;
+                for (const auto& column : board.columns)
+                    for (const auto& card : column->cards)
+                    {
+                        int64_t dueDay = 0;
+                        scanned += (filter.priorities & (1u << static_cast<int>(card->priority))) &&
+                                   (filter.statuses & (1u << static_cast<int>(card->status))) &&
+                                   std::find(card->tags.begin(), card->tags.end(), filter.tags[0]) != card->tags.end() &&
+                                   card->GetDueDay(dueDay) && dueDay >= *filter.dueFrom && dueDay <= *filter.dueTo;
+                    }
+            });
+
+            std::printf("  (%zu of %zu cards match, scan finds %zu; checksum %zu)\n", board.GetVisibleCardCount(),
+                        cards, scanned, checksum);
+        }
+
+        // Full-text search against the in-memory scan the UI would otherwise do. The
+        // synthetic text uses 64 words, so every word is in about a quarter of the cards -
+        // close to the worst case for ranking.
+        void RunSearchBenchmarks(Runner& runner)
+        {
+            const std::string wordName = "kanban.search_word_100k";
+            const std::string prefixName = "kanban.search_prefix_100k";
+            const std::string phraseName = "kanban.search_phrase_100k";
+            const std::string boardName = "kanban.search_board_100k";
+            const std::string scanName = "kanban.search_scan_100k";
+            if (!runner.IsEnabled(wordName) && !runner.IsEnabled(prefixName) && !runner.IsEnabled(phraseName) &&
+                !runner.IsEnabled(boardName) && !runner.IsEnabled(scanName)) return;
+
+            auto dbManager = std::make_shared<DatabaseManager>();
+            if (!dbManager->Initialize(runner.GetWorkPath("kanban_search.db"))) return;
+
+            KanbanDatabase database(dbManager);
+            if (!database.Initialize()) return;
+
+            Dataset::Config config;
+            config.projects = 4;
+            config.boardsPerProject = 10;
+            config.cards = 100000;
+
+            Dataset::Generator generator(config);
+            if (!generator.GenerateKanban(*dbManager, database)) return;
+
+            size_t hits = 0;
+            runner.Measure(wordName, 50, [&](size_t) {
+                hits = database.SearchCards("latency").size();
+            });
+            runner.Measure(prefixName, 50, [&](size_t) {
+                hits = database.SearchCards("la").size();
+            });
+            runner.Measure(phraseName, 50, [&](size_t) {
+                hits = database.SearchCards("\"drag drop\" release").size();
+            });
+            runner.Measure(boardName, 50, [&](size_t) {
+                hits = database.SearchCards("latency", Dataset::BoardId(0)).size();
+            });
+
+            // What a board filter costs without the index: every card of the tree, both fields
+            auto projects = database.GetAllProjectsBulk();
+            size_t scanned = 0;
+            runner.Measure(scanName, 10, [&](size_t) {
+                scanned = 0;
+                for (const auto& project : projects)
+                    for (const auto& board : project->boards)
+                        for (const auto& column : board->columns)
+                            for (const auto& card : column->cards)
+                            {
+                                scanned += Utils::ToLower(card->title).find("latency") != std::string::npos ||
+                                           Utils::ToLower(card->description).find("latency") != std::string::npos;
+                            }
+            });
+
+            const auto top = database.SearchCards("latency", "", 1);
+            std::printf("  (%zu hits/query, %zu cards contain the word; best: %.60s)\n", hits, scanned,
+                        top.empty() ? "-" : top.front().snippet.c_str());
+        }
+
+        // Cold storage on a 100k card tree: the archive pass that moves every completed card
+        // out, hydration of what stays, and one page of a board's archive.
+        void RunArchiveBenchmarks(Runner& runner)
+        {
+            const std::string hotName = "kanban.archive_hydrate_all_100k";
+            const std::string passName = "kanban.archive_pass_100k";
+            const std::string liveName = "kanban.archive_hydrate_live_100k";
+            const std::string pageName = "kanban.archive_page_100k";
+            if (!runner.IsEnabled(hotName) && !runner.IsEnabled(passName) && !runner.IsEnabled(liveName) &&
+                !runner.IsEnabled(pageName)) return;
+
+            auto dbManager = std::make_shared<DatabaseManager>();
+            if (!dbManager->Initialize(runner.GetWorkPath("kanban_archive.db"))) return;
+
+            KanbanDatabase database(dbManager);
+            if (!database.Initialize()) return;
+
+            Dataset::Config config;
+            config.projects = 4;
+            config.boardsPerProject = 10;
+            config.cards = 100000;
+
+            Dataset::Generator generator(config);
+            if (!generator.GenerateKanban(*dbManager, database)) return;
+
+            size_t tags = 0;
+            size_t cardsBefore = 0;
+            runner.Measure(hotName, 3, [&](size_t) {
+                cardsBefore = CountCards(database.GetAllProjectsBulk(), tags);
+            });
+
+            // Completed cards were last touched across a year; each pass moves the cutoff a
+            // slice of it further, warmup passes included, and the last one takes the rest
+            int64_t oldestMs = INT64_MAX;
+            int64_t newestMs = 0;
+            for (const auto& project : database.GetAllProjectsBulk())
+                for (const auto& board : project->boards)
+                    for (const auto& column : board->columns)
+                        for (const auto& card : column->cards)
+                        {
+                            if (card->status == Kanban::CardStatus::Active) continue;
+                            oldestMs = std::min(oldestMs, Utils::ToEpochMs(card->modifiedAt));
+                            newestMs = std::max(newestMs, Utils::ToEpochMs(card->modifiedAt));
+                        }
+
+            const size_t passes = 18; // 8 warmup + 10 measured
+            size_t pass = 0;
+            std::vector<std::string> archivedIds;
+            runner.Measure(passName, passes - 8, [&](size_t) {
+                ++pass;
+                const int64_t cutoffMs = pass == passes ? INT64_MAX
+                    : oldestMs + (newestMs - oldestMs) * static_cast<int64_t>(pass) / static_cast<int64_t>(passes);
+                database.ArchiveCards(cutoffMs, archivedIds);
+            });
+            if (pass < passes)
+            {
+                database.ArchiveCards(INT64_MAX, archivedIds);
+            }
+
+            size_t cardsAfter = 0;
+            runner.Measure(liveName, 3, [&](size_t) {
+                cardsAfter = CountCards(database.GetAllProjectsBulk(), tags);
+            });
+
+            size_t pageCards = 0;
+            runner.Measure(pageName, 200, [&](size_t i) {
+                pageCards = database.GetArchivedCards(Dataset::BoardId(i % 40), (i / 40) * 50, 50).size();
+            });
+
+            std::printf("  (%zu cards, %zu archived, ~%zu per pass, %zu hydrated after%s)\n", cardsBefore,
+                        archivedIds.size(), archivedIds.size() / passes,
+                        cardsAfter, cardsBefore == cardsAfter + archivedIds.size() ? "" : " - MISMATCH");
+        }
+
+        // Export and import of one 100k card project per format, straight from and into the
+        // database: one card in memory on the way out, one batch on the way in.
+        void RunTransferBenchmarks(Runner& runner)
+        {
+            const Kanban::TransferFormat formats[] = { Kanban::TransferFormat::Json, Kanban::TransferFormat::Csv };
+            const char* labels[] = { "json", "csv" };
+            bool enabled = false;
+            for (const char* label : labels)
+            {
+                enabled = enabled || runner.IsEnabled(std::string("kanban.transfer_export_") + label + "_100k") ||
+                          runner.IsEnabled(std::string("kanban.transfer_import_") + label + "_100k");
+            }
+            if (!enabled) return;
+
+            auto dbManager = std::make_shared<DatabaseManager>();
+            if (!dbManager->Initialize(runner.GetWorkPath("kanban_transfer.db"))) return;
+
+            KanbanDatabase database(dbManager);
+            if (!database.Initialize()) return;
+
+            Dataset::Config config;
+            config.projects = 1;
+            config.boardsPerProject = 4;
+            config.cards = 100000;
+
+            Dataset::Generator generator(config);
+            if (!generator.GenerateKanban(*dbManager, database)) return;
+
+            for (size_t i = 0; i < 2; ++i)
+            {
+                const std::string path = runner.GetWorkPath(std::string("kanban_transfer.") + labels[i]);
+
+                Kanban::TransferStats exported;
+                runner.Measure(std::string("kanban.transfer_export_") + labels[i] + "_100k", 3, [&](size_t) {
+                    std::ofstream out(path, std::ios::binary);
+                    Kanban::Exporter exporter(database);
+                    exporter.Export(Dataset::ProjectId(0), "", out, formats[i]);
+                    exported = exporter.GetStats();
+                });
+
+                // Every iteration adds a project; they are dropped again so the next format
+                // imports into the same database
+                Kanban::TransferStats imported;
+                std::vector<std::string> projectIds;
+                runner.Measure(std::string("kanban.transfer_import_") + labels[i] + "_100k", 2, [&](size_t) {
+                    std::ifstream in(path, std::ios::binary);
+                    Kanban::Importer importer(database);
+                    importer.Import(in, formats[i]);
+                    imported = importer.GetStats();
+                    projectIds.push_back(importer.GetProjectId());
+                });
+                for (const std::string& projectId : projectIds)
+                {
+                    database.DeleteProject(projectId);
+                }
+
+                std::printf("  (%s: %zu KiB; export %zu cards at %.0f cards/s, import %zu cards at %.0f cards/s)\n",
+                            labels[i], static_cast<size_t>(exported.bytes / 1024), exported.cards,
+                            exported.GetCardsPerSecond(), imported.cards, imported.GetCardsPerSecond());
+            }
+        }
+
+        // A schema v1 card table opened by v2 code: hydration while the timestamps are still
+        // text (converted by SQLite per row), then the background conversion batch by batch.
+        // Compare with kanban.hydrate_bulk_100k for the converted table.
+        void RunBackfillBenchmarks(Runner& runner)
+        {
+            const std::string textName = "kanban.hydrate_v1_text_100k";
+            const std::string stepName = "kanban.backfill_step_2k";
+            if (!runner.IsEnabled(textName) && !runner.IsEnabled(stepName)) return;
+
+            const std::string path = runner.GetWorkPath("kanban_backfill.db");
+            {
+                auto dbManager = std::make_shared<DatabaseManager>();
+                if (!dbManager->Initialize(path)) return;
+
+                KanbanDatabase database(dbManager);
+                if (!database.Initialize()) return;
+
+                Dataset::Config config;
+                config.projects = 4;
+                config.boardsPerProject = 10;
+                config.cards = 100000;
+
+                Dataset::Generator generator(config);
+                if (!generator.GenerateKanban(*dbManager, database)) return;
+
+                // Put the cards back the way version 1 left them: text columns only
+                dbManager->ExecuteSQL(R"(
+                    UPDATE kanban_cards SET
+                        created_at = strftime('%Y-%m-%d %H:%M:%S', created_ms / 1000, 'unixepoch'),
+                        modified_at = strftime('%Y-%m-%d %H:%M:%S', modified_ms / 1000, 'unixepoch'),
+                        created_ms = NULL, modified_ms = NULL, due_day = NULL;
+                    DELETE FROM schema_backfill;
+                    DROP INDEX IF EXISTS idx_kanban_cards_status_due_day;
+                )");
+            }
+
+            auto dbManager = std::make_shared<DatabaseManager>();
+            if (!dbManager->Initialize(path)) return;
+
+            KanbanDatabase database(dbManager);
+            if (!database.Initialize()) return;
+
+            runner.Measure(textName, 3, [&](size_t) {
+                auto projects = database.GetAllProjectsBulk();
+            });
+
+            // 40 + 8 warmup batches stay inside the 50 the table needs
+            SchemaBackfill& backfill = dbManager->GetSchemaBackfill();
+            runner.Measure(stepName, 40, [&](size_t) {
+                backfill.Step(2000);
+            });
+
+            backfill.RunToCompletion();
+            size_t tags = 0;
+            const size_t cards = CountCards(database.GetAllProjectsBulk(), tags);
+            std::printf("  (%zu cards after backfill, %s)\n", cards, backfill.IsComplete() ? "complete" : "INCOMPLETE");
+        }
+        // A 10k card database as version 1 left it, opened by current code: every schema
+        // migration, the timestamp backfill, then one archive pass. Each iteration starts
+        // from a fresh copy of the v1 file.
+        void RunUpgradeBenchmarks(Runner& runner)
+        {
+            const std::string upgradeName = "kanban.upgrade_v1_archive_10k";
+            if (!runner.IsEnabled(upgradeName)) return;
+
+            const std::string v1Path = runner.GetWorkPath("kanban_v1.db");
+            const std::string path = runner.GetWorkPath("kanban_upgrade.db");
+            {
+                auto dbManager = std::make_shared<DatabaseManager>();
+                if (!dbManager->Initialize(v1Path)) return;
+
+                // The version 1 tables: string ids, text timestamps, no ranks
+                const bool created = dbManager->ExecuteSQL(R"(
+                    CREATE TABLE kanban_projects (
+                        id TEXT PRIMARY KEY, name TEXT NOT NULL, description TEXT, is_active INTEGER DEFAULT 1,
+                        created_at DATETIME DEFAULT CURRENT_TIMESTAMP, modified_at DATETIME DEFAULT CURRENT_TIMESTAMP);
+                    CREATE TABLE kanban_boards (
+                        id TEXT PRIMARY KEY, project_id TEXT NOT NULL, name TEXT NOT NULL, description TEXT,
+                        is_active INTEGER DEFAULT 1, created_at DATETIME DEFAULT CURRENT_TIMESTAMP,
+                        modified_at DATETIME DEFAULT CURRENT_TIMESTAMP,
+                        FOREIGN KEY (project_id) REFERENCES kanban_projects(id) ON DELETE CASCADE);
+                    CREATE TABLE kanban_columns (
+                        id TEXT PRIMARY KEY, board_id TEXT NOT NULL, name TEXT NOT NULL,
+                        header_color_r REAL DEFAULT 0.3, header_color_g REAL DEFAULT 0.5, header_color_b REAL DEFAULT 0.8,
+                        header_color_a REAL DEFAULT 1.0, card_limit INTEGER DEFAULT -1, is_collapsed INTEGER DEFAULT 0,
+                        column_order INTEGER DEFAULT 0,
+                        FOREIGN KEY (board_id) REFERENCES kanban_boards(id) ON DELETE CASCADE);
+                    CREATE TABLE kanban_cards (
+                        id TEXT PRIMARY KEY, column_id TEXT NOT NULL, title TEXT NOT NULL, description TEXT,
+                        priority INTEGER DEFAULT 1, status INTEGER DEFAULT 0, color_r REAL DEFAULT 0.7,
+                        color_g REAL DEFAULT 0.7, color_b REAL DEFAULT 0.7, color_a REAL DEFAULT 1.0, assignee TEXT,
+                        due_date DATETIME, card_order INTEGER DEFAULT 0, created_at DATETIME DEFAULT CURRENT_TIMESTAMP,
+                        modified_at DATETIME DEFAULT CURRENT_TIMESTAMP,
+                        FOREIGN KEY (column_id) REFERENCES kanban_columns(id) ON DELETE CASCADE);
+                    CREATE TABLE kanban_tags (id INTEGER PRIMARY KEY AUTOINCREMENT, name TEXT UNIQUE NOT NULL);
+                    CREATE TABLE kanban_card_tags (
+                        card_id TEXT, tag_id INTEGER, PRIMARY KEY (card_id, tag_id),
+                        FOREIGN KEY (card_id) REFERENCES kanban_cards(id) ON DELETE CASCADE,
+                        FOREIGN KEY (tag_id) REFERENCES kanban_tags(id) ON DELETE CASCADE);
+
+                    INSERT INTO kanban_projects (id, name) VALUES ('project-0', 'Project 0');
+                    WITH RECURSIVE n(i) AS (SELECT 0 UNION ALL SELECT i + 1 FROM n WHERE i < 3)
+                    INSERT INTO kanban_boards (id, project_id, name) SELECT 'board-' || i, 'project-0', 'Board ' || i FROM n;
+                    WITH RECURSIVE n(i) AS (SELECT 0 UNION ALL SELECT i + 1 FROM n WHERE i < 39)
+                    INSERT INTO kanban_columns (id, board_id, name, column_order)
+                    SELECT 'column-' || i, 'board-' || (i / 10), 'Column ' || i, i % 10 FROM n;
+                    WITH RECURSIVE n(i) AS (SELECT 0 UNION ALL SELECT i + 1 FROM n WHERE i < 19)
+                    INSERT INTO kanban_tags (name) SELECT 'tag' || i FROM n;
+                    WITH RECURSIVE n(i) AS (SELECT 0 UNION ALL SELECT i + 1 FROM n WHERE i < 9999)
+                    INSERT INTO kanban_cards (id, column_id, title, status, card_order, created_at, modified_at)
+                    SELECT 'card-' || i, 'column-' || (i % 40), 'Card ' || i, i % 3, i / 40,
+                           datetime('2023-01-01', '+' || (i % 365) || ' days'),
+                           datetime('2023-01-01', '+' || (i % 365) || ' days')
+                    FROM n;
+                    INSERT INTO kanban_card_tags (card_id, tag_id) SELECT id, 1 + rowid % 20 FROM kanban_cards;
+                )");
+                if (!created) return;
+            }
+
+            size_t archived = 0;
+            bool upgraded = true;
+            runner.Measure(upgradeName, 3, [&](size_t) {
+                std::error_code ec;
+                std::filesystem::copy_file(v1Path, path, std::filesystem::copy_options::overwrite_existing, ec);
+
+                auto dbManager = std::make_shared<DatabaseManager>();
+                KanbanDatabase database(dbManager);
+                upgraded = upgraded && !ec && dbManager->Initialize(path) && database.Initialize();
+                dbManager->GetSchemaBackfill().RunToCompletion();
+
+                std::vector<std::string> archivedIds;
+                upgraded = upgraded && database.ArchiveCards(INT64_MAX, archivedIds);
+                archived = archivedIds.size();
+            });
+
+            // Cards with status 1 (completed) and 2 (archived) move out
+            std::printf("  (%zu of 10000 cards archived after the upgrade%s)\n", archived,
+                        upgraded && archived == 6666 ? "" : " - FAILED");
+        }
+    }
+
+    void RunKanbanBenchmarks(Runner& runner)
+    {
+        if (!runner.IsSuiteEnabled("kanban")) return;
+
+        auto dbManager = std::make_shared<DatabaseManager>();
+        if (!dbManager->Initialize(runner.GetWorkPath("kanban.db"))) return;
+
+        KanbanDatabase database(dbManager);
+        if (!database.Initialize()) return;
+
+        // One board of the shared synthetic corpus
+        Dataset::Config config;
+        config.projects = 1;
+        config.boardsPerProject = 1;
+        config.cards = static_cast<int>(runner.Scaled(2000));
+
+        Dataset::Generator generator(config);
+        if (!generator.GenerateKanban(*dbManager, database)) return;
+        const std::string projectId = Dataset::ProjectId(0);
+
+        // Full hydration: projects -> boards -> columns -> cards -> tags
+        runner.Measure("kanban.board_load", 20, [&](size_t) {
+            KanbanManager manager(database);
+            manager.loadProjectsFromDB(&database);
+        });
+
+        // Same hydration under sqlite3_trace_v2, reporting where the time goes
+        if (runner.IsEnabled("kanban.board_load_profiled"))
+        {
+            dbManager->EnableProfiling(true, 1000.0);
+            runner.Measure("kanban.board_load_profiled", 20, [&](size_t) {
+                KanbanManager manager(database);
+                manager.loadProjectsFromDB(&database);
+            });
+            dbManager->EnableProfiling(false);
+
+            const auto statements = dbManager->GetProfiler()->GetStatementStats();
+            for (size_t i = 0; i < statements.size() && i < 5; ++i)
+            {
+                const auto& s = statements[i];
+                std::printf("  %8.2f ms %7llu calls p50 %.3f p99 %.3f ms %8llu rows  %.60s\n",
+                            s.totalMs, static_cast<unsigned long long>(s.calls), s.p50Ms, s.p99Ms,
+                            static_cast<unsigned long long>(s.rows), s.sql.c_str());
+            }
+            dbManager->DumpQueryProfile(runner.GetWorkPath("kanban_profile.json"));
+        }
+
+        // Persist a reversed order for every card of the first column - one UPDATE per card
+        std::vector<std::string> cardIds;
+        for (const auto& card : database.GetCardsByColumn(Dataset::ColumnId(0, 0)))
+        {
+            cardIds.push_back(card->id);
+        }
+
+        const StatementCache::Stats before = dbManager->GetStatementCacheStats();
+        runner.Measure("kanban.column_reorder", 50, [&](size_t) {
+            std::reverse(cardIds.begin(), cardIds.end());
+            database.UpdateCardOrder(Dataset::ColumnId(0, 0), cardIds);
+        });
+
+        if (runner.IsEnabled("kanban.column_reorder"))
+        {
+            const StatementCache::Stats after = dbManager->GetStatementCacheStats();
+            std::printf("  (%zu cards/op, statement cache %llu hits, %llu misses)\n", cardIds.size(),
+                        static_cast<unsigned long long>(after.hits - before.hits),
+                        static_cast<unsigned long long>(after.misses - before.misses));
+        }
+
+        // Drag a card from one column to the top of the next, through the manager
+        KanbanManager manager(database);
+        manager.loadProjectsFromDB(&database);
+        manager.SetCurrentProject(projectId);
+
+        auto moveCard = [&](size_t i) {
+            Kanban::Board* board = manager.GetCurrentBoard();
+            const auto& columns = board->GetColumns();
+
+            size_t from = i % columns.size();
+            while (columns[from]->cards.empty())
+            {
+                from = (from + 1) % columns.size();
+            }
+            size_t to = (from + 1) % columns.size();
+
+            auto card = columns[from]->cards.back();
+            manager.StartDrag(card, columns[from]->id);
+            manager.UpdateDrag(columns[to]->id, 0);
+            manager.EndDrag();
+        };
+
+        runner.Measure("kanban.card_move", runner.Scaled(500), moveCard);
+
+        // Same drag with the write-behind worker: the UI thread only queues the write
+        if (runner.IsEnabled("kanban.card_move_async"))
+        {
+            PersistenceWorker worker(dbManager);
+            worker.Start();
+            manager.SetPersistenceWorker(&worker);
+
+            runner.Measure("kanban.card_move_async", runner.Scaled(500), moveCard);
+
+            worker.Flush();
+            manager.SetPersistenceWorker(nullptr);
+
+            const PersistenceWorker::Stats stats = worker.GetStats();
+            std::printf("  (%llu writes in %llu batches, %llu failed)\n",
+                        static_cast<unsigned long long>(stats.completed),
+                        static_cast<unsigned long long>(stats.batches),
+                        static_cast<unsigned long long>(stats.failed));
+        }
+
+        // Multi-select edit of 200 cards: one UpdateCard (and commit) per card against one
+        // bulk call, and a bulk move between columns
+        {
+            std::vector<std::string> selection;
+            for (const auto& column : manager.GetCurrentBoard()->GetColumns())
+            {
+                for (const auto& card : column->cards)
+                {
+                    if (selection.size() < 200) selection.push_back(card->id);
+                }
+            }
+
+            runner.Measure("kanban.card_priority_each_200", 20, [&](size_t i) {
+                for (const auto& cardId : selection)
+                {
+                    auto card = manager.FindCard(cardId);
+                    card->priority = static_cast<Kanban::Priority>(i % 4);
+                    manager.UpdateCard(card);
+                }
+            });
+            runner.Measure("kanban.card_priority_bulk_200", 20, [&](size_t i) {
+                manager.SetCardsPriority(selection, static_cast<Kanban::Priority>(i % 4));
+            });
+            runner.Measure("kanban.card_move_bulk_200", 20, [&](size_t i) {
+                const auto& columns = manager.GetCurrentBoard()->GetColumns();
+                manager.MoveCards(selection, columns[i % columns.size()]->id);
+            });
+        }
+
+        // Undo and redo of one card edit on the UI thread (writes go to the worker), against
+        // a snapshot of the board: the copy constructor shares the cards, which are edited in
+        // place, so a snapshot also has to clone each of them
+        if (runner.IsEnabled("kanban.undo_redo_edit") || runner.IsEnabled("kanban.board_snapshot"))
+        {
+            PersistenceWorker worker(dbManager);
+            worker.Start();
+            manager.SetPersistenceWorker(&worker);
+
+            Kanban::Board* board = manager.GetCurrentBoard();
+            Kanban::Card edited = *board->columns[0]->cards.front();
+            edited.title += " (edited)";
+            edited.priority = Kanban::Priority::Urgent;
+            manager.EditCard(edited);
+
+            runner.Measure("kanban.undo_redo_edit", runner.Scaled(500), [&](size_t) {
+                manager.Undo();
+                manager.Redo();
+            });
+
+            size_t copied = 0;
+            runner.Measure("kanban.board_snapshot", 50, [&](size_t) {
+                Kanban::Board snapshot(*board);
+                for (auto& column : snapshot.columns)
+                {
+                    for (auto& card : column->cards)
+                    {
+                        card = std::make_shared<Kanban::Card>(*card);
+                        ++copied;
+                    }
+                }
+            });
+
+            worker.Flush();
+            manager.SetPersistenceWorker(nullptr);
+
+            const Kanban::Journal& journal = manager.GetJournal();
+            std::printf("  (journal %zu entries, %zu bytes; %zu cards copied)\n", journal.GetEntryCount(),
+                        journal.GetBytes(), copied);
+        }
+
+        RunCardIndexBenchmarks(runner, 1000, "1k");
+        RunCardIndexBenchmarks(runner, 10000, "10k");
+        RunStatisticsBenchmarks(runner, 10000, "10k");
+        RunFilterBenchmarks(runner, 10000, "10k");
+        RunFilterBenchmarks(runner, 100000, "100k");
+
+        RunHydrationBenchmarks(runner, 10000, "10k");
+        RunHydrationBenchmarks(runner, 100000, "100k");
+        RunBackfillBenchmarks(runner);
+        RunSearchBenchmarks(runner);
+        RunTransferBenchmarks(runner);
+        RunArchiveBenchmarks(runner);
+        RunUpgradeBenchmarks(runner);
+    }
+}
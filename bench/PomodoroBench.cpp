@@ -0,0 +1,108 @@
+// bench/PomodoroBench.cpp
+#include "BenchHarness.h"
+#include "DatasetGenerator.h"
+
+#include "core/Database/DatabaseManager.h"
+#include "core/Database/PomodoroDatabase.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Bench
+{
+    void RunPomodoroBenchmarks(Runner& runner)
+    {
+        if (!runner.IsSuiteEnabled("pomodoro")) return;
+
+        auto dbManager = std::make_shared<DatabaseManager>();
+        if (!dbManager->Initialize(runner.GetWorkPath("pomodoro.db"))) return;
+
+        PomodoroDatabase database(dbManager);
+        if (!database.Initialize()) return;
+
+        // A year of history from the shared synthetic corpus
+        Dataset::Config config;
+        config.pomodoroDays = static_cast<int>(runner.Scaled(365));
+
+        Dataset::Generator generator(config);
+        if (!generator.GeneratePomodoro(*dbManager, database)) return;
+
+        std::vector<std::string> dates;
+        dates.reserve(static_cast<size_t>(config.pomodoroDays));
+        for (int d = 0; d < config.pomodoroDays; ++d)
+        {
+            dates.push_back(generator.GetDate(d));
+        }
+
+        runner.Measure("pomodoro.update_daily_stats", 200, [&](size_t i) {
+            database.UpdateDailyStatistics(dates[(i * 31) % dates.size()]);
+        });
+
+        runner.Measure("pomodoro.get_daily_stats", 500, [&](size_t i) {
+            auto stats = database.GetDailyStatistics(dates[(i * 31) % dates.size()]);
+            (void)stats;
+        });
+
+        runner.Measure("pomodoro.sessions_week", 200, [&](size_t i) {
+            size_t start = (i * 17) % dates.size();
+            size_t end = std::min(start + 6, dates.size() - 1);
+            auto sessions = database.GetSessionsForDateRange(dates[start], dates[end]);
+            (void)sessions;
+        });
+
+        // Read scaling: a fixed batch of monthly aggregates split across N threads, with
+        // the UI-side writer busy the whole time. "writer" runs without a read pool.
+        const int months = std::max(1, config.pomodoroDays / 30);
+        const size_t queriesPerOp = 48;
+
+        auto monthlyStatsOp = [&](size_t threads) {
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < threads; ++t)
+            {
+                workers.emplace_back([&, t]() {
+                    for (size_t q = t; q < queriesPerOp; q += threads)
+                    {
+                        int month = static_cast<int>(q % static_cast<size_t>(months));
+                        auto stats = database.GetMonthlyStatistics(2024 + month / 12, 1 + month % 12);
+                        (void)stats;
+                    }
+                });
+            }
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        };
+
+        auto measureMonthlyStats = [&](const std::string& name, size_t threads) {
+            if (!runner.IsEnabled(name)) return;
+
+            std::atomic<bool> writing{ true };
+            std::thread writer([&]() {
+                for (size_t i = 0; writing; ++i)
+                {
+                    database.UpdateDailyStatistics(dates[(i * 31) % dates.size()]);
+                }
+            });
+
+            runner.Measure(name, 10, [&](size_t) { monthlyStatsOp(threads); });
+
+            writing = false;
+            writer.join();
+        };
+
+        measureMonthlyStats("pomodoro.monthly_stats_writer_t4", 4);
+
+        if (dbManager->OpenReadConnections(8))
+        {
+            for (size_t threads : { 1, 2, 4, 8 })
+            {
+                measureMonthlyStats("pomodoro.monthly_stats_read_t" + std::to_string(threads), threads);
+            }
+        }
+    }
+}
@@ -0,0 +1,249 @@
+// bench/TodoBench.cpp
+#include "BenchHarness.h"
+#include "DatasetGenerator.h"
+
+#include "core/Todo/TodoManager.h"
+#include "core/Utils.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Bench
+{
+    namespace
+    {
+        // Repeating tasks that started ten years back, each with a year of completed
+        // occurrences recorded. Views expand only the days they show.
+        void RunRecurringBenchmarks(Runner& runner)
+        {
+            const int64_t today = Utils::GetTodayDayNumber();
+            const int64_t start = today - 3652;
+            const int seriesCount = static_cast<int>(runner.Scaled(40));
+
+            TodoManager manager;
+            for (int i = 0; i < seriesCount; ++i)
+            {
+                Todo::Recurrence recurrence;
+                recurrence.frequency = static_cast<Todo::Repeat>(1 + i % 3);
+                recurrence.interval = 1 + i % 2;
+                recurrence.weekdays = recurrence.frequency == Todo::Repeat::Weekly ? 0b0011111 : 0;
+                auto task = manager.CreateRepeatingTask("Series " + std::to_string(i), Utils::FormatDayNumber(start), recurrence);
+
+                manager.SetVisibleDays(today - 365, today);
+                for (int64_t day = today - 365; day <= today; ++day)
+                {
+                    for (const auto& occurrence : manager.GetAgendaForDay(day))
+                    {
+                        if (occurrence->seriesId == task->id && day % 3 != 0)
+                            manager.CompleteTask(occurrence->id);
+                    }
+                }
+            }
+
+            // Windows walk back through the ten years, so every expansion is a new range
+            size_t shown = 0;
+            runner.Measure("todo.recurring_week_10y", 2000, [&](size_t i) {
+                const int64_t weekStart = start + static_cast<int64_t>(i * 37 % 520) * 7;
+                manager.SetVisibleDays(weekStart, weekStart + 6);
+                shown = 0;
+                for (int64_t day = weekStart; day <= weekStart + 6; ++day)
+                    shown += manager.GetAgendaForDay(day).size();
+            });
+
+            size_t shownMonth = 0;
+            runner.Measure("todo.recurring_month_10y", 500, [&](size_t i) {
+                const int64_t gridStart = start + static_cast<int64_t>(i * 7 % 120) * 30;
+                manager.SetVisibleDays(gridStart, gridStart + 41);
+                shownMonth = 0;
+                for (int64_t day = gridStart; day <= gridStart + 41; ++day)
+                    shownMonth += manager.GetAgendaForDay(day).size();
+            });
+
+            // Same window every frame: nothing is expanded again
+            runner.Measure("todo.recurring_frame", 20000, [&](size_t) {
+                manager.SetVisibleDays(today - 6, today);
+                shown = manager.GetAgendaForDay(today).size();
+            });
+
+            std::printf("  (%d repeating tasks over 10 years; %zu occurrences today, %zu in the last grid)\n",
+                        seriesCount, shown, shownMonth);
+        }
+    }
+
+    // Calendar queries over five years of tasks held in memory, no database: the lookups
+    // behind the daily, weekly and monthly views. The "scan" variants redo them the way
+    // the store worked when days were keyed by date strings, for comparison.
+    void RunTodoBenchmarks(Runner& runner)
+    {
+        if (!runner.IsSuiteEnabled("todo")) return;
+
+        Dataset::Config config;
+        config.todoDays = static_cast<int>(runner.Scaled(5 * 365));
+        config.tasksPerDay = 6;
+
+        TodoManager manager;
+        Dataset::Generator generator(config);
+        generator.GenerateTodo(manager);
+
+        int64_t firstDay = 0;
+        Utils::ParseDayNumber(generator.GetDate(0), firstDay);
+        const int64_t weeks = std::max(1, config.todoDays / 7);
+        const int64_t months = std::max(1, config.todoDays / 30);
+
+        size_t tasks = 0;
+        runner.Measure("todo.week_5y", 5000, [&](size_t i) {
+            const int64_t weekStart = firstDay + static_cast<int64_t>(i * 37 % weeks) * 7;
+            tasks = manager.GetTasksInDateRange(Utils::FormatDayNumber(weekStart),
+                                                Utils::FormatDayNumber(weekStart + 6)).size();
+        });
+
+        // A month grid: six weeks of cells, one lookup each
+        size_t cells = 0;
+        runner.Measure("todo.month_5y", 2000, [&](size_t i) {
+            const int64_t gridStart = firstDay + static_cast<int64_t>(i * 7 % months) * 30;
+            cells = 0;
+            for (int64_t day = gridStart; day < gridStart + 42; ++day)
+            {
+                const Todo::DayTasks* dayTasks = manager.GetTasksForDay(day);
+                cells += dayTasks ? dayTasks->tasks.size() : 0;
+            }
+        });
+
+        size_t overdue = 0;
+        runner.Measure("todo.overdue_5y", 200, [&](size_t) {
+            overdue = manager.GetOverdueTasks().size();
+        });
+
+        // The same history keyed by "YYYY-MM-DD" in a hash map, every bucket compared
+        std::unordered_map<std::string, std::vector<std::shared_ptr<Todo::Task>>> byDate;
+        for (int64_t day = firstDay; day < firstDay + config.todoDays; ++day)
+        {
+            if (const Todo::DayTasks* dayTasks = manager.GetTasksForDay(day))
+            {
+                byDate[dayTasks->date] = dayTasks->tasks;
+            }
+        }
+
+        size_t scanned = 0;
+        runner.Measure("todo.week_scan_5y", 500, [&](size_t i) {
+            const int64_t weekStart = firstDay + static_cast<int64_t>(i * 37 % weeks) * 7;
+            const std::string startDate = Utils::FormatDayNumber(weekStart);
+            const std::string endDate = Utils::FormatDayNumber(weekStart + 6);
+            scanned = 0;
+            for (const auto& [date, dayTasks] : byDate)
+            {
+                if (date >= startDate && date <= endDate)
+                    scanned += dayTasks.size();
+            }
+        });
+
+        size_t overdueScanned = 0;
+        runner.Measure("todo.overdue_scan_5y", 20, [&](size_t) {
+            overdueScanned = 0;
+            for (const auto& [date, dayTasks] : byDate)
+                for (const auto& task : dayTasks)
+                    overdueScanned += task->IsOverdue();
+        });
+
+        // Both runs of the week query ended on different weeks; compare on the first one
+        const std::string startDate = Utils::FormatDayNumber(firstDay);
+        const std::string endDate = Utils::FormatDayNumber(firstDay + 6);
+        tasks = manager.GetTasksInDateRange(startDate, endDate).size();
+        scanned = 0;
+        for (const auto& [date, dayTasks] : byDate)
+        {
+            if (date >= startDate && date <= endDate)
+                scanned += dayTasks.size();
+        }
+
+        std::printf("  (%d tasks over %d days; %zu in the first week, %zu in the last grid, %zu overdue%s)\n",
+                    manager.GetTotalTaskCount(), config.todoDays, tasks, cells, overdue,
+                    tasks == scanned && overdue == overdueScanned ? "" : " - MISMATCH");
+
+        // Single-task operations by id, as a click or a drop does them
+        std::vector<std::string> taskIds;
+        for (const auto& task : manager.GetTasksInDayRange(firstDay, firstDay + config.todoDays))
+        {
+            taskIds.push_back(task->id);
+        }
+        if (taskIds.empty()) return;
+
+        size_t found = 0;
+        runner.Measure("todo.find_5y", 20000, [&](size_t i) {
+            found += manager.FindTask(taskIds[i * 7919 % taskIds.size()]) != nullptr;
+        });
+
+        runner.Measure("todo.find_scan_5y", 200, [&](size_t i) {
+            const std::string& taskId = taskIds[i * 7919 % taskIds.size()];
+            for (const auto& [date, dayTasks] : byDate)
+                for (const auto& task : dayTasks)
+                    if (task->id == taskId)
+                    {
+                        ++found;
+                        return;
+                    }
+        });
+
+        runner.Measure("todo.toggle_5y", 20000, [&](size_t i) {
+            manager.ToggleTaskStatus(taskIds[i * 7919 % taskIds.size()]);
+        });
+
+        runner.Measure("todo.move_5y", 20000, [&](size_t i) {
+            const int64_t day = firstDay + static_cast<int64_t>(i * 104729 % config.todoDays);
+            manager.MoveTask(taskIds[i * 7919 % taskIds.size()], Utils::FormatDayNumber(day));
+        });
+
+        // Month grids from the manager's cache: a month not cached yet, a cached one, and
+        // a cached one after a toggle invalidated a single cell
+        int firstYear, firstMonth, unused;
+        Utils::CivilFromDays(firstDay, firstYear, firstMonth, unused);
+        auto monthAt = [&](size_t index, int& year, int& month) {
+            const int64_t monthIndex = firstYear * 12LL + firstMonth - 1 + static_cast<int64_t>(index % months);
+            year = static_cast<int>(monthIndex / 12);
+            month = static_cast<int>(monthIndex % 12) + 1;
+        };
+
+        int open = 0;
+        runner.Measure("todo.month_grid_cold", 2000, [&](size_t i) {
+            int year, month;
+            monthAt(i * 7, year, month);
+            const Todo::MonthGrid& grid = manager.GetMonthGrid(year, month);
+            open = 0;
+            for (const Todo::DaySummary& summary : grid.days)
+                open += summary.total - summary.completed;
+        });
+
+        int gridYear, gridMonth;
+        monthAt(months / 2, gridYear, gridMonth);
+        runner.Measure("todo.month_grid_cached", 20000, [&](size_t) {
+            const Todo::MonthGrid& grid = manager.GetMonthGrid(gridYear, gridMonth);
+            open = 0;
+            for (const Todo::DaySummary& summary : grid.days)
+                open += summary.total - summary.completed;
+        });
+
+        const int64_t gridDay = manager.GetMonthGrid(gridYear, gridMonth).days[20].day;
+        std::vector<std::string> gridTaskIds;
+        if (const Todo::DayTasks* dayTasks = manager.GetTasksForDay(gridDay))
+        {
+            for (const auto& task : dayTasks->tasks)
+                gridTaskIds.push_back(task->id);
+        }
+        if (!gridTaskIds.empty())
+        {
+            runner.Measure("todo.month_grid_after_toggle", 20000, [&](size_t i) {
+                manager.ToggleTaskStatus(gridTaskIds[i % gridTaskIds.size()]);
+                const Todo::MonthGrid& grid = manager.GetMonthGrid(gridYear, gridMonth);
+                open = 0;
+                for (const Todo::DaySummary& summary : grid.days)
+                    open += summary.total - summary.completed;
+            });
+        }
+        std::printf("  (%d open tasks in the last grid)\n", open);
+
+        RunRecurringBenchmarks(runner);
+    }
+}
@@ -4,7 +4,8 @@
 #include "core/Utils.h"
 #include <fstream>
 #include <sstream>
-#include <windows.h>
+#include <filesystem>
+#include "platform/Platform.h"
 
 AppConfig::AppConfig()
 {
@@ -12,6 +13,12 @@ AppConfig::AppConfig()
     SetDefaults();
 }
 
+AppConfig::AppConfig(const std::string& configFile)
+    : m_configFile(configFile)
+{
+    SetDefaults();
+}
+
 AppConfig::~AppConfig()
 {
     if (m_isDirty)
@@ -200,6 +207,16 @@ void AppConfig::SetDefaults()
     m_config["ui.sidebarWidth"] = 90;
     m_config["ui.theme"] = std::string("dark");
     
+    // Database defaults (durable, balanced or fast - see DatabaseTuning)
+    m_config["database.profile"] = std::string("balanced");
+    m_config["database.profiling"] = false;     // Dumped to logs/sql_profile.json on exit
+    m_config["database.slowQueryMs"] = 50;
+    m_config["database.backfillBatchRows"] = 2000; // Rows converted per step after a schema upgrade
+    
+    // Kanban defaults - board contents are loaded on demand and cached up to this size
+    m_config["kanban.lazyLoading"] = true;
+    m_config["kanban.boardCacheMiB"] = 64;
+    
     // Window defaults
     m_config["window.x"] = 100;
     m_config["window.y"] = 100;
@@ -215,19 +232,9 @@ void AppConfig::SetDefaults()
 
 std::string AppConfig::GetConfigFilePath() const
 {
-    char exePath[MAX_PATH];
-    GetModuleFileNameA(NULL, exePath, MAX_PATH);
-
-    std::string path(exePath);
-
-    // Strip off the executable name, leaving only the directory
-    size_t pos = path.find_last_of("\\/");
-    if (pos != std::string::npos)
-    {
-        path = path.substr(0, pos);
-    }
-
-    return path + "\\config.txt";  // join with config.txt
+    // config.txt lives next to the executable
+    std::filesystem::path path(Platform::GetExecutableDirectory());
+    return (path / "config.txt").string();
 }
 // std::string AppConfig::GetConfigFilePath() const
 // {
@@ -11,6 +11,7 @@ public:
     using ConfigValue = std::variant<bool, int, float, std::string>;
 
     AppConfig();
+    explicit AppConfig(const std::string& configFile);
     ~AppConfig();
 
     // Load configuration from file
@@ -3,17 +3,13 @@
 #include "app/AppConfig.h"
 #include "core/Logger.h"
 #include "core/Utils.h"
+#include "platform/ClipboardBackend.h"
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <fstream>
 #include <ctime>
 
-// Windows compatibility defines
-#ifndef CF_DIBV5
-#define CF_DIBV5 17
-#endif
-
 namespace Clipboard
 {
     std::string ClipboardItem::GetFormattedTime() const
@@ -83,6 +79,12 @@ namespace Clipboard
 }
 
 ClipboardManager::ClipboardManager()
+    : ClipboardManager(Clipboard::CreateClipboardBackend())
+{
+}
+
+ClipboardManager::ClipboardManager(std::unique_ptr<Clipboard::ClipboardBackend> backend)
+    : m_backend(std::move(backend))
 {
     m_formatFilter = Clipboard::ClipboardFormat::Text; // Default to show all text
 }
@@ -103,33 +105,10 @@ bool ClipboardManager::Initialize(AppConfig* config)
     // Load configuration
     LoadFromConfig();
     
-    // Create hidden window for clipboard monitoring
-    WNDCLASSW wc = {};
-    wc.lpfnWndProc = WindowProc;
-    wc.hInstance = GetModuleHandle(nullptr);
-    wc.lpszClassName = L"PotensioClipboardWindow";
-    
-    if (!RegisterClassW(&wc))
+    // Hook up the platform clipboard
+    if (!m_backend || !m_backend->Initialize([this]() { OnClipboardChanged(); }))
     {
-        Logger::Error("Failed to register clipboard window class");
-        return false;
-    }
-    
-    m_hwnd = CreateWindowExW(
-        0,
-        L"PotensioClipboardWindow",
-        L"Potensio Clipboard Monitor",
-        0,
-        0, 0, 0, 0,
-        HWND_MESSAGE, // Message-only window
-        nullptr,
-        GetModuleHandle(nullptr),
-        this
-    );
-    
-    if (!m_hwnd)
-    {
-        Logger::Error("Failed to create clipboard monitor window");
+        Logger::Error("Failed to initialize clipboard backend");
         return false;
     }
     
@@ -159,12 +138,8 @@ void ClipboardManager::Shutdown()
     // Save current state
     SaveToConfig();
     
-    // Cleanup window
-    if (m_hwnd)
-    {
-        DestroyWindow(m_hwnd);
-        m_hwnd = nullptr;
-    }
+    // Release the platform clipboard
+    m_backend->Shutdown();
     
     // Clear data
     m_history.clear();
@@ -178,8 +153,11 @@ void ClipboardManager::StartMonitoring()
 {
     if (!m_isInitialized || m_isMonitoring) return;
     
-    // Add to clipboard viewer chain
-    m_nextViewer = SetClipboardViewer(m_hwnd);
+    if (!m_backend->StartMonitoring())
+    {
+        Logger::Error("Failed to start clipboard monitoring");
+        return;
+    }
     m_isMonitoring = true;
     
     Logger::Info("Started clipboard monitoring");
@@ -192,58 +170,19 @@ void ClipboardManager::StopMonitoring()
 {
     if (!m_isMonitoring) return;
     
-    // Remove from clipboard viewer chain
-    ChangeClipboardChain(m_hwnd, m_nextViewer);
-    m_nextViewer = nullptr;
+    m_backend->StopMonitoring();
     m_isMonitoring = false;
     
     Logger::Info("Stopped clipboard monitoring");
 }
 
-LRESULT CALLBACK ClipboardManager::WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+void ClipboardManager::OnClipboardChanged()
 {
-    if (uMsg == WM_CREATE)
+    if (!m_ignoreNextChange)
     {
-        CREATESTRUCT* pCreate = reinterpret_cast<CREATESTRUCT*>(lParam);
-        ClipboardManager* pManager = reinterpret_cast<ClipboardManager*>(pCreate->lpCreateParams);
-        SetWindowLongPtr(hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(pManager));
-        return 0;
+        ProcessClipboardChange();
     }
-    
-    ClipboardManager* pManager = reinterpret_cast<ClipboardManager*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
-    if (pManager)
-    {
-        return pManager->HandleMessage(hwnd, uMsg, wParam, lParam);
-    }
-    
-    return DefWindowProc(hwnd, uMsg, wParam, lParam);
-}
-
-LRESULT ClipboardManager::HandleMessage(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
-{
-    switch (uMsg)
-    {
-        case WM_DRAWCLIPBOARD:
-            if (!m_ignoreNextChange)
-            {
-                ProcessClipboardChange();
-            }
-            m_ignoreNextChange = false;
-            
-            // Pass message to next viewer
-            if (m_nextViewer)
-                SendMessage(m_nextViewer, uMsg, wParam, lParam);
-            return 0;
-            
-        case WM_CHANGECBCHAIN:
-            if ((HWND)wParam == m_nextViewer)
-                m_nextViewer = (HWND)lParam;
-            else if (m_nextViewer)
-                SendMessage(m_nextViewer, uMsg, wParam, lParam);
-            return 0;
-    }
-    
-    return DefWindowProc(hwnd, uMsg, wParam, lParam);
+    m_ignoreNextChange = false;
 }
 
 void ClipboardManager::ProcessClipboardChange()
@@ -269,7 +208,8 @@ void ClipboardManager::ProcessClipboardChange()
 
 std::shared_ptr<Clipboard::ClipboardItem> ClipboardManager::CreateItemFromClipboard()
 {
-    if (!OpenClipboard(m_hwnd))
+    Clipboard::ClipboardSnapshot snapshot;
+    if (!m_backend->Read(snapshot, m_clipboardConfig.saveImages, m_clipboardConfig.saveFiles))
     {
         Logger::Warning("Failed to open clipboard for reading");
         return nullptr;
@@ -278,14 +218,14 @@ std::shared_ptr<Clipboard::ClipboardItem> ClipboardManager::CreateItemFromClipbo
     auto item = std::make_shared<Clipboard::ClipboardItem>();
     item->id = GenerateItemId();
     item->timestamp = std::chrono::system_clock::now();
-    item->format = DetectFormat();
-    item->source = GetActiveWindowTitle();
+    item->format = snapshot.format;
+    item->source = m_backend->GetActiveWindowTitle();
     
     switch (item->format)
     {
         case Clipboard::ClipboardFormat::Text:
         case Clipboard::ClipboardFormat::RichText:
-            item->content = ExtractTextData();
+            item->content = std::move(snapshot.text);
             item->preview = CreatePreview(item->content, item->format);
             item->title = item->preview.length() > 50 ? 
                          item->preview.substr(0, 47) + "..." : item->preview;
@@ -295,7 +235,7 @@ std::shared_ptr<Clipboard::ClipboardItem> ClipboardManager::CreateItemFromClipbo
         case Clipboard::ClipboardFormat::Image:
             if (m_clipboardConfig.saveImages)
             {
-                item->imageData = ExtractImageData();
+                item->imageData = std::move(snapshot.imageData);
                 item->dataSize = item->imageData.size();
                 item->title = "Image (" + item->GetSizeString() + ")";
                 item->preview = "Image from " + item->source;
@@ -305,7 +245,7 @@ std::shared_ptr<Clipboard::ClipboardItem> ClipboardManager::CreateItemFromClipbo
         case Clipboard::ClipboardFormat::Files:
             if (m_clipboardConfig.saveFiles)
             {
-                item->filePaths = ExtractFileData();
+                item->filePaths = std::move(snapshot.filePaths);
                 item->dataSize = 0; // Don't store actual file data
                 item->title = std::to_string(item->filePaths.size()) + " file(s)";
                 item->preview = item->filePaths.empty() ? "" : item->filePaths[0];
@@ -315,12 +255,9 @@ std::shared_ptr<Clipboard::ClipboardItem> ClipboardManager::CreateItemFromClipbo
             break;
             
         default:
-            CloseClipboard();
             return nullptr;
     }
     
-    CloseClipboard();
-    
     // Check size limits
     if (item->dataSize > static_cast<size_t>(m_clipboardConfig.maxItemSizeKB * 1024))
     {
@@ -337,158 +274,6 @@ std::shared_ptr<Clipboard::ClipboardItem> ClipboardManager::CreateItemFromClipbo
     return item;
 }
 
-Clipboard::ClipboardFormat ClipboardManager::DetectFormat() const
-{
-    // Check for files first (highest priority)
-    if (IsClipboardFormatAvailable(CF_HDROP))
-        return Clipboard::ClipboardFormat::Files;
-    
-    // Check for images
-    if (IsClipboardFormatAvailable(CF_BITMAP) || 
-        IsClipboardFormatAvailable(CF_DIB) ||
-        IsClipboardFormatAvailable(CF_DIBV5))
-        return Clipboard::ClipboardFormat::Image;
-    
-    // Check for rich text formats
-    UINT rtfFormat = RegisterClipboardFormatW(L"Rich Text Format");
-    UINT htmlFormat = RegisterClipboardFormatW(L"HTML Format");
-    
-    if (IsClipboardFormatAvailable(rtfFormat) || IsClipboardFormatAvailable(htmlFormat))
-        return Clipboard::ClipboardFormat::RichText;
-    
-    // Check for Unicode text (preferred)
-    if (IsClipboardFormatAvailable(CF_UNICODETEXT))
-        return Clipboard::ClipboardFormat::Text;
-    
-    // Check for ANSI text
-    if (IsClipboardFormatAvailable(CF_TEXT))
-        return Clipboard::ClipboardFormat::Text;
-    
-    return Clipboard::ClipboardFormat::Unknown;
-}
-
-std::string ClipboardManager::ExtractTextData() const
-{
-    // Try rich text first
-    UINT rtfFormat = RegisterClipboardFormatW(L"Rich Text Format");
-    if (IsClipboardFormatAvailable(rtfFormat))
-    {
-        HANDLE hData = GetClipboardData(rtfFormat);
-        if (hData)
-        {
-            char* pRtfText = static_cast<char*>(GlobalLock(hData));
-            if (pRtfText)
-            {
-                std::string result(pRtfText);
-                GlobalUnlock(hData);
-                return result;
-            }
-        }
-    }
-    
-    // Try HTML format
-    UINT htmlFormat = RegisterClipboardFormatW(L"HTML Format");
-    if (IsClipboardFormatAvailable(htmlFormat))
-    {
-        HANDLE hData = GetClipboardData(htmlFormat);
-        if (hData)
-        {
-            char* pHtmlText = static_cast<char*>(GlobalLock(hData));
-            if (pHtmlText)
-            {
-                std::string result(pHtmlText);
-                GlobalUnlock(hData);
-                return result;
-            }
-        }
-    }
-    
-    // Fall back to Unicode text
-    HANDLE hData = GetClipboardData(CF_UNICODETEXT);
-    if (!hData)
-    {
-        hData = GetClipboardData(CF_TEXT);
-        if (!hData) return "";
-    }
-    
-    if (hData)
-    {
-        if (IsClipboardFormatAvailable(CF_UNICODETEXT))
-        {
-            wchar_t* pszText = static_cast<wchar_t*>(GlobalLock(hData));
-            if (pszText)
-            {
-                // Convert to UTF-8
-                int size = WideCharToMultiByte(CP_UTF8, 0, pszText, -1, nullptr, 0, nullptr, nullptr);
-                std::string result(size - 1, 0);
-                WideCharToMultiByte(CP_UTF8, 0, pszText, -1, &result[0], size, nullptr, nullptr);
-                GlobalUnlock(hData);
-                return result;
-            }
-        }
-        else
-        {
-            char* pszText = static_cast<char*>(GlobalLock(hData));
-            if (pszText)
-            {
-                std::string result(pszText);
-                GlobalUnlock(hData);
-                return result;
-            }
-        }
-    }
-    
-    return "";
-}
-
-std::vector<unsigned char> ClipboardManager::ExtractImageData() const
-{
-    std::vector<unsigned char> result;
-    
-    HANDLE hData = GetClipboardData(CF_DIB);
-    if (hData)
-    {
-        BITMAPINFO* pBitmapInfo = static_cast<BITMAPINFO*>(GlobalLock(hData));
-        if (pBitmapInfo)
-        {
-            DWORD dataSize = static_cast<DWORD>(GlobalSize(hData));
-            result.resize(dataSize);
-            memcpy(result.data(), pBitmapInfo, dataSize);
-            GlobalUnlock(hData);
-        }
-    }
-    
-    return result;
-}
-
-std::vector<std::string> ClipboardManager::ExtractFileData() const
-{
-    std::vector<std::string> result;
-    
-    HANDLE hData = GetClipboardData(CF_HDROP);
-    if (hData)
-    {
-        HDROP hDrop = static_cast<HDROP>(hData);
-        UINT fileCount = DragQueryFileW(hDrop, 0xFFFFFFFF, nullptr, 0);
-        
-        for (UINT i = 0; i < fileCount; ++i)
-        {
-            UINT pathLength = DragQueryFileW(hDrop, i, nullptr, 0);
-            std::wstring wPath(pathLength, 0);
-            DragQueryFileW(hDrop, i, &wPath[0], pathLength + 1);
-            
-            // Convert to UTF-8
-            int size = WideCharToMultiByte(CP_UTF8, 0, wPath.c_str(), -1, nullptr, 0, nullptr, nullptr);
-            std::string path(size - 1, 0);
-            WideCharToMultiByte(CP_UTF8, 0, wPath.c_str(), -1, &path[0], size, nullptr, nullptr);
-            
-            result.push_back(path);
-        }
-    }
-    
-    return result;
-}
-
 std::string ClipboardManager::CreatePreview(const std::string& content, Clipboard::ClipboardFormat format) const
 {
     if (content.empty()) return "";
@@ -614,29 +399,12 @@ std::vector<std::shared_ptr<Clipboard::ClipboardItem>> ClipboardManager::GetFavo
 
 void ClipboardManager::CopyToClipboard(const std::string& text)
 {
-    if (!OpenClipboard(m_hwnd))
+    m_ignoreNextChange = true; // Don't add our own change to history
+    if (!m_backend->WriteText(text))
     {
+        m_ignoreNextChange = false;
         Logger::Warning("Failed to open clipboard for writing");
-        return;
     }
-    
-    EmptyClipboard();
-    
-    // Convert to wide string
-    int size = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, nullptr, 0);
-    HGLOBAL hGlobal = GlobalAlloc(GMEM_MOVEABLE, size * sizeof(wchar_t));
-    
-    if (hGlobal)
-    {
-        wchar_t* pGlobal = static_cast<wchar_t*>(GlobalLock(hGlobal));
-        MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, pGlobal, size);
-        GlobalUnlock(hGlobal);
-        
-        m_ignoreNextChange = true; // Don't add our own change to history
-        SetClipboardData(CF_UNICODETEXT, hGlobal);
-    }
-    
-    CloseClipboard();
 }
 
 void ClipboardManager::CopyToClipboard(std::shared_ptr<Clipboard::ClipboardItem> item)
@@ -668,12 +436,7 @@ void ClipboardManager::CopyToClipboard(std::shared_ptr<Clipboard::ClipboardItem>
 
 std::string ClipboardManager::GetCurrentClipboardText()
 {
-    if (!OpenClipboard(m_hwnd))
-        return "";
-        
-    std::string result = ExtractTextData();
-    CloseClipboard();
-    return result;
+    return m_backend->ReadText();
 }
 
 void ClipboardManager::DeleteItem(const std::string& id)
@@ -806,24 +569,6 @@ bool ClipboardManager::ShouldIgnoreApp(const std::string& appName) const
     return false;
 }
 
-std::string ClipboardManager::GetActiveWindowTitle() const
-{
-    HWND hwnd = GetForegroundWindow();
-    if (!hwnd) return "";
-    
-    wchar_t title[256];
-    if (GetWindowTextW(hwnd, title, sizeof(title) / sizeof(wchar_t)))
-    {
-        // Convert to UTF-8
-        int size = WideCharToMultiByte(CP_UTF8, 0, title, -1, nullptr, 0, nullptr, nullptr);
-        std::string result(size - 1, 0);
-        WideCharToMultiByte(CP_UTF8, 0, title, -1, &result[0], size, nullptr, nullptr);
-        return result;
-    }
-    
-    return "";
-}
-
 // Additional methods for statistics, drag & drop, etc.
 int ClipboardManager::GetTotalItemCount() const
 {
@@ -948,27 +693,7 @@ void ClipboardManager::PasteItem(std::shared_ptr<Clipboard::ClipboardItem> item)
     CopyToClipboard(item);
     
     // Then simulate Ctrl+V paste
-    INPUT inputs[4] = {};
-    
-    // Ctrl down
-    inputs[0].type = INPUT_KEYBOARD;
-    inputs[0].ki.wVk = VK_CONTROL;
-    
-    // V down
-    inputs[1].type = INPUT_KEYBOARD;
-    inputs[1].ki.wVk = 'V';
-    
-    // V up
-    inputs[2].type = INPUT_KEYBOARD;
-    inputs[2].ki.wVk = 'V';
-    inputs[2].ki.dwFlags = KEYEVENTF_KEYUP;
-    
-    // Ctrl up
-    inputs[3].type = INPUT_KEYBOARD;
-    inputs[3].ki.wVk = VK_CONTROL;
-    inputs[3].ki.dwFlags = KEYEVENTF_KEYUP;
-    
-    SendInput(4, inputs, sizeof(INPUT));
+    m_backend->SendPasteShortcut();
 }
 
 void ClipboardManager::ClearOldItems()
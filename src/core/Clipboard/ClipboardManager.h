@@ -7,10 +7,10 @@
 #include <functional>
 #include <chrono>
 #include <unordered_map>
-#include <windows.h>
 
 // Forward declarations
 class AppConfig;
+namespace Clipboard { class ClipboardBackend; }
 
 namespace Clipboard
 {
@@ -75,6 +75,7 @@ class ClipboardManager
 {
 public:
     ClipboardManager();
+    explicit ClipboardManager(std::unique_ptr<Clipboard::ClipboardBackend> backend);
     ~ClipboardManager();
 
     // Initialization
@@ -159,8 +160,7 @@ private:
     bool m_isInitialized = false;
 
     // Clipboard monitoring
-    HWND m_hwnd = nullptr;
-    HWND m_nextViewer = nullptr;
+    std::unique_ptr<Clipboard::ClipboardBackend> m_backend;
     bool m_ignoreNextChange = false;
 
     // Data storage
@@ -179,23 +179,15 @@ private:
     std::function<void(const std::string&)> m_onItemDeleted;
     std::function<void()> m_onHistoryCleared;
 
-    // Window message handling
-    static LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
-    LRESULT HandleMessage(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
-
     // Internal operations
+    void OnClipboardChanged();
     void ProcessClipboardChange();
     std::shared_ptr<Clipboard::ClipboardItem> CreateItemFromClipboard();
     void AddItem(std::shared_ptr<Clipboard::ClipboardItem> item);
     void EnforceHistoryLimit();
     bool ShouldIgnoreApp(const std::string& appName) const;
-    std::string GetActiveWindowTitle() const;
     
     // Data conversion helpers
-    Clipboard::ClipboardFormat DetectFormat() const;
-    std::string ExtractTextData() const;
-    std::vector<unsigned char> ExtractImageData() const;
-    std::vector<std::string> ExtractFileData() const;
     std::string CreatePreview(const std::string& content, Clipboard::ClipboardFormat format) const;
     
     // Persistence
@@ -3,9 +3,61 @@
 #include "sqlite3.h"
 #include <filesystem>
 
+thread_local DatabaseManager::ReadConnection* DatabaseManager::s_activeReader = nullptr;
+thread_local const DatabaseManager* DatabaseManager::s_activeReaderOwner = nullptr;
+
+// DatabaseTuning presets
+DatabaseTuning DatabaseTuning::Durable()
+{
+    DatabaseTuning tuning;
+    tuning.synchronous = "FULL";
+    tuning.cacheSizeKiB = 2000;
+    tuning.mmapSizeBytes = 0;
+    tuning.tempStore = "DEFAULT";
+    tuning.walAutoCheckpointPages = 1000;
+    return tuning;
+}
+
+DatabaseTuning DatabaseTuning::Balanced()
+{
+    return DatabaseTuning();
+}
+
+DatabaseTuning DatabaseTuning::Fast()
+{
+    DatabaseTuning tuning;
+    tuning.synchronous = "OFF";
+    tuning.cacheSizeKiB = 65536;
+    tuning.mmapSizeBytes = 256ll << 20;
+    tuning.tempStore = "MEMORY";
+    tuning.walAutoCheckpointPages = 10000;
+    return tuning;
+}
+
+bool DatabaseTuning::FromProfile(const std::string& name, DatabaseTuning& tuning)
+{
+    if (name == "durable")       tuning = Durable();
+    else if (name == "balanced") tuning = Balanced();
+    else if (name == "fast")     tuning = Fast();
+    else return false;
+    return true;
+}
+
+// Holds the writer connection for one call and records the owning thread
+class DatabaseManager::WriterScope
+{
+public:
+    explicit WriterScope(DatabaseManager& manager) : m_manager(manager) { m_manager.AcquireWriter(); }
+    ~WriterScope() { m_manager.ReleaseWriter(); }
+
+private:
+    DatabaseManager& m_manager;
+};
+
 DatabaseManager::DatabaseManager()
     : m_database(nullptr)
-    , m_inTransaction(false)
+    , m_transactionDepth(0)
+    , m_schemaBackfill(std::make_unique<SchemaBackfill>(*this))
 {
 }
 
@@ -64,12 +116,20 @@ bool DatabaseManager::Initialize(const std::string& databasePath)
         Logger::Warning("Failed to enable foreign keys");
     }
 
+    // Page size has to be chosen before WAL mode writes the database header
+    ExecuteSQL("PRAGMA page_size = " + std::to_string(m_tuning.pageSizeBytes) + ";");
+
     // Set journal mode to WAL for better concurrency
     if (!ExecuteSQL("PRAGMA journal_mode = WAL;"))
     {
         Logger::Warning("Failed to set WAL journal mode");
     }
 
+    if (!ApplyTuning(m_tuning))
+    {
+        Logger::Warning("Failed to apply database tuning");
+    }
+
     // Create version table if it doesn't exist
     CreateVersionTable();
 
@@ -79,13 +139,20 @@ bool DatabaseManager::Initialize(const std::string& databasePath)
 
 void DatabaseManager::Shutdown()
 {
+    CloseReadConnections();
+
+    WriterScope writer(*this);
+
     if (m_database)
     {
-        if (m_inTransaction)
+        while (m_transactionDepth > 0)
         {
             RollbackTransaction();
         }
 
+        // Outstanding statements would keep the connection open
+        m_statementCache.Clear();
+
         int result = sqlite3_close(m_database);
         if (result != SQLITE_OK)
         {
@@ -99,6 +166,8 @@ void DatabaseManager::Shutdown()
 
 bool DatabaseManager::ExecuteSQL(const std::string& sql)
 {
+    WriterScope writer(*this);
+
     if (!m_database)
     {
         m_lastError = "Database not initialized";
@@ -125,25 +194,28 @@ bool DatabaseManager::ExecuteSQL(const std::string& sql)
 
 bool DatabaseManager::ExecuteSQL(const std::string& sql, const std::function<void(sqlite3_stmt*)>& bindCallback)
 {
+    WriterScope writer(*this);
+
     if (!m_database)
     {
         m_lastError = "Database not initialized";
         return false;
     }
 
-    SQLiteStatement stmt(m_database, sql);
+    StatementCache::Lease stmt = m_statementCache.Acquire(m_database, sql);
     if (!stmt.IsValid())
     {
         m_lastError = "Failed to prepare statement: " + GetSQLiteErrorMessage();
         return false;
     }
+    RecordLease(stmt, sql);
 
     if (bindCallback)
     {
         bindCallback(stmt.Get());
     }
 
-    if (!stmt.Step())
+    if (sqlite3_step(stmt.Get()) != SQLITE_ROW)
     {
         // Check if it's actually an error or just no more rows
         int result = sqlite3_errcode(m_database);
@@ -157,6 +229,42 @@ bool DatabaseManager::ExecuteSQL(const std::string& sql, const std::function<voi
     return true;
 }
 
+// Shared by the writer and the read connections
+bool DatabaseManager::RunQuery(StatementCache& cache, sqlite3* database, const std::string& sql,
+                               const std::function<void(sqlite3_stmt*)>& bindCallback,
+                               const std::function<bool(sqlite3_stmt*)>& resultCallback)
+{
+    StatementCache::Lease stmt = cache.Acquire(database, sql);
+    if (!stmt.IsValid())
+    {
+        return false;
+    }
+    RecordLease(stmt, sql);
+
+    if (bindCallback)
+    {
+        bindCallback(stmt.Get());
+    }
+
+    while (sqlite3_step(stmt.Get()) == SQLITE_ROW)
+    {
+        if (resultCallback && !resultCallback(stmt.Get()))
+        {
+            break; // Callback requested to stop
+        }
+    }
+
+    return true;
+}
+
+void DatabaseManager::RecordLease(const StatementCache::Lease& lease, const std::string& sql)
+{
+    if (m_profilingEnabled && lease.WasCacheHit())
+    {
+        m_profiler->RecordCacheHit(sql);
+    }
+}
+
 bool DatabaseManager::ExecuteQuery(const std::string& sql, const std::function<bool(sqlite3_stmt*)>& resultCallback)
 {
     return ExecuteQuery(sql, nullptr, resultCallback);
@@ -166,80 +274,357 @@ bool DatabaseManager::ExecuteQuery(const std::string& sql,
                                   const std::function<void(sqlite3_stmt*)>& bindCallback,
                                   const std::function<bool(sqlite3_stmt*)>& resultCallback)
 {
+    WriterScope writer(*this);
+
     if (!m_database)
     {
         m_lastError = "Database not initialized";
         return false;
     }
 
-    SQLiteStatement stmt(m_database, sql);
-    if (!stmt.IsValid())
+    if (!RunQuery(m_statementCache, m_database, sql, bindCallback, resultCallback))
     {
         m_lastError = "Failed to prepare statement: " + GetSQLiteErrorMessage();
         return false;
     }
 
-    if (bindCallback)
+    return true;
+}
+
+bool DatabaseManager::ExecuteReadQuery(const std::string& sql, const std::function<bool(sqlite3_stmt*)>& resultCallback)
+{
+    return ExecuteReadQuery(sql, nullptr, resultCallback);
+}
+
+bool DatabaseManager::ExecuteReadQuery(const std::string& sql,
+                                       const std::function<void(sqlite3_stmt*)>& bindCallback,
+                                       const std::function<bool(sqlite3_stmt*)>& resultCallback)
+{
+    // Nested read: stay on the reader this thread already holds
+    if (s_activeReaderOwner == this && s_activeReader)
     {
-        bindCallback(stmt.Get());
+        return RunQuery(s_activeReader->statementCache, s_activeReader->database, sql, bindCallback, resultCallback);
     }
 
-    while (stmt.Step())
+    ReadConnection* connection = nullptr;
+    if (m_readPoolOpen && !IsWriterHeldByThisThread())
     {
-        if (resultCallback && !resultCallback(stmt.Get()))
+        connection = AcquireReadConnection(); // nullptr if the pool closed meanwhile
+    }
+    if (!connection)
+    {
+        return ExecuteQuery(sql, bindCallback, resultCallback);
+    }
+
+    s_activeReader = connection;
+    s_activeReaderOwner = this;
+
+    bool success = RunQuery(connection->statementCache, connection->database, sql, bindCallback, resultCallback);
+
+    s_activeReader = nullptr;
+    s_activeReaderOwner = nullptr;
+    ReleaseReadConnection(connection);
+
+    return success;
+}
+
+bool DatabaseManager::OpenReadConnections(size_t count)
+{
+    CloseReadConnections();
+
+    if (!m_database || m_databasePath.empty() || m_databasePath == ":memory:")
+    {
+        return false; // Private in-memory databases cannot be shared
+    }
+
+    // Opened aside and published under the pool lock once all of them are ready
+    std::vector<std::unique_ptr<ReadConnection>> connections;
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto connection = std::make_unique<ReadConnection>();
+
+        // Each reader is used by one thread at a time, so SQLite's own mutex is not needed
+        int result = sqlite3_open_v2(m_databasePath.c_str(), &connection->database,
+                                     SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr);
+        if (result != SQLITE_OK)
         {
-            break; // Callback requested to stop
+            Logger::Error("Failed to open read connection: {}",
+                          connection->database ? sqlite3_errmsg(connection->database) : "out of memory");
+            sqlite3_close(connection->database);
+            for (auto& opened : connections)
+            {
+                sqlite3_close(opened->database);
+            }
+            return false;
         }
+
+        // Tuned and traced by AcquireReadConnection before its first query
+        connections.push_back(std::move(connection));
     }
 
+    {
+        std::lock_guard<std::mutex> lock(m_readPoolMutex);
+        m_readConnections = std::move(connections);
+        for (const auto& connection : m_readConnections)
+        {
+            m_idleReadConnections.push_back(connection.get());
+        }
+        m_readPoolOpen = true;
+    }
+
+    Logger::Debug("Opened {} read connections", count);
     return true;
 }
 
-bool DatabaseManager::BeginTransaction()
+size_t DatabaseManager::GetReadConnectionCount() const
 {
-    if (m_inTransaction)
+    std::lock_guard<std::mutex> lock(m_readPoolMutex);
+    return m_readConnections.size();
+}
+
+bool DatabaseManager::ApplyTuning(const DatabaseTuning& tuning)
+{
+    WriterScope writer(*this);
+
+    if (!m_database)
     {
-        Logger::Warning("Transaction already in progress");
+        m_lastError = "Database not initialized";
         return false;
     }
 
-    if (ExecuteSQL("BEGIN TRANSACTION;"))
+    m_tuning = tuning;
+
+    const std::string sql =
+        "PRAGMA synchronous = " + tuning.synchronous + ";"
+        "PRAGMA cache_size = -" + std::to_string(tuning.cacheSizeKiB) + ";"
+        "PRAGMA mmap_size = " + std::to_string(tuning.mmapSizeBytes) + ";"
+        "PRAGMA temp_store = " + tuning.tempStore + ";"
+        "PRAGMA wal_autocheckpoint = " + std::to_string(tuning.walAutoCheckpointPages) + ";";
+
+    bool success = ExecuteSQL(sql);
+    sqlite3_busy_timeout(m_database, tuning.busyTimeoutMs);
+
+    // Readers pick the new settings up the next time they are acquired, including the
+    // ones busy right now
+    std::lock_guard<std::mutex> lock(m_readPoolMutex);
+    m_readTuning = tuning;
+    ++m_readTuningGeneration;
+
+    return success;
+}
+
+bool DatabaseManager::ApplyReadTuning(sqlite3* database, const DatabaseTuning& tuning)
+{
+    // synchronous, checkpointing and page size only matter to the writer
+    const std::string sql =
+        "PRAGMA cache_size = -" + std::to_string(tuning.cacheSizeKiB) + ";"
+        "PRAGMA mmap_size = " + std::to_string(tuning.mmapSizeBytes) + ";"
+        "PRAGMA temp_store = " + tuning.tempStore + ";";
+
+    sqlite3_busy_timeout(database, tuning.busyTimeoutMs);
+    return sqlite3_exec(database, sql.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK;
+}
+
+void DatabaseManager::EnableProfiling(bool enable, double slowQueryMs)
+{
+    WriterScope writer(*this);
+
+    if (enable && !m_profiler)
     {
-        m_inTransaction = true;
+        m_profiler = std::make_unique<QueryProfiler>(slowQueryMs);
+        m_profiler->AttachExplainDatabase(m_databasePath);
+    }
+    if (!m_profiler)
+    {
+        return;
+    }
+
+    m_profiler->SetSlowThresholdMs(slowQueryMs);
+    m_profilingEnabled = enable;
+
+    // A reader may be running a query on another thread; each one installs or removes
+    // the trace itself when next acquired
+    {
+        std::lock_guard<std::mutex> lock(m_readPoolMutex);
+        m_readProfiler = enable ? m_profiler.get() : nullptr;
+    }
+
+    if (enable) m_profiler->Trace(m_database);
+    else m_profiler->Untrace(m_database);
+
+    Logger::Info("Query profiling {} (slow query threshold {} ms)", enable ? "enabled" : "disabled", slowQueryMs);
+}
+
+bool DatabaseManager::DumpQueryProfile(const std::string& filePath) const
+{
+    return m_profiler && m_profiler->DumpJson(filePath);
+}
+
+DatabaseManager::ReadConnection* DatabaseManager::AcquireReadConnection()
+{
+    std::unique_lock<std::mutex> lock(m_readPoolMutex);
+    m_readConnectionAvailable.wait(lock, [this]() { return !m_readPoolOpen || !m_idleReadConnections.empty(); });
+    if (!m_readPoolOpen)
+    {
+        return nullptr;
+    }
+
+    ReadConnection* connection = m_idleReadConnections.back();
+    m_idleReadConnections.pop_back();
+    if (connection->tuningGeneration == m_readTuningGeneration && connection->tracedBy == m_readProfiler)
+    {
+        return connection;
+    }
+
+    // The reader belongs to this thread now, so it is set up outside the lock
+    const DatabaseTuning tuning = m_readTuning;
+    const unsigned generation = m_readTuningGeneration;
+    QueryProfiler* profiler = m_readProfiler;
+    lock.unlock();
+
+    if (connection->tuningGeneration != generation)
+    {
+        if (!ApplyReadTuning(connection->database, tuning))
+        {
+            Logger::Warning("Failed to apply database tuning to a read connection");
+        }
+        connection->tuningGeneration = generation;
+    }
+    if (connection->tracedBy != profiler)
+    {
+        if (profiler) profiler->Trace(connection->database);
+        else connection->tracedBy->Untrace(connection->database);
+        connection->tracedBy = profiler;
+    }
+    return connection;
+}
+
+void DatabaseManager::ReleaseReadConnection(ReadConnection* connection)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_readPoolMutex);
+        m_idleReadConnections.push_back(connection);
+    }
+    // Both the threads waiting for a reader and a close waiting for all of them
+    m_readConnectionAvailable.notify_all();
+}
+
+void DatabaseManager::CloseReadConnections()
+{
+    std::unique_lock<std::mutex> lock(m_readPoolMutex);
+
+    // New reads go to the writer connection from here on; the ones still running finish
+    // on their reader first
+    m_readPoolOpen = false;
+    m_readConnectionAvailable.notify_all();
+    m_readConnectionAvailable.wait(lock, [this]() { return m_idleReadConnections.size() == m_readConnections.size(); });
+
+    for (auto& connection : m_readConnections)
+    {
+        connection->statementCache.Clear();
+        sqlite3_close(connection->database);
+    }
+
+    m_readConnections.clear();
+    m_idleReadConnections.clear();
+}
+
+void DatabaseManager::AcquireWriter()
+{
+    m_mutex.lock();
+    if (m_writerDepth++ == 0)
+    {
+        m_writerOwner = std::this_thread::get_id();
+    }
+}
+
+void DatabaseManager::ReleaseWriter()
+{
+    if (--m_writerDepth == 0)
+    {
+        m_writerOwner = std::thread::id();
+    }
+    m_mutex.unlock();
+}
+
+bool DatabaseManager::BeginTransaction()
+{
+    // Released again by the matching Commit/Rollback
+    AcquireWriter();
+
+    bool success = m_transactionDepth == 0
+        ? ExecuteSQL("BEGIN TRANSACTION;")
+        : ExecuteSQL("SAVEPOINT sp_" + std::to_string(m_transactionDepth) + ";");
+
+    if (success)
+    {
+        ++m_transactionDepth;
         return true;
     }
 
+    ReleaseWriter();
     return false;
 }
 
 bool DatabaseManager::CommitTransaction()
 {
-    if (!m_inTransaction)
+    WriterScope writer(*this);
+
+    if (m_transactionDepth == 0)
     {
         Logger::Warning("No transaction in progress");
         return false;
     }
 
-    bool success = ExecuteSQL("COMMIT;");
-    m_inTransaction = false;
+    --m_transactionDepth;
+    bool success = m_transactionDepth == 0
+        ? ExecuteSQL("COMMIT;")
+        : ExecuteSQL("RELEASE sp_" + std::to_string(m_transactionDepth) + ";");
+
+    // A COMMIT that fails without SQLite rolling back (SQLITE_BUSY, for one) leaves the
+    // transaction open; roll it back so the connection matches the depth, or the next
+    // BEGIN would fail and every later write would join a transaction that never commits
+    if (!success && m_transactionDepth == 0 && m_database && !sqlite3_get_autocommit(m_database))
+    {
+        const std::string commitError = m_lastError;
+        ExecuteSQL("ROLLBACK;");
+        m_lastError = commitError;
+    }
+
+    ReleaseWriter();
     return success;
 }
 
 bool DatabaseManager::RollbackTransaction()
 {
-    if (!m_inTransaction)
+    WriterScope writer(*this);
+
+    if (m_transactionDepth == 0)
     {
         Logger::Warning("No transaction in progress");
         return false;
     }
 
-    bool success = ExecuteSQL("ROLLBACK;");
-    m_inTransaction = false;
+    --m_transactionDepth;
+    bool success = false;
+    if (m_transactionDepth == 0)
+    {
+        success = ExecuteSQL("ROLLBACK;");
+    }
+    else
+    {
+        const std::string savepoint = "sp_" + std::to_string(m_transactionDepth);
+        success = ExecuteSQL("ROLLBACK TO " + savepoint + "; RELEASE " + savepoint + ";");
+    }
+
+    ReleaseWriter();
     return success;
 }
 
 std::string DatabaseManager::GetLastError() const
 {
+    // Written under the writer lock, possibly by the persistence worker's thread
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     return m_lastError;
 }
 
@@ -279,6 +664,27 @@ bool DatabaseManager::TableExists(const std::string& tableName)
     return exists;
 }
 
+bool DatabaseManager::ColumnExists(const std::string& tableName, const std::string& columnName)
+{
+    if (!m_database)
+        return false;
+
+    bool exists = false;
+    ExecuteQuery(
+        "SELECT 1 FROM pragma_table_info(?) WHERE name = ?;",
+        [&tableName, &columnName](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, tableName.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 2, columnName.c_str(), -1, SQLITE_STATIC);
+        },
+        [&exists](sqlite3_stmt*) {
+            exists = true;
+            return false; // Stop after first result
+        }
+    );
+
+    return exists;
+}
+
 bool DatabaseManager::CreateVersionTable()
 {
     const std::string sql = R"(
@@ -296,6 +702,19 @@ bool DatabaseManager::CreateVersionTable()
 
     // Insert initial version if table is empty
     ExecuteSQL("INSERT OR IGNORE INTO schema_version (id, version) VALUES (1, 1);");
+
+    const std::string moduleSql = R"(
+        CREATE TABLE IF NOT EXISTS schema_module_version (
+            module TEXT PRIMARY KEY,
+            version INTEGER NOT NULL,
+            updated_at DATETIME DEFAULT CURRENT_TIMESTAMP
+        );
+    )";
+
+    if (!ExecuteSQL(moduleSql))
+    {
+        return false;
+    }
     
     return true;
 }
@@ -323,6 +742,33 @@ bool DatabaseManager::SetSchemaVersion(int version)
     );
 }
 
+int DatabaseManager::GetSchemaVersion(const std::string& module)
+{
+    int version = -1;
+    ExecuteQuery(
+        "SELECT version FROM schema_module_version WHERE module = ?;",
+        [&module](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, module.c_str(), -1, SQLITE_STATIC);
+        },
+        [&version](sqlite3_stmt* stmt) {
+            version = sqlite3_column_int(stmt, 0);
+            return false; // Stop after first result
+        }
+    );
+    return version >= 0 ? version : GetSchemaVersion();
+}
+
+bool DatabaseManager::SetSchemaVersion(const std::string& module, int version)
+{
+    return ExecuteSQL(
+        "INSERT OR REPLACE INTO schema_module_version (module, version, updated_at) VALUES (?, ?, CURRENT_TIMESTAMP);",
+        [&module, version](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, module.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int(stmt, 2, version);
+        }
+    );
+}
+
 std::string DatabaseManager::GetSQLiteErrorMessage() const
 {
     if (!m_database)
@@ -1,13 +1,42 @@
 #pragma once
 
+#include "StatementCache.h"
+#include "QueryProfiler.h"
+#include "SchemaBackfill.h"
+
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 // Forward declare SQLite types
 struct sqlite3;
 struct sqlite3_stmt;
 
+// Connection-level SQLite settings. Initialize() and ApplyTuning() apply them to the
+// writer; each reader takes them (minus the write-only ones) when next acquired.
+struct DatabaseTuning
+{
+    std::string synchronous = "NORMAL";  // OFF, NORMAL, FULL, EXTRA
+    int cacheSizeKiB = 16384;            // Page cache per connection
+    int64_t mmapSizeBytes = 64ll << 20;  // 0 disables memory-mapped I/O
+    std::string tempStore = "MEMORY";    // DEFAULT, FILE, MEMORY
+    int walAutoCheckpointPages = 1000;   // 0 disables automatic checkpoints
+    int pageSizeBytes = 4096;            // Only takes effect on a new database
+    int busyTimeoutMs = 5000;
+
+    // Presets, selectable with the "database.profile" config key
+    static DatabaseTuning Durable();   // fsync on every commit, SQLite's default caches
+    static DatabaseTuning Balanced();  // WAL + synchronous=NORMAL: durable up to the last commits on power loss
+    static DatabaseTuning Fast();      // No fsync; an OS crash can lose or corrupt recent data
+    static bool FromProfile(const std::string& name, DatabaseTuning& tuning);
+};
+
 class DatabaseManager
 {
 public:
@@ -19,6 +48,11 @@ public:
     void Shutdown();
     bool IsConnected() const { return m_database != nullptr; }
 
+    // Tuning - set before Initialize(), or apply to an open connection
+    void SetTuning(const DatabaseTuning& tuning) { m_tuning = tuning; }
+    const DatabaseTuning& GetTuning() const { return m_tuning; }
+    bool ApplyTuning(const DatabaseTuning& tuning);
+
     // Database operations
     bool ExecuteSQL(const std::string& sql);
     bool ExecuteSQL(const std::string& sql, const std::function<void(sqlite3_stmt*)>& bindCallback);
@@ -29,10 +63,30 @@ public:
                      const std::function<void(sqlite3_stmt*)>& bindCallback,
                      const std::function<bool(sqlite3_stmt*)>& resultCallback);
 
-    // Transaction support
+    // Read-only connections next to the writer. WAL lets them run on any thread while
+    // the writer commits; each has its own statement cache.
+    bool OpenReadConnections(size_t count);
+    size_t GetReadConnectionCount() const;
+
+    // Queries for analytical reads. They run on a pooled reader (blocking until one is
+    // free) and fall back to the writer when the pool is empty or the calling thread is
+    // already using the writer - inside a transaction reads must see its own writes.
+    // Nested read queries reuse the reader the thread already holds.
+    bool ExecuteReadQuery(const std::string& sql, const std::function<bool(sqlite3_stmt*)>& resultCallback);
+    bool ExecuteReadQuery(const std::string& sql,
+                          const std::function<void(sqlite3_stmt*)>& bindCallback,
+                          const std::function<bool(sqlite3_stmt*)>& resultCallback);
+
+    // Transaction support. A transaction keeps the connection locked to the calling
+    // thread until it ends; nested calls become savepoints inside the outer transaction.
     bool BeginTransaction();
     bool CommitTransaction();
     bool RollbackTransaction();
+    bool IsInTransaction() const { return m_transactionDepth > 0; }
+
+    // Exclusive use of the connection for statement sequences that must not interleave
+    // with other threads (e.g. an INSERT followed by GetLastInsertRowID)
+    std::unique_lock<std::recursive_mutex> Lock() { return std::unique_lock<std::recursive_mutex>(m_mutex); }
 
     // Utility methods
     std::string GetLastError() const;
@@ -42,11 +96,31 @@ public:
     // Database info
     std::string GetDatabasePath() const { return m_databasePath; }
     bool TableExists(const std::string& tableName);
+    bool ColumnExists(const std::string& tableName, const std::string& columnName);
     
-    // Schema versioning
+    // Schema versioning. Modules version their tables independently; a module without
+    // its own entry is still at the shared version.
     bool CreateVersionTable();
     int GetSchemaVersion();
     bool SetSchemaVersion(int version);
+    int GetSchemaVersion(const std::string& module);
+    bool SetSchemaVersion(const std::string& module, int version);
+
+    // Row conversions left over from schema upgrades, run in batches after startup
+    SchemaBackfill& GetSchemaBackfill() { return *m_schemaBackfill; }
+
+    // Prepared statement cache used by the ExecuteSQL/ExecuteQuery overloads taking
+    // callbacks. The plain ExecuteSQL(sql) overload runs scripts and bypasses it.
+    StatementCache::Stats GetStatementCacheStats() const { return m_statementCache.GetStats(); }
+    void SetStatementCacheCapacity(size_t capacity) { m_statementCache.SetCapacity(capacity); }
+
+    // Query profiling through sqlite3_trace_v2. Covers the writer and every reader,
+    // including ones opened later; enable it before other threads start querying.
+    // Disabling keeps the collected numbers so they can still be read or dumped.
+    void EnableProfiling(bool enable, double slowQueryMs = 50.0);
+    bool IsProfilingEnabled() const { return m_profilingEnabled; }
+    QueryProfiler* GetProfiler() const { return m_profiler.get(); }
+    bool DumpQueryProfile(const std::string& filePath) const;
 
 protected:
     // Internal helpers
@@ -55,10 +129,55 @@ protected:
     std::string GetSQLiteErrorMessage() const;
 
 private:
+    struct ReadConnection
+    {
+        sqlite3* database = nullptr;
+        StatementCache statementCache;
+        unsigned tuningGeneration = 0; // m_readTuningGeneration when last tuned
+        QueryProfiler* tracedBy = nullptr;
+    };
+
+    // Writer ownership - lets reads issued while a thread uses the writer stay on it
+    class WriterScope;
+    void AcquireWriter();
+    void ReleaseWriter();
+    bool IsWriterHeldByThisThread() const { return m_writerOwner.load() == std::this_thread::get_id(); }
+
+    ReadConnection* AcquireReadConnection();
+    void ReleaseReadConnection(ReadConnection* connection);
+    void CloseReadConnections();
+    static bool ApplyReadTuning(sqlite3* database, const DatabaseTuning& tuning);
+    bool RunQuery(StatementCache& cache, sqlite3* database, const std::string& sql,
+                  const std::function<void(sqlite3_stmt*)>& bindCallback,
+                  const std::function<bool(sqlite3_stmt*)>& resultCallback);
+    void RecordLease(const StatementCache::Lease& lease, const std::string& sql);
+
     sqlite3* m_database;
     std::string m_databasePath;
     std::string m_lastError;
-    bool m_inTransaction;
+    int m_transactionDepth;
+    DatabaseTuning m_tuning;
+    StatementCache m_statementCache;
+    std::unique_ptr<QueryProfiler> m_profiler;
+    std::unique_ptr<SchemaBackfill> m_schemaBackfill;
+    std::atomic<bool> m_profilingEnabled{ false };
+    mutable std::recursive_mutex m_mutex; // The writer lock; also guards m_lastError
+    std::atomic<std::thread::id> m_writerOwner;
+    int m_writerDepth = 0;
+
+    // Read pool
+    std::vector<std::unique_ptr<ReadConnection>> m_readConnections;
+    std::vector<ReadConnection*> m_idleReadConnections;
+    mutable std::mutex m_readPoolMutex;
+    std::condition_variable m_readConnectionAvailable;
+    std::atomic<bool> m_readPoolOpen{ false }; // Set and cleared under m_readPoolMutex
+    DatabaseTuning m_readTuning;               // Settings for the readers, under m_readPoolMutex
+    unsigned m_readTuningGeneration = 1;       // Bumped by every ApplyTuning
+    QueryProfiler* m_readProfiler = nullptr;   // Tracing the readers, under m_readPoolMutex
+
+    // Reader held by the current thread, for nested read queries
+    static thread_local ReadConnection* s_activeReader;
+    static thread_local const DatabaseManager* s_activeReaderOwner;
 
     // Non-copyable
     DatabaseManager(const DatabaseManager&) = delete;
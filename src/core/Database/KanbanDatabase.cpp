@@ -1,6 +1,13 @@
 #include "KanbanDatabase.h"
+#include "core/Kanban/LexoRank.h"
+#include "core/IdGenerator.h"
 #include "core/Logger.h"
+#include "core/Utils.h"
+#include "platform/Platform.h"
 #include "sqlite3.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
@@ -22,7 +29,7 @@ bool KanbanDatabase::Initialize() {
   }
 
   // Handle schema migrations
-  int currentVersion = m_dbManager->GetSchemaVersion();
+  int currentVersion = m_dbManager->GetSchemaVersion("kanban");
   if (currentVersion < CURRENT_SCHEMA_VERSION) {
     Logger::Info("KanbanDatabase: Migrating schema from version {} to {}",
                  currentVersion, CURRENT_SCHEMA_VERSION);
@@ -32,7 +39,25 @@ bool KanbanDatabase::Initialize() {
       return false;
     }
 
-    m_dbManager->SetSchemaVersion(CURRENT_SCHEMA_VERSION);
+    m_dbManager->SetSchemaVersion("kanban", CURRENT_SCHEMA_VERSION);
+  }
+
+  // Cards still carrying v1 text timestamps are converted after startup. Registering
+  // the job again on every start picks up its saved progress.
+  SchemaBackfill::Job cards;
+  cards.name = CARDS_BACKFILL_JOB;
+  cards.table = "kanban_cards";
+  cards.assignments = R"(
+        created_ms = COALESCE(created_ms, unixepoch(created_at) * 1000),
+        modified_ms = COALESCE(modified_ms, unixepoch(modified_at) * 1000),
+        due_day = COALESCE(due_day, CASE WHEN due_date GLOB '[0-9][0-9][0-9][0-9]-[0-9][0-9]-[0-9][0-9]*'
+                                         THEN CAST(julianday(substr(due_date, 1, 10)) - 2440587.5 AS INTEGER) END))";
+  cards.onComplete = {
+      "CREATE INDEX IF NOT EXISTS idx_kanban_cards_status_due_day ON kanban_cards(status, due_day);",
+      "DROP INDEX IF EXISTS idx_kanban_cards_due_date;" };
+
+  if (!m_dbManager->GetSchemaBackfill().AddJob(cards)) {
+    Logger::Warning("KanbanDatabase: card timestamp backfill not scheduled");
   }
 
   Logger::Info("KanbanDatabase initialized successfully");
@@ -48,26 +73,350 @@ bool KanbanDatabase::CreateTables() {
   success &= CreateTagsTable();
   success &= CreateCardsTagsNormalizationTable();
   success &= CreateKanbanSettingTable();
+  success &= CreateJournalTable();
   success &= CreateIndexes();
   return success;
 }
 
 bool KanbanDatabase::MigrateSchema(int fromVersion, int toVersion) {
-  return false;
+  for (int version = fromVersion; version < toVersion; ++version) {
+    bool success = true;
+    switch (version) {
+    case 0:
+      success = MigrateToVersion1();
+      break;
+    case 1:
+      success = MigrateToVersion2();
+      break;
+    case 2:
+      success = MigrateToVersion3();
+      break;
+    case 3:
+      success = MigrateToVersion4();
+      break;
+    case 4:
+      success = MigrateToVersion5();
+      break;
+    case 5:
+      success = MigrateToVersion6();
+      break;
+    case 6:
+      success = MigrateToVersion7();
+      break;
+    default:
+      Logger::Warning("KanbanDatabase: Unknown migration version {}", version + 1);
+      break;
+    }
+
+    if (!success) {
+      Logger::Error("KanbanDatabase: Migration to version {} failed", version + 1);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool KanbanDatabase::MigrateToVersion1() { return true; } // Tables are created at version 1
+
+bool KanbanDatabase::MigrateToVersion2()
+{
+    // Version 2 stores timestamps as epoch milliseconds and due dates as day numbers
+    // next to the v1 text columns. Adding the columns does not touch any row; projects
+    // and boards are few enough to convert here, while cards - the only table that
+    // grows large - are left to the backfill job scheduled in Initialize().
+    const std::pair<const char*, const char*> columns[] = {
+        { "kanban_projects", "created_ms" }, { "kanban_projects", "modified_ms" },
+        { "kanban_boards", "created_ms" },   { "kanban_boards", "modified_ms" },
+        { "kanban_cards", "due_day" },       { "kanban_cards", "created_ms" },
+        { "kanban_cards", "modified_ms" },
+    };
+
+    if (!m_dbManager->BeginTransaction())
+    {
+        return false;
+    }
+
+    bool success = true;
+    for (const auto& [table, column] : columns)
+    {
+        if (success && !m_dbManager->ColumnExists(table, column))
+        {
+            success = m_dbManager->ExecuteSQL(std::string("ALTER TABLE ") + table + " ADD COLUMN " + column + " INTEGER;");
+        }
+    }
+
+    success = success && m_dbManager->ExecuteSQL(R"(
+        UPDATE kanban_projects SET created_ms = COALESCE(created_ms, unixepoch(created_at) * 1000),
+                                   modified_ms = COALESCE(modified_ms, unixepoch(modified_at) * 1000);
+        UPDATE kanban_boards SET created_ms = COALESCE(created_ms, unixepoch(created_at) * 1000),
+                                 modified_ms = COALESCE(modified_ms, unixepoch(modified_at) * 1000);
+    )");
+
+    if (!success)
+    {
+        m_dbManager->RollbackTransaction();
+        return false;
+    }
+    return m_dbManager->CommitTransaction();
+}
+
+bool KanbanDatabase::MigrateToVersion3()
+{
+    // Version 3 orders columns and cards by LexoRank keys instead of integer positions.
+    // Existing rows keep their order (ties by insertion) as zero-padded decimal keys -
+    // decimal digits are valid rank digits - and trailing zeros are trimmed so every
+    // key leaves room before it. One statement per table; no per-row round trips.
+    if (!m_dbManager->BeginTransaction())
+    {
+        return false;
+    }
+
+    bool success = true;
+    if (!m_dbManager->ColumnExists("kanban_columns", "column_rank"))
+    {
+        success = m_dbManager->ExecuteSQL("ALTER TABLE kanban_columns ADD COLUMN column_rank TEXT;");
+    }
+    if (success && !m_dbManager->ColumnExists("kanban_cards", "card_rank"))
+    {
+        success = m_dbManager->ExecuteSQL("ALTER TABLE kanban_cards ADD COLUMN card_rank TEXT;");
+    }
+
+    success = success && m_dbManager->ExecuteSQL(R"(
+        UPDATE kanban_columns SET column_rank = ranked.rank
+        FROM (SELECT rowid AS row_id,
+                     rtrim(printf('%09d', ROW_NUMBER() OVER (PARTITION BY board_id ORDER BY column_order, rowid)), '0') AS rank
+              FROM kanban_columns) AS ranked
+        WHERE kanban_columns.rowid = ranked.row_id AND kanban_columns.column_rank IS NULL;
+        UPDATE kanban_cards SET card_rank = ranked.rank
+        FROM (SELECT rowid AS row_id,
+                     rtrim(printf('%09d', ROW_NUMBER() OVER (PARTITION BY column_id ORDER BY card_order, rowid)), '0') AS rank
+              FROM kanban_cards) AS ranked
+        WHERE kanban_cards.rowid = ranked.row_id AND kanban_cards.card_rank IS NULL;
+        CREATE INDEX IF NOT EXISTS idx_kanban_cards_column_rank ON kanban_cards(column_id, card_rank);
+        DROP INDEX IF EXISTS idx_kanban_cards_column_order;
+    )");
+
+    if (!success)
+    {
+        m_dbManager->RollbackTransaction();
+        return false;
+    }
+    return m_dbManager->CommitTransaction();
+}
+
+bool KanbanDatabase::MigrateToVersion4()
+{
+    // Version 4 keys projects, boards, columns and cards by 64-bit integers (rowid tables)
+    // instead of generated strings. Each table is rebuilt once: migrated rows take their
+    // old rowid as id - far below any IdGenerator id, and the rowids the card backfill
+    // has recorded stay valid - and keep the string id in legacy_id. Parent references
+    // are mapped through the old string keys; rows whose parent is gone are dropped.
+    const char* legacyIndexes = R"(
+        CREATE UNIQUE INDEX IF NOT EXISTS idx_kanban_projects_legacy_id ON kanban_projects(legacy_id) WHERE legacy_id IS NOT NULL;
+        CREATE UNIQUE INDEX IF NOT EXISTS idx_kanban_boards_legacy_id ON kanban_boards(legacy_id) WHERE legacy_id IS NOT NULL;
+        CREATE UNIQUE INDEX IF NOT EXISTS idx_kanban_columns_legacy_id ON kanban_columns(legacy_id) WHERE legacy_id IS NOT NULL;
+        CREATE UNIQUE INDEX IF NOT EXISTS idx_kanban_cards_legacy_id ON kanban_cards(legacy_id) WHERE legacy_id IS NOT NULL;
+    )";
+
+    if (m_dbManager->ColumnExists("kanban_cards", "legacy_id"))
+    {
+        return m_dbManager->ExecuteSQL(legacyIndexes); // Created at version 4
+    }
+
+    const char* tables[] = { "kanban_projects", "kanban_boards", "kanban_columns", "kanban_cards", "kanban_card_tags" };
+
+    // The tables are recreated under their own names, which drops their indexes with
+    // them - whichever of those exist now are created again afterwards
+    std::vector<std::string> indexes;
+    m_dbManager->ExecuteQuery(R"(
+        SELECT sql FROM sqlite_master
+        WHERE type = 'index' AND sql IS NOT NULL AND tbl_name IN
+              ('kanban_projects', 'kanban_boards', 'kanban_columns', 'kanban_cards', 'kanban_card_tags')
+    )", [&indexes](sqlite3_stmt* stmt) -> bool {
+        indexes.emplace_back((const char*)sqlite3_column_text(stmt, 0));
+        return true;
+    });
+
+    // Foreign keys can only be switched off outside a transaction
+    if (!m_dbManager->ExecuteSQL("PRAGMA foreign_keys = OFF;"))
+    {
+        return false;
+    }
+    if (!m_dbManager->BeginTransaction())
+    {
+        m_dbManager->ExecuteSQL("PRAGMA foreign_keys = ON;");
+        return false;
+    }
+
+    bool success = true;
+    for (const char* table : tables)
+    {
+        success = success && m_dbManager->ExecuteSQL(std::string("ALTER TABLE ") + table + " RENAME TO " + table + "_v3;");
+    }
+
+    success = success && CreateProjectsTable() && CreateBoardsTable() && CreateColumnsTable() &&
+              CreateCardsTable() && CreateCardsTagsNormalizationTable();
+
+    success = success && m_dbManager->ExecuteSQL(R"(
+        INSERT INTO kanban_projects (id, legacy_id, name, description, is_active, created_at, modified_at,
+                                     created_ms, modified_ms)
+        SELECT rowid, id, name, description, is_active, created_at, modified_at, created_ms, modified_ms
+        FROM kanban_projects_v3;
+
+        INSERT INTO kanban_boards (id, legacy_id, project_id, name, description, is_active, created_at,
+                                   modified_at, created_ms, modified_ms)
+        SELECT b.rowid, b.id, p.rowid, b.name, b.description, b.is_active, b.created_at, b.modified_at,
+               b.created_ms, b.modified_ms
+        FROM kanban_boards_v3 b JOIN kanban_projects_v3 p ON p.id = b.project_id;
+
+        INSERT INTO kanban_columns (id, legacy_id, board_id, name, header_color_r, header_color_g, header_color_b,
+                                    header_color_a, card_limit, is_collapsed, column_order, column_rank)
+        SELECT col.rowid, col.id, b.rowid, col.name, col.header_color_r, col.header_color_g, col.header_color_b,
+               col.header_color_a, col.card_limit, col.is_collapsed, col.column_order, col.column_rank
+        FROM kanban_columns_v3 col JOIN kanban_boards_v3 b ON b.id = col.board_id
+        WHERE b.rowid IN (SELECT id FROM kanban_boards);
+
+        INSERT INTO kanban_cards (id, legacy_id, column_id, title, description, priority, status, color_r, color_g,
+                                  color_b, color_a, assignee, due_date, card_order, created_at, modified_at, due_day,
+                                  created_ms, modified_ms, card_rank)
+        SELECT c.rowid, c.id, col.rowid, c.title, c.description, c.priority, c.status, c.color_r, c.color_g,
+               c.color_b, c.color_a, c.assignee, c.due_date, c.card_order, c.created_at, c.modified_at, c.due_day,
+               c.created_ms, c.modified_ms, c.card_rank
+        FROM kanban_cards_v3 c JOIN kanban_columns_v3 col ON col.id = c.column_id
+        WHERE col.rowid IN (SELECT id FROM kanban_columns);
+
+        INSERT INTO kanban_card_tags (card_id, tag_id)
+        SELECT c.rowid, ct.tag_id
+        FROM kanban_card_tags_v3 ct JOIN kanban_cards_v3 c ON c.id = ct.card_id
+        WHERE c.rowid IN (SELECT id FROM kanban_cards);
+    )");
+
+    for (auto table = std::rbegin(tables); success && table != std::rend(tables); ++table)
+    {
+        success = m_dbManager->ExecuteSQL(std::string("DROP TABLE ") + *table + "_v3;");
+    }
+    for (const auto& index : indexes)
+    {
+        success = success && m_dbManager->ExecuteSQL(index + ";");
+    }
+    success = success && m_dbManager->ExecuteSQL(legacyIndexes);
+
+    // Every reference was mapped by the joins above; check before committing
+    bool violations = false;
+    for (const char* table : tables)
+    {
+        success = success && m_dbManager->ExecuteQuery(std::string("PRAGMA foreign_key_check(") + table + ");",
+            [&violations](sqlite3_stmt*) -> bool {
+                violations = true;
+                return false;
+            });
+    }
+    success = success && !violations;
+
+    if (success)
+    {
+        success = m_dbManager->CommitTransaction();
+    }
+    else
+    {
+        m_dbManager->RollbackTransaction();
+    }
+
+    m_dbManager->ExecuteSQL("PRAGMA foreign_keys = ON;");
+    return success;
+}
+
+bool KanbanDatabase::MigrateToVersion5()
+{
+    // Version 5 adds the card search index. It is keyed by the integer card ids of
+    // version 4, so it is created here rather than with the other tables, and filled
+    // from the existing cards in one statement.
+    if (!m_dbManager->BeginTransaction())
+    {
+        return false;
+    }
+
+    bool success = CreateCardSearchTable() && m_dbManager->ExecuteSQL(R"(
+        DELETE FROM kanban_cards_fts;
+        INSERT INTO kanban_cards_fts (docid, title, description, assignee, tags)
+        SELECT c.id, c.title, c.description, c.assignee,
+               (SELECT group_concat(t.name, ' ') FROM kanban_card_tags ct
+                JOIN kanban_tags t ON t.id = ct.tag_id WHERE ct.card_id = c.id)
+        FROM kanban_cards c;
+        INSERT INTO kanban_cards_fts (kanban_cards_fts) VALUES ('optimize');
+    )");
+
+    if (!success)
+    {
+        m_dbManager->RollbackTransaction();
+        return false;
+    }
+    return m_dbManager->CommitTransaction();
+}
+
+bool KanbanDatabase::MigrateToVersion6()
+{
+    // Version 6 indexes the tags already linked when a card is inserted, and the tag
+    // triggers skip cards that do not exist (yet, or any more). CreateCards links tags
+    // first, so a bulk insert never rewrites a search row.
+    return m_dbManager->ExecuteSQL(R"(
+        DROP TRIGGER IF EXISTS kanban_cards_fts_insert;
+        DROP TRIGGER IF EXISTS kanban_card_tags_fts_insert;
+        DROP TRIGGER IF EXISTS kanban_card_tags_fts_delete;
+    )") && CreateCardSearchTable();
 }
 
-bool KanbanDatabase::MigrateToVersion1() { return false; }
+bool KanbanDatabase::MigrateToVersion7()
+{
+    // Version 7 adds the card archive. Its foreign key names kanban_columns, so it is
+    // created after version 4 has rebuilt that table: a rename rewrites the references
+    // of every other table, and the archive would point at the dropped kanban_columns_v3.
+    // An archive created that way by an earlier build could never be written to, so it
+    // is empty and simply replaced.
+    bool stale = false;
+    m_dbManager->ExecuteQuery(R"(
+        SELECT 1 FROM pragma_foreign_key_list('kanban_cards_archive') WHERE "table" <> 'kanban_columns'
+    )", [&stale](sqlite3_stmt*) -> bool {
+        stale = true;
+        return false;
+    });
+
+    if (!m_dbManager->BeginTransaction())
+    {
+        return false;
+    }
+
+    bool success = (!stale || m_dbManager->ExecuteSQL("DROP TABLE kanban_cards_archive;")) && CreateArchiveTable();
+
+    bool violations = false;
+    success = success && m_dbManager->ExecuteQuery("PRAGMA foreign_key_check(kanban_cards_archive);",
+        [&violations](sqlite3_stmt*) -> bool {
+            violations = true;
+            return false;
+        });
+    success = success && !violations;
+
+    if (!success)
+    {
+        m_dbManager->RollbackTransaction();
+        return false;
+    }
+    return m_dbManager->CommitTransaction();
+}
 
 bool KanbanDatabase::CreateProjectsTable() 
 { 
     const std::string sql = R"(
         CREATE TABLE IF NOT EXISTS kanban_projects (
-            id TEXT PRIMARY KEY,
+            id INTEGER PRIMARY KEY, -- IdGenerator id; the old rowid for rows migrated from v3
+            legacy_id TEXT,         -- v3 string id of a migrated row
             name TEXT NOT NULL,
             description TEXT,
             is_active INTEGER DEFAULT 1,
-            created_at DATETIME DEFAULT CURRENT_TIMESTAMP,
-            modified_at DATETIME DEFAULT CURRENT_TIMESTAMP
+            created_at DATETIME DEFAULT CURRENT_TIMESTAMP, -- v1, superseded by created_ms
+            modified_at DATETIME DEFAULT CURRENT_TIMESTAMP, -- v1, superseded by modified_ms
+            created_ms INTEGER, -- Epoch milliseconds
+            modified_ms INTEGER
         );
   )";
 
@@ -78,13 +427,16 @@ bool KanbanDatabase::CreateBoardsTable()
 { 
     const std::string sql = R"(
         CREATE TABLE IF NOT EXISTS kanban_boards (
-            id TEXT PRIMARY KEY,
-            project_id TEXT NOT NULL,
+            id INTEGER PRIMARY KEY,
+            legacy_id TEXT,
+            project_id INTEGER NOT NULL,
             name TEXT NOT NULL,
             description TEXT,
             is_active INTEGER DEFAULT 1,
-            created_at DATETIME DEFAULT CURRENT_TIMESTAMP,
-            modified_at DATETIME DEFAULT CURRENT_TIMESTAMP,
+            created_at DATETIME DEFAULT CURRENT_TIMESTAMP, -- v1, superseded by created_ms
+            modified_at DATETIME DEFAULT CURRENT_TIMESTAMP, -- v1, superseded by modified_ms
+            created_ms INTEGER, -- Epoch milliseconds
+            modified_ms INTEGER,
             FOREIGN KEY (project_id) REFERENCES kanban_projects(id) ON DELETE CASCADE
         );
   )";
@@ -96,8 +448,9 @@ bool KanbanDatabase::CreateColumnsTable()
 { 
     const std::string sql = R"(
         CREATE TABLE IF NOT EXISTS kanban_columns (
-            id TEXT PRIMARY KEY,
-            board_id TEXT NOT NULL,
+            id INTEGER PRIMARY KEY,
+            legacy_id TEXT,
+            board_id INTEGER NOT NULL,
             name TEXT NOT NULL,
             header_color_r REAL DEFAULT 0.3,
             header_color_g REAL DEFAULT 0.5,
@@ -105,7 +458,8 @@ bool KanbanDatabase::CreateColumnsTable()
             header_color_a REAL DEFAULT 1.0,
             card_limit INTEGER DEFAULT -1,
             is_collapsed INTEGER DEFAULT 0,
-            column_order INTEGER DEFAULT 0,
+            column_order INTEGER DEFAULT 0, -- v2, superseded by column_rank
+            column_rank TEXT,               -- LexoRank key, ordered as text
             FOREIGN KEY (board_id) REFERENCES kanban_boards(id) ON DELETE CASCADE
         );
   )";
@@ -117,8 +471,9 @@ bool KanbanDatabase::CreateCardsTable()
 { 
     const std::string sql = R"(
         CREATE TABLE IF NOT EXISTS kanban_cards (
-            id TEXT PRIMARY KEY,
-            column_id TEXT NOT NULL,
+            id INTEGER PRIMARY KEY,
+            legacy_id TEXT,
+            column_id INTEGER NOT NULL,
             title TEXT NOT NULL,
             description TEXT,
             priority INTEGER DEFAULT 1, -- 0=Low, 1=Medium, 2=High, 3=Urgent
@@ -128,10 +483,14 @@ bool KanbanDatabase::CreateCardsTable()
             color_b REAL DEFAULT 0.7,
             color_a REAL DEFAULT 1.0,
             assignee TEXT,
-            due_date DATETIME,
-            card_order INTEGER DEFAULT 0,
-            created_at DATETIME DEFAULT CURRENT_TIMESTAMP,
-            modified_at DATETIME DEFAULT CURRENT_TIMESTAMP,
+            due_date DATETIME,          -- As entered
+            card_order INTEGER DEFAULT 0, -- v2, superseded by card_rank
+            created_at DATETIME DEFAULT CURRENT_TIMESTAMP, -- v1, superseded by created_ms
+            modified_at DATETIME DEFAULT CURRENT_TIMESTAMP, -- v1, superseded by modified_ms
+            due_day INTEGER,            -- Days since 1970-01-01, NULL unless due_date is a date
+            created_ms INTEGER,         -- Epoch milliseconds
+            modified_ms INTEGER,
+            card_rank TEXT,             -- LexoRank key, ordered as text
             FOREIGN KEY (column_id) REFERENCES kanban_columns(id) ON DELETE CASCADE
         );
   )";
@@ -155,7 +514,7 @@ bool KanbanDatabase::CreateCardsTagsNormalizationTable()
 { 
     const std::string sql = R"(
         CREATE TABLE IF NOT EXISTS kanban_card_tags (
-            card_id TEXT,
+            card_id INTEGER,
             tag_id INTEGER,
             PRIMARY KEY (card_id, tag_id),
             FOREIGN KEY (card_id) REFERENCES kanban_cards(id) ON DELETE CASCADE,
@@ -179,45 +538,191 @@ bool KanbanDatabase::CreateKanbanSettingTable()
   return m_dbManager->ExecuteSQL(sql);
 }
 
+bool KanbanDatabase::CreateJournalTable()
+{
+    // Undo history written next to the changes it describes. Ids are plain integers
+    // without foreign keys: entries outlive the cards they created or deleted.
+    const std::string sql = R"(
+        CREATE TABLE IF NOT EXISTS kanban_journal (
+            sequence INTEGER PRIMARY KEY,
+            group_id INTEGER NOT NULL,
+            type INTEGER NOT NULL,
+            field INTEGER NOT NULL DEFAULT 0,
+            board_id INTEGER,
+            card_id INTEGER,
+            column_before INTEGER,
+            column_after INTEGER,
+            before_value TEXT,
+            after_value TEXT,
+            undone INTEGER NOT NULL DEFAULT 0
+        );
+        CREATE INDEX IF NOT EXISTS idx_kanban_journal_group ON kanban_journal(group_id);
+    )";
+
+    return m_dbManager->ExecuteSQL(sql);
+}
+
+bool KanbanDatabase::CreateArchiveTable()
+{
+    // Cold storage for old completed cards: the card row as in kanban_cards plus its board,
+    // for paging one board without a join, and its tag names joined by char(31). Goes with
+    // its column like a live card.
+    const std::string sql = R"(
+        CREATE TABLE IF NOT EXISTS kanban_cards_archive (
+            id INTEGER PRIMARY KEY,     -- The card id, kept for a restore
+            column_id INTEGER NOT NULL,
+            board_id INTEGER NOT NULL,
+            title TEXT NOT NULL,
+            description TEXT,
+            priority INTEGER,
+            status INTEGER,
+            color_r REAL,
+            color_g REAL,
+            color_b REAL,
+            color_a REAL,
+            assignee TEXT,
+            due_date TEXT,
+            due_day INTEGER,
+            created_ms INTEGER,
+            modified_ms INTEGER,
+            card_rank TEXT,
+            tags TEXT,
+            archived_ms INTEGER NOT NULL,
+            FOREIGN KEY (column_id) REFERENCES kanban_columns(id) ON DELETE CASCADE
+        );
+        CREATE INDEX IF NOT EXISTS idx_kanban_cards_archive_board ON kanban_cards_archive(board_id, archived_ms);
+        CREATE INDEX IF NOT EXISTS idx_kanban_cards_archive_column ON kanban_cards_archive(column_id);
+    )";
+
+    return m_dbManager->ExecuteSQL(sql);
+}
+
+bool KanbanDatabase::CreateCardSearchTable()
+{
+    // FTS4 keeps its own copy of the searchable text (tags are not a card column), with
+    // docid = card id. Triggers follow every card and card tag change, so no caller has
+    // to maintain it. Prefix indexes make the 2 and 3 letter prefixes typed first cheap.
+    const std::string sql = R"(
+        CREATE VIRTUAL TABLE IF NOT EXISTS kanban_cards_fts USING fts4(
+            title, description, assignee, tags,
+            prefix="2,3", tokenize=unicode61 "remove_diacritics=2"
+        );
+
+        CREATE TRIGGER IF NOT EXISTS kanban_cards_fts_insert AFTER INSERT ON kanban_cards BEGIN
+            INSERT INTO kanban_cards_fts (docid, title, description, assignee, tags)
+            VALUES (new.id, new.title, new.description, new.assignee,
+                    (SELECT group_concat(t.name, ' ') FROM kanban_card_tags ct
+                     JOIN kanban_tags t ON t.id = ct.tag_id WHERE ct.card_id = new.id));
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS kanban_cards_fts_update AFTER UPDATE OF title, description, assignee ON kanban_cards
+        WHEN old.title IS NOT new.title OR old.description IS NOT new.description OR old.assignee IS NOT new.assignee
+        BEGIN
+            UPDATE kanban_cards_fts SET title = new.title, description = new.description, assignee = new.assignee
+            WHERE docid = new.id;
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS kanban_cards_fts_delete AFTER DELETE ON kanban_cards BEGIN
+            DELETE FROM kanban_cards_fts WHERE docid = old.id;
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS kanban_card_tags_fts_insert AFTER INSERT ON kanban_card_tags
+        WHEN EXISTS (SELECT 1 FROM kanban_cards WHERE id = new.card_id)
+        BEGIN
+            UPDATE kanban_cards_fts SET tags = (SELECT group_concat(t.name, ' ') FROM kanban_card_tags ct
+                                                JOIN kanban_tags t ON t.id = ct.tag_id WHERE ct.card_id = new.card_id)
+            WHERE docid = new.card_id;
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS kanban_card_tags_fts_delete AFTER DELETE ON kanban_card_tags
+        WHEN EXISTS (SELECT 1 FROM kanban_cards WHERE id = old.card_id)
+        BEGIN
+            UPDATE kanban_cards_fts SET tags = (SELECT group_concat(t.name, ' ') FROM kanban_card_tags ct
+                                                JOIN kanban_tags t ON t.id = ct.tag_id WHERE ct.card_id = old.card_id)
+            WHERE docid = old.card_id;
+        END;
+  )";
+
+  return m_dbManager->ExecuteSQL(sql);
+}
+
 bool KanbanDatabase::CreateIndexes()
 { 
     const std::string sql = R"(
         CREATE INDEX IF NOT EXISTS idx_kanban_boards_project_id ON kanban_boards(project_id);
         CREATE INDEX IF NOT EXISTS idx_kanban_columns_board_id ON kanban_columns(board_id);
-        CREATE INDEX IF NOT EXISTS idx_kanban_cards_column_id ON kanban_cards(column_id);
+        DROP INDEX IF EXISTS idx_kanban_cards_column_id; -- Prefix of idx_kanban_cards_column_rank
+        CREATE INDEX IF NOT EXISTS idx_kanban_cards_column_status ON kanban_cards(column_id, status);
         CREATE INDEX IF NOT EXISTS idx_kanban_cards_status ON kanban_cards(status);
         CREATE INDEX IF NOT EXISTS idx_kanban_cards_priority ON kanban_cards(priority);
-        CREATE INDEX IF NOT EXISTS idx_kanban_cards_due_date ON kanban_cards(due_date);
   )";
 
   return m_dbManager->ExecuteSQL(sql);
 }
 
 // Helper methods for data conversion
-std::string KanbanDatabase::TimePointToString(const std::chrono::system_clock::time_point& tp) const
+std::chrono::system_clock::time_point KanbanDatabase::ReadTimestamp(sqlite3_stmt* stmt, int column) const
+{
+    // Epoch milliseconds; NULL when a v1 text value did not parse
+    if (sqlite3_column_type(stmt, column) == SQLITE_NULL)
+    {
+        return std::chrono::system_clock::now();
+    }
+    return Utils::FromEpochMs(sqlite3_column_int64(stmt, column));
+}
+
+void KanbanDatabase::BindDueDate(sqlite3_stmt* stmt, int index, const std::string& dueDate) const
 {
-    auto time_t = std::chrono::system_clock::to_time_t(tp);
-    std::tm* tm = std::gmtime(&time_t);
-    std::ostringstream oss;
-    oss << std::put_time(tm, "%Y-%m-%d %H:%M:%S");
-    return oss.str();
+    // due_date keeps the text as entered, due_day the comparable day number when the
+    // text is a date. Binds index and index + 1.
+    int64_t dueDay = 0;
+    if (dueDate.empty())
+    {
+        sqlite3_bind_null(stmt, index);
+    }
+    else
+    {
+        sqlite3_bind_text(stmt, index, dueDate.c_str(), -1, SQLITE_STATIC);
+    }
+
+    if (Utils::ParseDayNumber(dueDate, dueDay))
+    {
+        sqlite3_bind_int64(stmt, index + 1, dueDay);
+    }
+    else
+    {
+        sqlite3_bind_null(stmt, index + 1);
+    }
 }
 
-std::chrono::system_clock::time_point KanbanDatabase::StringToTimePoint(const std::string& str) const
+bool KanbanDatabase::BindId(sqlite3_stmt* stmt, int index, const std::string& id)
 {
-    if (str.empty()) {
-        return std::chrono::system_clock::now();
+    // Entity ids are INTEGER PRIMARY KEYs, carried in memory in their base-36 text form.
+    // Text that is not one of those (a legacy string id) binds NULL and returns false;
+    // lookups then find no row, and writes have turned it away in CheckId beforehand.
+    const int64_t value = ParseId(id);
+    if (value < 0)
+    {
+        sqlite3_bind_null(stmt, index);
+        return false;
     }
-    
-    std::tm tm = {};
-    std::istringstream iss(str);
-    iss >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
-    
-    if (iss.fail()) {
-        return std::chrono::system_clock::now();
+    sqlite3_bind_int64(stmt, index, value);
+    return true;
+}
+
+std::string KanbanDatabase::ReadId(sqlite3_stmt* stmt, int column)
+{
+    if (sqlite3_column_type(stmt, column) == SQLITE_NULL)
+    {
+        return std::string();
     }
-    
-    return std::chrono::system_clock::from_time_t(std::mktime(&tm));
+    return IdGenerator::ToString(static_cast<uint64_t>(sqlite3_column_int64(stmt, column)));
+}
+
+int64_t KanbanDatabase::ParseId(const std::string& id)
+{
+    uint64_t value = 0;
+    return IdGenerator::Parse(id, value) ? static_cast<int64_t>(value) : -1;
 }
 
 void KanbanDatabase::SetError(const std::string& error)
@@ -225,48 +730,80 @@ void KanbanDatabase::SetError(const std::string& error)
     m_lastError = error;
 }
 
-int KanbanDatabase::GetNextOrder(const std::string& parentId, const std::string& orderColumn, const std::string& parentColumn)
+bool KanbanDatabase::CheckId(const std::string& id, const char* kind)
 {
-    int maxOrder = 0;
-    std::string sql = "SELECT MAX(" + orderColumn + ") FROM ";
-    
-    if (orderColumn == "column_order") {
-        sql += "kanban_columns WHERE board_id = ?";
-    } else if (orderColumn == "card_order") {
-        sql += "kanban_cards WHERE column_id = ?";
-    } else {
-        return 0;
+    // Inserting NULL would let SQLite pick the key, and an UPDATE or DELETE on NULL
+    // matches nothing yet succeeds, so a write with a bad id fails before it runs
+    if (ParseId(id) >= 0)
+    {
+        return true;
     }
+    SetError(std::string("Invalid ") + kind + " id '" + id + "'");
+    Logger::Error("KanbanDatabase: {}", m_lastError);
+    return false;
+}
 
+std::string KanbanDatabase::GetNextRank(const std::string& parentId, bool forColumn)
+{
+    // Rank after the last sibling - the (parent, rank) index answers MAX() with one seek
+    const std::string sql = forColumn
+        ? "SELECT MAX(column_rank) FROM kanban_columns WHERE board_id = ?"
+        : "SELECT MAX(card_rank) FROM kanban_cards WHERE column_id = ?";
+
+    std::string lastRank;
     m_dbManager->ExecuteQuery(sql,
         [&parentId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, parentId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, parentId);
         },
-        [&maxOrder](sqlite3_stmt* stmt) -> bool {
-            if (!sqlite3_column_type(stmt, 0) == SQLITE_NULL) {
-                maxOrder = sqlite3_column_int(stmt, 0);
+        [&lastRank](sqlite3_stmt* stmt) -> bool {
+            if (sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+                lastRank = (const char*)sqlite3_column_text(stmt, 0);
             }
             return false; // Only get first result
         });
-    
-    return maxOrder + 1;
+
+    return Kanban::LexoRank::Between(lastRank, std::string());
+}
+
+std::string KanbanDatabase::ResolveLegacyId(const std::string& legacyId)
+{
+    std::string id;
+    m_dbManager->ExecuteQuery(R"(
+        SELECT id FROM kanban_projects WHERE legacy_id = ?1
+        UNION ALL SELECT id FROM kanban_boards WHERE legacy_id = ?1
+        UNION ALL SELECT id FROM kanban_columns WHERE legacy_id = ?1
+        UNION ALL SELECT id FROM kanban_cards WHERE legacy_id = ?1
+    )",
+        [&legacyId](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, legacyId.c_str(), -1, SQLITE_STATIC);
+        },
+        [&id](sqlite3_stmt* stmt) -> bool {
+            id = ReadId(stmt, 0);
+            return false;
+        });
+
+    return id;
 }
 
 // Project CRUD operations
 bool KanbanDatabase::CreateProject(const Kanban::Project& project)
 {
+    if (!CheckId(project.id, "project")) {
+        return false;
+    }
+
     const std::string sql = R"(
-        INSERT INTO kanban_projects (id, name, description, is_active, created_at, modified_at)
+        INSERT INTO kanban_projects (id, name, description, is_active, created_ms, modified_ms)
         VALUES (?, ?, ?, ?, ?, ?)
     )";
 
     return m_dbManager->ExecuteSQL(sql, [&project, this](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, project.id.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 1, project.id);
         sqlite3_bind_text(stmt, 2, project.name.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_text(stmt, 3, project.description.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_int(stmt, 4, project.isActive ? 1 : 0);
-        sqlite3_bind_text(stmt, 5, TimePointToString(project.createdAt).c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 6, TimePointToString(project.modifiedAt).c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 5, Utils::ToEpochMs(project.createdAt));
+        sqlite3_bind_int64(stmt, 6, Utils::ToEpochMs(project.modifiedAt));
     });
 }
 
@@ -275,22 +812,22 @@ std::optional<std::unique_ptr<Kanban::Project>> KanbanDatabase::GetProject(const
     std::optional<std::unique_ptr<Kanban::Project>> result;
     
     const std::string sql = R"(
-        SELECT id, name, description, is_active, created_at, modified_at 
+        SELECT id, name, description, is_active, created_ms, modified_ms 
         FROM kanban_projects WHERE id = ?
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&projectId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, projectId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, projectId);
         },
         [&result, this](sqlite3_stmt* stmt) -> bool {
             Kanban::Project project;
-            project.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+            project.id = ReadId(stmt, 0);
             project.name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
             project.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
             project.isActive = sqlite3_column_int(stmt, 3) == 1;
-            project.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 4) ? (char*)sqlite3_column_text(stmt, 4) : "");
-            project.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 5) ? (char*)sqlite3_column_text(stmt, 5) : "");
+            project.createdAt = ReadTimestamp(stmt, 4);
+            project.modifiedAt = ReadTimestamp(stmt, 5);
 
             LoadBoardsForProject(project);
             result = std::make_unique<Kanban::Project>(std::move(project));
@@ -305,18 +842,18 @@ std::vector<std::unique_ptr<Kanban::Project>> KanbanDatabase::GetAllProjects()
     std::vector<std::unique_ptr<Kanban::Project>> projects;
     
     const std::string sql = R"(
-        SELECT id, name, description, is_active, created_at, modified_at 
-        FROM kanban_projects ORDER BY created_at DESC
+        SELECT id, name, description, is_active, created_ms, modified_ms 
+        FROM kanban_projects ORDER BY created_ms DESC
     )";
 
     m_dbManager->ExecuteQuery(sql, [&projects, this](sqlite3_stmt* stmt) -> bool {
         auto project = std::make_unique<Kanban::Project>();
-        project->id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+        project->id = ReadId(stmt, 0);
         project->name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
         project->description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
         project->isActive = sqlite3_column_int(stmt, 3) == 1;
-        project->createdAt = StringToTimePoint(sqlite3_column_text(stmt, 4) ? (char*)sqlite3_column_text(stmt, 4) : "");
-        project->modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 5) ? (char*)sqlite3_column_text(stmt, 5) : "");
+        project->createdAt = ReadTimestamp(stmt, 4);
+        project->modifiedAt = ReadTimestamp(stmt, 5);
         
         LoadBoardsForProject(*project);
 
@@ -334,23 +871,323 @@ std::vector<std::unique_ptr<Kanban::Project>> KanbanDatabase::GetAllProjects()
     return projects;
 }
 
+std::vector<std::unique_ptr<Kanban::Project>> KanbanDatabase::GetAllProjectsBulk()
+{
+    // GetAllProjects() issues one query per project, board and column plus one per card
+    // for its tags. Here every table is scanned once in display order and each row is
+    // attached to its parent through a hash lookup, so the cost no longer grows with
+    // the number of round trips. Holding the writer keeps the five scans consistent.
+    auto lock = m_dbManager->Lock();
+
+    std::unordered_map<int64_t, Kanban::Project*> projectById;
+    std::unordered_map<int64_t, Kanban::Board*> boardById;
+    auto projects = LoadProjectRows(projectById);
+
+    // Boards are collected first: like LoadBoardsForProject, boards without columns are skipped
+    std::vector<std::pair<Kanban::Project*, std::unique_ptr<Kanban::Board>>> boards;
+    m_dbManager->ExecuteQuery(R"(
+        SELECT project_id, id, name, description, created_ms, modified_ms
+        FROM kanban_boards ORDER BY created_ms DESC
+    )", [&](sqlite3_stmt* stmt) -> bool {
+        auto owner = projectById.find(sqlite3_column_int64(stmt, 0));
+        if (owner == projectById.end())
+            return true;
+
+        auto board = ReadBoardRow(stmt, 1);
+        boardById[sqlite3_column_int64(stmt, 1)] = board.get();
+        boards.emplace_back(owner->second, std::move(board));
+        return true;
+    });
+
+    LoadBoardContents(boardById, "");
+
+    for (auto& [project, board] : boards)
+    {
+        if (!board->columns.empty())
+        {
+            project->boards.push_back(std::move(board));
+        }
+    }
+
+    Logger::Debug("Bulk loaded {} projects, {} boards", projects.size(), boardById.size());
+    return projects;
+}
+
+std::vector<std::unique_ptr<Kanban::Project>> KanbanDatabase::GetProjectHeaders()
+{
+    auto lock = m_dbManager->Lock();
+
+    std::unordered_map<int64_t, Kanban::Project*> projectById;
+    auto projects = LoadProjectRows(projectById);
+
+    std::unordered_map<int64_t, Kanban::Board*> boardById;
+    m_dbManager->ExecuteQuery(R"(
+        SELECT b.project_id, b.id, b.name, b.description, b.created_ms, b.modified_ms
+        FROM kanban_boards b
+        WHERE EXISTS (SELECT 1 FROM kanban_columns col WHERE col.board_id = b.id)
+        ORDER BY b.created_ms DESC
+    )", [&](sqlite3_stmt* stmt) -> bool {
+        // Boards without columns are skipped, as in the eager paths
+        auto owner = projectById.find(sqlite3_column_int64(stmt, 0));
+        if (owner == projectById.end())
+            return true;
+
+        auto board = ReadBoardRow(stmt, 1);
+        board->isLoaded = false;
+        boardById[sqlite3_column_int64(stmt, 1)] = board.get();
+        owner->second->boards.push_back(std::move(board));
+        return true;
+    });
+
+    // Card counts for the board list, read from the covering (column_id, status) index
+    // so that no card row is touched
+    m_dbManager->ExecuteQuery(R"(
+        SELECT col.board_id, COUNT(*), SUM(c.status = 1)
+        FROM kanban_columns col
+        JOIN kanban_cards c INDEXED BY idx_kanban_cards_column_status ON c.column_id = col.id
+        GROUP BY col.board_id
+    )", [&](sqlite3_stmt* stmt) -> bool {
+        auto board = boardById.find(sqlite3_column_int64(stmt, 0));
+        if (board != boardById.end())
+        {
+            board->second->storedCardCount = sqlite3_column_int(stmt, 1);
+            board->second->storedCompletedCount = sqlite3_column_int(stmt, 2);
+        }
+        return true;
+    });
+
+    // Overdue counts as of today, from the (status, due_day) index - only overdue cards
+    // are visited. Cards the due_day backfill has not reached yet are left out.
+    m_dbManager->ExecuteQuery(R"(
+        SELECT col.board_id, COUNT(*)
+        FROM kanban_cards c INDEXED BY idx_kanban_cards_status_due_day
+        JOIN kanban_columns col ON col.id = c.column_id
+        WHERE c.status = 0 AND c.due_day < ?
+        GROUP BY col.board_id
+    )", [](sqlite3_stmt* stmt) {
+        sqlite3_bind_int64(stmt, 1, Utils::GetTodayDayNumber());
+    }, [&](sqlite3_stmt* stmt) -> bool {
+        auto board = boardById.find(sqlite3_column_int64(stmt, 0));
+        if (board != boardById.end())
+        {
+            board->second->storedOverdueCount = sqlite3_column_int(stmt, 1);
+        }
+        return true;
+    });
+
+    return projects;
+}
+
+bool KanbanDatabase::LoadBoardContents(Kanban::Board& board)
+{
+    auto lock = m_dbManager->Lock();
+
+    board.columns.clear();
+    board.InvalidateCardIndex();
+    std::unordered_map<int64_t, Kanban::Board*> boardById;
+    boardById[ParseId(board.id)] = &board;
+
+    return LoadBoardContents(boardById, board.id);
+}
+
+bool KanbanDatabase::LoadBoardContents(const std::unordered_map<int64_t, Kanban::Board*>& boardById,
+                                       const std::string& boardId)
+{
+    // Columns, cards and tags of every board in the map, one scan each. An empty boardId
+    // scans all boards; otherwise the scans are limited to that board through its columns.
+    const std::string boardFilter = boardId.empty() ? "" : " WHERE col.board_id = ?";
+    auto bindBoard = [&boardId](sqlite3_stmt* stmt) {
+        if (!boardId.empty())
+        {
+            BindId(stmt, 1, boardId);
+        }
+    };
+
+    std::unordered_map<int64_t, Kanban::Column*> columnById;
+    std::unordered_map<int64_t, Kanban::Card*> cardById;
+
+    bool success = m_dbManager->ExecuteQuery(R"(
+        SELECT col.board_id, col.id, col.name, col.header_color_r, col.header_color_g, col.header_color_b,
+               col.header_color_a, col.card_limit, col.is_collapsed, col.column_rank
+        FROM kanban_columns col)" + boardFilter + R"(
+        ORDER BY col.board_id, col.column_rank
+    )", bindBoard, [&](sqlite3_stmt* stmt) -> bool {
+        auto owner = boardById.find(sqlite3_column_int64(stmt, 0));
+        if (owner == boardById.end())
+            return true;
+
+        auto column = ReadColumnRow(stmt, 1);
+        columnById[sqlite3_column_int64(stmt, 1)] = column.get();
+        owner->second->columns.push_back(std::move(column));
+        return true;
+    });
+
+    // Rows arrive grouped by column, so the parent lookup only runs when the column changes
+    int64_t currentColumnId = -1;
+    Kanban::Column* currentColumn = nullptr;
+    success &= m_dbManager->ExecuteQuery(R"(
+        SELECT c.column_id, c.id, c.title, c.description, c.priority, c.status, c.color_r, c.color_g,
+               c.color_b, c.color_a, c.assignee, c.due_date, COALESCE(c.created_ms, unixepoch(c.created_at) * 1000),
+               COALESCE(c.modified_ms, unixepoch(c.modified_at) * 1000), c.card_rank
+        FROM kanban_cards c INDEXED BY idx_kanban_cards_column_rank)" + (boardId.empty() ? std::string() :
+        " JOIN kanban_columns col ON col.id = c.column_id" + boardFilter) + R"(
+        ORDER BY c.column_id, c.card_rank
+    )", bindBoard, [&](sqlite3_stmt* stmt) -> bool {
+        const int64_t columnId = sqlite3_column_int64(stmt, 0);
+        if (currentColumnId != columnId)
+        {
+            currentColumnId = columnId;
+            auto owner = columnById.find(currentColumnId);
+            currentColumn = owner != columnById.end() ? owner->second : nullptr;
+        }
+        if (!currentColumn)
+            return true;
+
+        auto card = ReadCardRow(stmt, 1);
+        cardById[sqlite3_column_int64(stmt, 1)] = card.get();
+        currentColumn->cards.push_back(std::move(card));
+        return true;
+    });
+
+    // All card tags in one scan of the (card_id, tag_id) key, grouped by card like the
+    // cards above. Sorting by name in SQL needs a temp b-tree over every row, while
+    // sorting each card's handful of tags afterwards is nearly free.
+    int64_t currentCardId = -1;
+    Kanban::Card* currentCard = nullptr;
+    success &= m_dbManager->ExecuteQuery(R"(
+        SELECT ct.card_id, t.name
+        FROM kanban_card_tags ct
+        JOIN kanban_tags t ON t.id = ct.tag_id)" + (boardId.empty() ? std::string() :
+        " JOIN kanban_cards c ON c.id = ct.card_id JOIN kanban_columns col ON col.id = c.column_id" + boardFilter) + R"(
+        ORDER BY ct.card_id
+    )", bindBoard, [&](sqlite3_stmt* stmt) -> bool {
+        const int64_t cardId = sqlite3_column_int64(stmt, 0);
+        const char* tagName = (const char*)sqlite3_column_text(stmt, 1);
+        if (!tagName)
+            return true;
+
+        if (currentCardId != cardId)
+        {
+            currentCardId = cardId;
+            auto owner = cardById.find(currentCardId);
+            currentCard = owner != cardById.end() ? owner->second : nullptr;
+        }
+        if (currentCard)
+        {
+            currentCard->tags.emplace_back(tagName);
+        }
+        return true;
+    });
+
+    for (auto& [id, card] : cardById)
+    {
+        if (card->tags.size() > 1)
+        {
+            std::sort(card->tags.begin(), card->tags.end());
+        }
+    }
+
+    for (auto& [id, board] : boardById)
+    {
+        board->isLoaded = true;
+    }
+    return success;
+}
+
+std::vector<std::unique_ptr<Kanban::Project>> KanbanDatabase::LoadProjectRows(
+    std::unordered_map<int64_t, Kanban::Project*>& projectById)
+{
+    std::vector<std::unique_ptr<Kanban::Project>> projects;
+
+    m_dbManager->ExecuteQuery(R"(
+        SELECT id, name, description, is_active, created_ms, modified_ms
+        FROM kanban_projects ORDER BY created_ms DESC
+    )", [&](sqlite3_stmt* stmt) -> bool {
+        auto project = std::make_unique<Kanban::Project>();
+        project->id = ReadId(stmt, 0);
+        project->name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
+        project->description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
+        project->isActive = sqlite3_column_int(stmt, 3) == 1;
+        project->createdAt = ReadTimestamp(stmt, 4);
+        project->modifiedAt = ReadTimestamp(stmt, 5);
+
+        projectById[sqlite3_column_int64(stmt, 0)] = project.get();
+        projects.push_back(std::move(project));
+        return true;
+    });
+
+    return projects;
+}
+
+// Row readers shared by the set-based loaders - "first" is the index of the id column
+std::unique_ptr<Kanban::Board> KanbanDatabase::ReadBoardRow(sqlite3_stmt* stmt, int first) const
+{
+    auto board = std::make_unique<Kanban::Board>();
+    board->id = ReadId(stmt, first);
+    board->name = sqlite3_column_text(stmt, first + 1) ? (char*)sqlite3_column_text(stmt, first + 1) : "";
+    board->description = sqlite3_column_text(stmt, first + 2) ? (char*)sqlite3_column_text(stmt, first + 2) : "";
+    board->createdAt = ReadTimestamp(stmt, first + 3);
+    board->modifiedAt = ReadTimestamp(stmt, first + 4);
+    return board;
+}
+
+std::unique_ptr<Kanban::Column> KanbanDatabase::ReadColumnRow(sqlite3_stmt* stmt, int first) const
+{
+    auto column = std::make_unique<Kanban::Column>();
+    column->id = ReadId(stmt, first);
+    column->name = sqlite3_column_text(stmt, first + 1) ? (char*)sqlite3_column_text(stmt, first + 1) : "";
+    column->headerColor.r = sqlite3_column_double(stmt, first + 2);
+    column->headerColor.g = sqlite3_column_double(stmt, first + 3);
+    column->headerColor.b = sqlite3_column_double(stmt, first + 4);
+    column->headerColor.a = sqlite3_column_double(stmt, first + 5);
+    column->cardLimit = sqlite3_column_int(stmt, first + 6);
+    column->isCollapsed = sqlite3_column_int(stmt, first + 7) != 0;
+    column->rank = sqlite3_column_text(stmt, first + 8) ? (char*)sqlite3_column_text(stmt, first + 8) : "";
+    return column;
+}
+
+std::shared_ptr<Kanban::Card> KanbanDatabase::ReadCardRow(sqlite3_stmt* stmt, int first) const
+{
+    auto card = std::make_shared<Kanban::Card>();
+    ReadCardRow(stmt, first, *card);
+    return card;
+}
+
+void KanbanDatabase::ReadCardRow(sqlite3_stmt* stmt, int first, Kanban::Card& card) const
+{
+    card.id = ReadId(stmt, first);
+    card.title = sqlite3_column_text(stmt, first + 1) ? (char*)sqlite3_column_text(stmt, first + 1) : "";
+    card.description = sqlite3_column_text(stmt, first + 2) ? (char*)sqlite3_column_text(stmt, first + 2) : "";
+    card.priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, first + 3));
+    card.status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, first + 4));
+    card.color.r = sqlite3_column_double(stmt, first + 5);
+    card.color.g = sqlite3_column_double(stmt, first + 6);
+    card.color.b = sqlite3_column_double(stmt, first + 7);
+    card.color.a = sqlite3_column_double(stmt, first + 8);
+    card.assignee = sqlite3_column_text(stmt, first + 9) ? (char*)sqlite3_column_text(stmt, first + 9) : "";
+    card.dueDate = sqlite3_column_text(stmt, first + 10) ? (char*)sqlite3_column_text(stmt, first + 10) : "";
+    card.createdAt = ReadTimestamp(stmt, first + 11);
+    card.modifiedAt = ReadTimestamp(stmt, first + 12);
+    card.rank = sqlite3_column_text(stmt, first + 13) ? (char*)sqlite3_column_text(stmt, first + 13) : "";
+}
+
 std::vector<std::unique_ptr<Kanban::Project>> KanbanDatabase::GetActiveProjects()
 {
     std::vector<std::unique_ptr<Kanban::Project>> projects;
     
     const std::string sql = R"(
-        SELECT id, name, description, is_active, created_at, modified_at 
-        FROM kanban_projects WHERE is_active = 1 ORDER BY created_at DESC
+        SELECT id, name, description, is_active, created_ms, modified_ms 
+        FROM kanban_projects WHERE is_active = 1 ORDER BY created_ms DESC
     )";
 
     m_dbManager->ExecuteQuery(sql, [&projects, this](sqlite3_stmt* stmt) -> bool {
         Kanban::Project project;
-        project.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+        project.id = ReadId(stmt, 0);
         project.name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
         project.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
         project.isActive = sqlite3_column_int(stmt, 3) == 1;
-        project.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 4) ? (char*)sqlite3_column_text(stmt, 4) : "");
-        project.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 5) ? (char*)sqlite3_column_text(stmt, 5) : "");
+        project.createdAt = ReadTimestamp(stmt, 4);
+        project.modifiedAt = ReadTimestamp(stmt, 5);
         
         LoadBoardsForProject(project);
         projects.push_back(std::make_unique<Kanban::Project>(std::move(project)));
@@ -362,9 +1199,13 @@ std::vector<std::unique_ptr<Kanban::Project>> KanbanDatabase::GetActiveProjects(
 
 bool KanbanDatabase::UpdateProject(const Kanban::Project& project)
 {
+    if (!CheckId(project.id, "project")) {
+        return false;
+    }
+
     const std::string sql = R"(
         UPDATE kanban_projects 
-        SET name = ?, description = ?, is_active = ?, modified_at = ? 
+        SET name = ?, description = ?, is_active = ?, modified_ms = ? 
         WHERE id = ?
     )";
 
@@ -372,31 +1213,39 @@ bool KanbanDatabase::UpdateProject(const Kanban::Project& project)
         sqlite3_bind_text(stmt, 1, project.name.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_text(stmt, 2, project.description.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_int(stmt, 3, project.isActive ? 1 : 0);
-        sqlite3_bind_text(stmt, 4, TimePointToString(std::chrono::system_clock::now()).c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 5, project.id.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 4, Utils::ToEpochMs(std::chrono::system_clock::now()));
+        BindId(stmt, 5, project.id);
     });
 }
 
 bool KanbanDatabase::DeleteProject(const std::string& projectId)
 {
+    if (!CheckId(projectId, "project")) {
+        return false;
+    }
+
     const std::string sql = "DELETE FROM kanban_projects WHERE id = ?";
     
     return m_dbManager->ExecuteSQL(sql, [&projectId](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, projectId.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 1, projectId);
     });
 }
 
 bool KanbanDatabase::ArchiveProject(const std::string& projectId)
 {
+    if (!CheckId(projectId, "project")) {
+        return false;
+    }
+
     const std::string sql = R"(
         UPDATE kanban_projects 
-        SET is_active = 0, modified_at = ? 
+        SET is_active = 0, modified_ms = ? 
         WHERE id = ?
     )";
 
     return m_dbManager->ExecuteSQL(sql, [&projectId, this](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, TimePointToString(std::chrono::system_clock::now()).c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 2, projectId.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 1, Utils::ToEpochMs(std::chrono::system_clock::now()));
+        BindId(stmt, 2, projectId);
     });
 }
 
@@ -407,7 +1256,7 @@ bool KanbanDatabase::IsProjectExists(const std::string& projectId)
 
     m_dbManager->ExecuteQuery(sql,
         [&projectId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, projectId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, projectId);
         },
         [&exists](sqlite3_stmt* stmt) -> bool {
             exists = sqlite3_column_type(stmt, 0) != SQLITE_NULL;
@@ -420,19 +1269,23 @@ bool KanbanDatabase::IsProjectExists(const std::string& projectId)
 // Board CRUD operations
 bool KanbanDatabase::CreateBoard(const Kanban::Board& board, const std::string& projectId)
 {
+    if (!CheckId(board.id, "board") || !CheckId(projectId, "project")) {
+        return false;
+    }
+
     const std::string sql = R"(
-        INSERT INTO kanban_boards (id, project_id, name, description, is_active, created_at, modified_at)
+        INSERT INTO kanban_boards (id, project_id, name, description, is_active, created_ms, modified_ms)
         VALUES (?, ?, ?, ?, ?, ?, ?)
     )";
 
     return m_dbManager->ExecuteSQL(sql, [&board, &projectId, this](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, board.id.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 2, projectId.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 1, board.id);
+        BindId(stmt, 2, projectId);
         sqlite3_bind_text(stmt, 3, board.name.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_text(stmt, 4, board.description.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_int(stmt, 5, board.isActive ? 1 : 0);
-        sqlite3_bind_text(stmt, 6, TimePointToString(board.createdAt).c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 7, TimePointToString(board.modifiedAt).c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 6, Utils::ToEpochMs(board.createdAt));
+        sqlite3_bind_int64(stmt, 7, Utils::ToEpochMs(board.modifiedAt));
     });
 }
 
@@ -441,22 +1294,22 @@ std::optional<std::unique_ptr<Kanban::Board>> KanbanDatabase::GetBoard(const std
     std::optional<std::unique_ptr<Kanban::Board>> result;
     
     const std::string sql = R"(
-        SELECT id, name, description, is_active, created_at, modified_at 
+        SELECT id, name, description, is_active, created_ms, modified_ms 
         FROM kanban_boards WHERE id = ?
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&boardId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, boardId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, boardId);
         },
         [&result, this](sqlite3_stmt* stmt) -> bool {
             Kanban::Board board;
-            board.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+            board.id = ReadId(stmt, 0);
             board.name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
             board.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
             board.isActive = sqlite3_column_int(stmt, 3) == 1;
-            board.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 4) ? (char*)sqlite3_column_text(stmt, 4) : "");
-            board.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 5) ? (char*)sqlite3_column_text(stmt, 5) : "");
+            board.createdAt = ReadTimestamp(stmt, 4);
+            board.modifiedAt = ReadTimestamp(stmt, 5);
 
             LoadColumnsForBoard(board);
             result = std::make_unique<Kanban::Board>(std::move(board));
@@ -472,22 +1325,22 @@ std::vector<std::unique_ptr<Kanban::Board>> KanbanDatabase::GetBoardsByProject(c
     std::vector<std::unique_ptr<Kanban::Board>> boards;
     
     const std::string sql = R"(
-        SELECT id, name, description, is_active, created_at, modified_at 
-        FROM kanban_boards WHERE project_id = ? ORDER BY created_at DESC
+        SELECT id, name, description, is_active, created_ms, modified_ms 
+        FROM kanban_boards WHERE project_id = ? ORDER BY created_ms DESC
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&projectId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, projectId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, projectId);
         },
         [&boards, this](sqlite3_stmt* stmt) -> bool {
             Kanban::Board board;
-            board.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+            board.id = ReadId(stmt, 0);
             board.name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
             board.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
             board.isActive = sqlite3_column_int(stmt, 3) == 1;
-            board.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 4) ? (char*)sqlite3_column_text(stmt, 4) : "");
-            board.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 5) ? (char*)sqlite3_column_text(stmt, 5) : "");
+            board.createdAt = ReadTimestamp(stmt, 4);
+            board.modifiedAt = ReadTimestamp(stmt, 5);
 
             LoadColumnsForBoard(board);
             boards.push_back(std::make_unique<Kanban::Board>(std::move(board)));
@@ -503,18 +1356,18 @@ std::vector<std::unique_ptr<Kanban::Board>> KanbanDatabase::GetAllBoards()
     std::vector<std::unique_ptr<Kanban::Board>> boards;
     
     const std::string sql = R"(
-        SELECT id, name, description, is_active, created_at, modified_at 
-        FROM kanban_boards ORDER BY created_at DESC
+        SELECT id, name, description, is_active, created_ms, modified_ms 
+        FROM kanban_boards ORDER BY created_ms DESC
     )";
 
     m_dbManager->ExecuteQuery(sql, [&boards, this](sqlite3_stmt* stmt) -> bool {
         auto board = std::unique_ptr<Kanban::Board>();
-        board->id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+        board->id = ReadId(stmt, 0);
         board->name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
         board->description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
         board->isActive = sqlite3_column_int(stmt, 3) == 1;
-        board->createdAt = StringToTimePoint(sqlite3_column_text(stmt, 4) ? (char*)sqlite3_column_text(stmt, 4) : "");
-        board->modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 5) ? (char*)sqlite3_column_text(stmt, 5) : "");
+        board->createdAt = ReadTimestamp(stmt, 4);
+        board->modifiedAt = ReadTimestamp(stmt, 5);
 
         LoadColumnsForBoard(*board);
         boards.push_back(std::move(board));
@@ -527,9 +1380,13 @@ std::vector<std::unique_ptr<Kanban::Board>> KanbanDatabase::GetAllBoards()
 
 bool KanbanDatabase::UpdateBoard(const Kanban::Board& board)
 {
+    if (!CheckId(board.id, "board")) {
+        return false;
+    }
+
     const std::string sql = R"(
         UPDATE kanban_boards 
-        SET name = ?, description = ?, is_active = ?, modified_at = ? 
+        SET name = ?, description = ?, is_active = ?, modified_ms = ? 
         WHERE id = ?
     )";
 
@@ -537,31 +1394,39 @@ bool KanbanDatabase::UpdateBoard(const Kanban::Board& board)
         sqlite3_bind_text(stmt, 1, board.name.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_text(stmt, 2, board.description.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_int(stmt, 3, board.isActive ? 1 : 0);
-        sqlite3_bind_text(stmt, 4, TimePointToString(std::chrono::system_clock::now()).c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 5, board.id.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 4, Utils::ToEpochMs(std::chrono::system_clock::now()));
+        BindId(stmt, 5, board.id);
     });
 }
 
 bool KanbanDatabase::DeleteBoard(const std::string& boardId)
 {
+    if (!CheckId(boardId, "board")) {
+        return false;
+    }
+
     const std::string sql = "DELETE FROM kanban_boards WHERE id = ?";
     
     return m_dbManager->ExecuteSQL(sql, [&boardId](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, boardId.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 1, boardId);
     });
 }
 
 bool KanbanDatabase::ArchiveBoard(const std::string& boardId)
 {
+    if (!CheckId(boardId, "board")) {
+        return false;
+    }
+
     const std::string sql = R"(
         UPDATE kanban_boards 
-        SET is_active = 0, modified_at = ? 
+        SET is_active = 0, modified_ms = ? 
         WHERE id = ?
     )";
 
     return m_dbManager->ExecuteSQL(sql, [&boardId, this](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, TimePointToString(std::chrono::system_clock::now()).c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 2, boardId.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 1, Utils::ToEpochMs(std::chrono::system_clock::now()));
+        BindId(stmt, 2, boardId);
     });
 }
 
@@ -572,7 +1437,7 @@ bool KanbanDatabase::IsBoardExists(const std::string& boardId)
 
     m_dbManager->ExecuteQuery(sql,
         [&boardId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, boardId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, boardId);
         },
         [&exists](sqlite3_stmt* stmt) -> bool {
             exists = sqlite3_column_type(stmt, 0) != SQLITE_NULL;
@@ -585,17 +1450,21 @@ bool KanbanDatabase::IsBoardExists(const std::string& boardId)
 // Column CRUD operations
 bool KanbanDatabase::CreateColumn(const Kanban::Column& column, const std::string& boardId)
 {
-    int order = GetNextOrder(boardId, "column_order", "board_id");
+    if (!CheckId(column.id, "column") || !CheckId(boardId, "board")) {
+        return false;
+    }
+
+    const std::string rank = column.rank.empty() ? GetNextRank(boardId, true) : column.rank;
     
     const std::string sql = R"(
         INSERT INTO kanban_columns (id, board_id, name, header_color_r, header_color_g, header_color_b, header_color_a, 
-                                   card_limit, is_collapsed, column_order)
+                                   card_limit, is_collapsed, column_rank)
         VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
     )";
 
-    return m_dbManager->ExecuteSQL(sql, [&column, &boardId, order](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, column.id.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 2, boardId.c_str(), -1, SQLITE_STATIC);
+    return m_dbManager->ExecuteSQL(sql, [&column, &boardId, &rank](sqlite3_stmt* stmt) {
+        BindId(stmt, 1, column.id);
+        BindId(stmt, 2, boardId);
         sqlite3_bind_text(stmt, 3, column.name.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_double(stmt, 4, column.headerColor.r);
         sqlite3_bind_double(stmt, 5, column.headerColor.g);
@@ -603,7 +1472,7 @@ bool KanbanDatabase::CreateColumn(const Kanban::Column& column, const std::strin
         sqlite3_bind_double(stmt, 7, column.headerColor.a);
         sqlite3_bind_int(stmt, 8, column.cardLimit);
         sqlite3_bind_int(stmt, 9, column.isCollapsed ? 1 : 0);
-        sqlite3_bind_int(stmt, 10, order);
+        sqlite3_bind_text(stmt, 10, rank.c_str(), -1, SQLITE_STATIC);
     });
 }
 
@@ -613,17 +1482,17 @@ std::optional<std::unique_ptr<Kanban::Column>> KanbanDatabase::GetColumn(const s
     
     const std::string sql = R"(
         SELECT id, name, header_color_r, header_color_g, header_color_b, header_color_a,
-               card_limit, is_collapsed
+               card_limit, is_collapsed, column_rank
         FROM kanban_columns WHERE id = ?
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&columnId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, columnId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, columnId);
         },
         [&result, this](sqlite3_stmt* stmt) -> bool {
             Kanban::Column column;
-            column.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+            column.id = ReadId(stmt, 0);
             column.name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
             column.headerColor.r = sqlite3_column_double(stmt, 2);
             column.headerColor.g = sqlite3_column_double(stmt, 3);
@@ -631,6 +1500,7 @@ std::optional<std::unique_ptr<Kanban::Column>> KanbanDatabase::GetColumn(const s
             column.headerColor.a = sqlite3_column_double(stmt, 5);
             column.cardLimit = sqlite3_column_int(stmt, 6);
             column.isCollapsed = sqlite3_column_int(stmt, 7) == 1;
+            column.rank = sqlite3_column_text(stmt, 8) ? (char*)sqlite3_column_text(stmt, 8) : "";
             
             LoadCardsForColumn(column);
             result = std::make_unique<Kanban::Column>(std::move(column));
@@ -647,17 +1517,17 @@ std::vector<std::unique_ptr<Kanban::Column>> KanbanDatabase::GetColumnsByBoard(c
     
     const std::string sql = R"(
         SELECT id, name, header_color_r, header_color_g, header_color_b, header_color_a,
-               card_limit, is_collapsed
-        FROM kanban_columns WHERE board_id = ? ORDER BY column_order
+               card_limit, is_collapsed, column_rank
+        FROM kanban_columns WHERE board_id = ? ORDER BY column_rank
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&boardId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, boardId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, boardId);
         },
         [&columns, this](sqlite3_stmt* stmt) -> bool {
             Kanban::Column column;
-            column.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+            column.id = ReadId(stmt, 0);
             column.name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
             column.headerColor.r = sqlite3_column_double(stmt, 2);
             column.headerColor.g = sqlite3_column_double(stmt, 3);
@@ -665,6 +1535,7 @@ std::vector<std::unique_ptr<Kanban::Column>> KanbanDatabase::GetColumnsByBoard(c
             column.headerColor.a = sqlite3_column_double(stmt, 5);
             column.cardLimit = sqlite3_column_int(stmt, 6);
             column.isCollapsed = sqlite3_column_int(stmt, 7) == 1;
+            column.rank = sqlite3_column_text(stmt, 8) ? (char*)sqlite3_column_text(stmt, 8) : "";
             
             LoadCardsForColumn(column);
             columns.push_back(std::make_unique<Kanban::Column>(std::move(column)));
@@ -681,13 +1552,13 @@ std::vector<std::unique_ptr<Kanban::Column>> KanbanDatabase::GetAllColumns()
     
     const std::string sql = R"(
         SELECT id, name, header_color_r, header_color_g, header_color_b, header_color_a,
-               card_limit, is_collapsed
-        FROM kanban_columns ORDER BY column_order
+               card_limit, is_collapsed, column_rank
+        FROM kanban_columns ORDER BY column_rank
     )";
 
     m_dbManager->ExecuteQuery(sql, [&columns, this](sqlite3_stmt* stmt) -> bool {
         Kanban::Column column;
-        column.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+        column.id = ReadId(stmt, 0);
         column.name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
         column.headerColor.r = sqlite3_column_double(stmt, 2);
         column.headerColor.g = sqlite3_column_double(stmt, 3);
@@ -695,6 +1566,7 @@ std::vector<std::unique_ptr<Kanban::Column>> KanbanDatabase::GetAllColumns()
         column.headerColor.a = sqlite3_column_double(stmt, 5);
         column.cardLimit = sqlite3_column_int(stmt, 6);
         column.isCollapsed = sqlite3_column_int(stmt, 7) == 1;
+        column.rank = sqlite3_column_text(stmt, 8) ? (char*)sqlite3_column_text(stmt, 8) : "";
         
         LoadCardsForColumn(column);
         columns.push_back(std::make_unique<Kanban::Column>(std::move(column)));
@@ -706,6 +1578,10 @@ std::vector<std::unique_ptr<Kanban::Column>> KanbanDatabase::GetAllColumns()
 
 bool KanbanDatabase::UpdateColumn(const Kanban::Column& column)
 {
+    if (!CheckId(column.id, "column")) {
+        return false;
+    }
+
     const std::string sql = R"(
         UPDATE kanban_columns 
         SET name = ?, header_color_r = ?, header_color_g = ?, header_color_b = ?, header_color_a = ?,
@@ -721,33 +1597,48 @@ bool KanbanDatabase::UpdateColumn(const Kanban::Column& column)
         sqlite3_bind_double(stmt, 5, column.headerColor.a);
         sqlite3_bind_int(stmt, 6, column.cardLimit);
         sqlite3_bind_int(stmt, 7, column.isCollapsed ? 1 : 0);
-        sqlite3_bind_text(stmt, 8, column.id.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 8, column.id);
     });
 }
 
 bool KanbanDatabase::DeleteColumn(const std::string& columnId)
 {
+    if (!CheckId(columnId, "column")) {
+        return false;
+    }
+
     const std::string sql = "DELETE FROM kanban_columns WHERE id = ?";
     
     return m_dbManager->ExecuteSQL(sql, [&columnId](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, columnId.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 1, columnId);
     });
 }
 
 bool KanbanDatabase::UpdateColumnOrder(const std::string& boardId, const std::vector<std::string>& columnIds)
 {
+    if (!CheckId(boardId, "board")) {
+        return false;
+    }
+    for (const std::string& columnId : columnIds) {
+        if (!CheckId(columnId, "column")) {
+            return false;
+        }
+    }
+
     if (!m_dbManager->BeginTransaction()) {
         return false;
     }
 
+    // Rewrites every rank evenly spaced - a rebalance; single moves use MoveColumn
+    const auto ranks = Kanban::LexoRank::Spread(columnIds.size());
     bool success = true;
     for (size_t i = 0; i < columnIds.size(); ++i) {
-        const std::string sql = "UPDATE kanban_columns SET column_order = ? WHERE id = ? AND board_id = ?";
+        const std::string sql = "UPDATE kanban_columns SET column_rank = ? WHERE id = ? AND board_id = ?";
         
-        if (!m_dbManager->ExecuteSQL(sql, [&columnIds, i, &boardId](sqlite3_stmt* stmt) {
-            sqlite3_bind_int(stmt, 1, static_cast<int>(i));
-            sqlite3_bind_text(stmt, 2, columnIds[i].c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_text(stmt, 3, boardId.c_str(), -1, SQLITE_STATIC);
+        if (!m_dbManager->ExecuteSQL(sql, [&columnIds, &ranks, i, &boardId](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, ranks[i].c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 2, columnIds[i]);
+            BindId(stmt, 3, boardId);
         })) {
             success = false;
             break;
@@ -763,6 +1654,20 @@ bool KanbanDatabase::UpdateColumnOrder(const std::string& boardId, const std::ve
     return success;
 }
 
+bool KanbanDatabase::MoveColumn(const std::string& columnId, const std::string& rank)
+{
+    if (!CheckId(columnId, "column")) {
+        return false;
+    }
+
+    const std::string sql = "UPDATE kanban_columns SET column_rank = ? WHERE id = ?";
+
+    return m_dbManager->ExecuteSQL(sql, [&columnId, &rank](sqlite3_stmt* stmt) {
+        sqlite3_bind_text(stmt, 1, rank.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 2, columnId);
+    });
+}
+
 bool KanbanDatabase::IsColumnExists(const std::string& columnId)
 {
     bool exists = false;
@@ -770,7 +1675,7 @@ bool KanbanDatabase::IsColumnExists(const std::string& columnId)
 
     m_dbManager->ExecuteQuery(sql,
         [&columnId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, columnId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, columnId);
         },
         [&exists](sqlite3_stmt* stmt) -> bool {
             exists = sqlite3_column_type(stmt, 0) != SQLITE_NULL;
@@ -819,9 +1724,9 @@ std::vector<std::string> KanbanDatabase::GetCardTags(const std::string& cardId)
         ORDER BY t.name
     )";
 
-    m_dbManager->ExecuteQuery(sql,
+    m_dbManager->ExecuteReadQuery(sql,
         [&cardId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, cardId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, cardId);
         },
         [&tags](sqlite3_stmt* stmt) -> bool {
             const char* tagName = (char*)sqlite3_column_text(stmt, 0);
@@ -836,6 +1741,10 @@ std::vector<std::string> KanbanDatabase::GetCardTags(const std::string& cardId)
 
 bool KanbanDatabase::AddTagToCard(const std::string& cardId, const std::string& tagName)
 {
+    if (!CheckId(cardId, "card")) {
+        return false;
+    }
+
     // First ensure the tag exists
     if (!CreateTag(tagName)) {
         return false;
@@ -862,13 +1771,17 @@ bool KanbanDatabase::AddTagToCard(const std::string& cardId, const std::string&
     const std::string sql = "INSERT OR IGNORE INTO kanban_card_tags (card_id, tag_id) VALUES (?, ?)";
     
     return m_dbManager->ExecuteSQL(sql, [&cardId, tagId](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, cardId.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 1, cardId);
         sqlite3_bind_int(stmt, 2, tagId);
     });
 }
 
 bool KanbanDatabase::RemoveTagFromCard(const std::string& cardId, const std::string& tagName)
 {
+    if (!CheckId(cardId, "card")) {
+        return false;
+    }
+
     const std::string sql = R"(
         DELETE FROM kanban_card_tags 
         WHERE card_id = ? AND tag_id = (
@@ -877,13 +1790,17 @@ bool KanbanDatabase::RemoveTagFromCard(const std::string& cardId, const std::str
     )";
     
     return m_dbManager->ExecuteSQL(sql, [&cardId, &tagName](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, cardId.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 1, cardId);
         sqlite3_bind_text(stmt, 2, tagName.c_str(), -1, SQLITE_STATIC);
     });
 }
 
 bool KanbanDatabase::UpdateCardTags(const std::string& cardId, const std::vector<std::string>& tags)
 {
+    if (!CheckId(cardId, "card")) {
+        return false;
+    }
+
     if (!m_dbManager->BeginTransaction()) {
         return false;
     }
@@ -891,7 +1808,7 @@ bool KanbanDatabase::UpdateCardTags(const std::string& cardId, const std::vector
     // First, remove all existing tags for this card
     const std::string deleteSql = "DELETE FROM kanban_card_tags WHERE card_id = ?";
     if (!m_dbManager->ExecuteSQL(deleteSql, [&cardId](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, cardId.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 1, cardId);
     })) {
         m_dbManager->RollbackTransaction();
         return false;
@@ -904,95 +1821,419 @@ bool KanbanDatabase::UpdateCardTags(const std::string& cardId, const std::vector
             success = false;
             break;
         }
-    }
+    }
+
+    if (success) {
+        m_dbManager->CommitTransaction();
+    } else {
+        m_dbManager->RollbackTransaction();
+    }
+
+    return success;
+}
+
+bool KanbanDatabase::DeleteTag(const std::string& tagName)
+{
+    const std::string sql = "DELETE FROM kanban_tags WHERE name = ?";
+    
+    return m_dbManager->ExecuteSQL(sql, [&tagName](sqlite3_stmt* stmt) {
+        sqlite3_bind_text(stmt, 1, tagName.c_str(), -1, SQLITE_STATIC);
+    });
+}
+
+// Card search
+std::string KanbanDatabase::BuildMatchExpression(const std::string& query)
+{
+    // User text to an FTS query: words become prefix terms, quoted text a phrase, and
+    // column:word a column filter. Operator characters and keywords never reach FTS -
+    // words are lowercased (AND/OR/NOT are only operators in capitals) and punctuation
+    // separates words, as the tokenizer would split there anyway.
+    static const char* const columns[] = { "title", "description", "assignee", "tags" };
+
+    std::string expression;
+    std::string phrase;
+    std::string word;
+    std::string column;
+    bool quoted = false;
+
+    auto endWord = [&]() {
+        if (word.empty()) return;
+        if (!phrase.empty()) phrase += ' ';
+        phrase += word;
+        word.clear();
+    };
+    auto endPhrase = [&]() {
+        endWord();
+        if (phrase.empty()) return;
+        if (!expression.empty()) expression += ' ';
+        if (!column.empty()) expression += column + ':';
+        expression += quoted ? '"' + phrase + "*\"" : phrase + '*';
+        phrase.clear();
+        column.clear();
+    };
+
+    for (char c : query)
+    {
+        const unsigned char u = static_cast<unsigned char>(c);
+        if (std::isalnum(u) || u >= 0x80)
+        {
+            word += static_cast<char>(std::tolower(u));
+        }
+        else if (c == ':' && !quoted && phrase.empty() &&
+                 std::find_if(std::begin(columns), std::end(columns),
+                              [&word](const char* name) { return word == name; }) != std::end(columns))
+        {
+            column = word;
+            word.clear();
+        }
+        else if (c == '"')
+        {
+            endPhrase();
+            quoted = !quoted;
+        }
+        else if (quoted)
+        {
+            endWord();
+        }
+        else
+        {
+            endPhrase();
+        }
+    }
+    endPhrase();
+
+    return expression;
+}
+
+std::vector<Kanban::SearchHit> KanbanDatabase::SearchCards(const std::string& query, const std::string& boardId,
+                                                                   size_t limit)
+{
+    std::vector<Kanban::SearchHit> hits;
+    const std::string expression = BuildMatchExpression(query);
+    if (expression.empty() || limit == 0)
+    {
+        return hits;
+    }
+
+    // FTS4 has no built-in ranking, so every match is scored here with BM25 from its
+    // matchinfo (phrase/column counts and hit statistics), weighting title over tags and
+    // assignee over description. Only the best `limit` are then read in full, with their
+    // snippets. Length normalisation is left out: the per-row column lengths ('l') cost a
+    // docsize lookup for every match, most of the query at 100k cards, and the column
+    // weights already separate a short title from a long description.
+    static const double weights[] = { 4.0, 1.0, 2.0, 2.0 };
+    constexpr double k1 = 1.2;
+
+    // CROSS JOIN keeps the FTS table outermost: probed from the other side, the MATCH
+    // would be evaluated again for every row
+    const std::string boardJoin = boardId.empty() ? "" : R"(
+        CROSS JOIN kanban_cards c ON c.id = kanban_cards_fts.docid
+        CROSS JOIN kanban_columns col ON col.id = c.column_id AND col.board_id = ?2)";
+
+    std::vector<std::pair<double, int64_t>> ranked;
+    m_dbManager->ExecuteReadQuery(
+        "SELECT kanban_cards_fts.docid, matchinfo(kanban_cards_fts, 'pcnx') FROM kanban_cards_fts" + boardJoin +
+        " WHERE kanban_cards_fts MATCH ?1",
+        [&expression, &boardId](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, expression.c_str(), -1, SQLITE_STATIC);
+            if (!boardId.empty())
+            {
+                BindId(stmt, 2, boardId);
+            }
+        },
+        [&ranked](sqlite3_stmt* stmt) -> bool {
+            const auto* info = static_cast<const uint32_t*>(sqlite3_column_blob(stmt, 1));
+            const size_t count = static_cast<size_t>(sqlite3_column_bytes(stmt, 1)) / sizeof(uint32_t);
+            if (!info || count < 3)
+                return true;
+
+            const uint32_t phrases = info[0];
+            const uint32_t cols = info[1];
+            const double rows = info[2];
+            const uint32_t* hits = info + 3;
+            if (count < 3 + 3 * phrases * cols)
+                return true;
+
+            double score = 0.0;
+            for (uint32_t p = 0; p < phrases; ++p)
+            {
+                for (uint32_t c = 0; c < cols && c < 4; ++c)
+                {
+                    const uint32_t* x = hits + 3 * (p * cols + c);
+                    if (x[0] == 0)
+                        continue;
+
+                    // log(1 + ...) stays positive for words in most rows, as on small boards
+                    const double idf = std::log(1.0 + (rows - x[2] + 0.5) / (x[2] + 0.5));
+                    score += weights[c] * idf * (x[0] * (k1 + 1.0)) / (x[0] + k1);
+                }
+            }
+
+            ranked.emplace_back(score, sqlite3_column_int64(stmt, 0));
+            return true;
+        });
+
+    const size_t keep = std::min(limit, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + keep, ranked.end(),
+                      [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    ranked.resize(keep);
+
+    // The winners in one statement - snippet() needs the MATCH, and restricting the docids
+    // through an IN list evaluates it once instead of once per hit
+    std::string idList = "[";
+    std::unordered_map<int64_t, size_t> position;
+    for (size_t i = 0; i < ranked.size(); ++i)
+    {
+        idList += (i ? "," : "") + std::to_string(ranked[i].second);
+        position[ranked[i].second] = i;
+    }
+    idList += "]";
+
+    hits.resize(ranked.size());
+    m_dbManager->ExecuteReadQuery(R"(
+        SELECT c.id, c.title, c.description, c.priority, c.status, c.color_r, c.color_g, c.color_b, c.color_a,
+               c.assignee, c.due_date, COALESCE(c.created_ms, unixepoch(c.created_at) * 1000),
+               COALESCE(c.modified_ms, unixepoch(c.modified_at) * 1000), c.card_rank, c.column_id,
+               snippet(kanban_cards_fts, ?3, ?4, '...', -1, 12)
+        FROM kanban_cards_fts CROSS JOIN kanban_cards c ON c.id = kanban_cards_fts.docid
+        WHERE kanban_cards_fts MATCH ?1 AND kanban_cards_fts.docid IN (SELECT value FROM json_each(?2))
+    )",
+        [&expression, &idList](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, expression.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 2, idList.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 3, SEARCH_MATCH_BEGIN, -1, SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 4, SEARCH_MATCH_END, -1, SQLITE_STATIC);
+        },
+        [&](sqlite3_stmt* stmt) -> bool {
+            Kanban::SearchHit& hit = hits[position[sqlite3_column_int64(stmt, 0)]];
+            hit.card = ReadCardRow(stmt, 0);
+            hit.columnId = ReadId(stmt, 14);
+            hit.snippet = sqlite3_column_text(stmt, 15) ? (char*)sqlite3_column_text(stmt, 15) : "";
+            hit.score = ranked[position[sqlite3_column_int64(stmt, 0)]].first;
+            return true;
+        });
+
+    m_dbManager->ExecuteReadQuery(R"(
+        SELECT ct.card_id, t.name
+        FROM kanban_card_tags ct JOIN kanban_tags t ON t.id = ct.tag_id
+        WHERE ct.card_id IN (SELECT value FROM json_each(?1))
+        ORDER BY ct.card_id, t.name
+    )",
+        [&idList](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, idList.c_str(), -1, SQLITE_STATIC);
+        },
+        [&](sqlite3_stmt* stmt) -> bool {
+            Kanban::SearchHit& hit = hits[position[sqlite3_column_int64(stmt, 0)]];
+            if (hit.card && sqlite3_column_text(stmt, 1))
+            {
+                hit.card->tags.emplace_back((const char*)sqlite3_column_text(stmt, 1));
+            }
+            return true;
+        });
+
+    // A card deleted between the two reads leaves an empty slot
+    hits.erase(std::remove_if(hits.begin(), hits.end(), [](const Kanban::SearchHit& hit) { return !hit.card; }),
+               hits.end());
+    return hits;
+}
+
+bool KanbanDatabase::ExportProject(const std::string& projectId, const std::string& boardId,
+                                   const ExportVisitor& visitor)
+{
+    // Project, boards and columns are few rows and are read up front; only the card
+    // cursor stays open while the visitor runs
+    std::string exportProjectId = projectId;
+    if (exportProjectId.empty())
+    {
+        m_dbManager->ExecuteReadQuery("SELECT project_id FROM kanban_boards WHERE id = ?",
+            [&boardId](sqlite3_stmt* stmt) {
+                BindId(stmt, 1, boardId);
+            },
+            [&exportProjectId](sqlite3_stmt* stmt) -> bool {
+                exportProjectId = ReadId(stmt, 0);
+                return false;
+            });
+    }
+
+    Kanban::Project project;
+    bool found = false;
+    m_dbManager->ExecuteReadQuery(R"(
+        SELECT id, name, description, is_active, created_ms, modified_ms
+        FROM kanban_projects WHERE id = ?
+    )",
+        [&exportProjectId](sqlite3_stmt* stmt) {
+            BindId(stmt, 1, exportProjectId);
+        },
+        [&project, &found, this](sqlite3_stmt* stmt) -> bool {
+            project.id = ReadId(stmt, 0);
+            project.name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
+            project.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
+            project.isActive = sqlite3_column_int(stmt, 3) == 1;
+            project.createdAt = ReadTimestamp(stmt, 4);
+            project.modifiedAt = ReadTimestamp(stmt, 5);
+            found = true;
+            return false;
+        });
+
+    if (!found)
+    {
+        SetError("Nothing to export for project '" + projectId + "' board '" + boardId + "'");
+        return false;
+    }
+    if (!visitor.project(project))
+    {
+        return false;
+    }
+
+    std::vector<std::unique_ptr<Kanban::Board>> boards;
+    m_dbManager->ExecuteReadQuery(R"(
+        SELECT id, name, description, created_ms, modified_ms
+        FROM kanban_boards WHERE project_id = ?1 AND (?2 IS NULL OR id = ?2)
+        ORDER BY created_ms DESC
+    )",
+        [&exportProjectId, &boardId](sqlite3_stmt* stmt) {
+            BindId(stmt, 1, exportProjectId);
+            BindId(stmt, 2, boardId);
+        },
+        [&boards, this](sqlite3_stmt* stmt) -> bool {
+            boards.push_back(ReadBoardRow(stmt, 0));
+            return true;
+        });
+
+    // Tags ride along as one unit-separated string per card instead of a query per card
+    const std::string cardSql = R"(
+        SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
+               assignee, due_date, COALESCE(created_ms, unixepoch(created_at) * 1000),
+               COALESCE(modified_ms, unixepoch(modified_at) * 1000), card_rank,
+               (SELECT group_concat(t.name, char(31)) FROM kanban_card_tags ct
+                JOIN kanban_tags t ON t.id = ct.tag_id WHERE ct.card_id = kanban_cards.id)
+        FROM kanban_cards WHERE column_id = ? ORDER BY card_rank
+    )";
+
+    Kanban::Card card;
+    bool success = true;
+    for (const auto& board : boards)
+    {
+        if (!visitor.board(*board))
+        {
+            return false;
+        }
 
-    if (success) {
-        m_dbManager->CommitTransaction();
-    } else {
-        m_dbManager->RollbackTransaction();
-    }
+        std::vector<std::unique_ptr<Kanban::Column>> columns;
+        m_dbManager->ExecuteReadQuery(R"(
+            SELECT id, name, header_color_r, header_color_g, header_color_b, header_color_a,
+                   card_limit, is_collapsed, column_rank
+            FROM kanban_columns WHERE board_id = ? ORDER BY column_rank
+        )",
+            [&board](sqlite3_stmt* stmt) {
+                BindId(stmt, 1, board->id);
+            },
+            [&columns, this](sqlite3_stmt* stmt) -> bool {
+                columns.push_back(ReadColumnRow(stmt, 0));
+                return true;
+            });
+
+        for (const auto& column : columns)
+        {
+            if (!visitor.column(*column))
+            {
+                return false;
+            }
 
-    return success;
-}
+            m_dbManager->ExecuteReadQuery(cardSql,
+                [&column](sqlite3_stmt* stmt) {
+                    BindId(stmt, 1, column->id);
+                },
+                [&card, &success, &visitor, this](sqlite3_stmt* stmt) -> bool {
+                    ReadCardRow(stmt, 0, card);
+                    card.tags.clear();
+                    if (const char* tags = (const char*)sqlite3_column_text(stmt, 14))
+                    {
+                        for (const char* end = tags; ; ++end)
+                        {
+                            if (*end == '\x1f' || *end == '\0')
+                            {
+                                card.tags.emplace_back(tags, end);
+                                if (*end == '\0') break;
+                                tags = end + 1;
+                            }
+                        }
+                    }
+                    success = visitor.card(card);
+                    return success;
+                });
+
+            if (!success)
+            {
+                return false;
+            }
+        }
+    }
 
-bool KanbanDatabase::DeleteTag(const std::string& tagName)
-{
-    const std::string sql = "DELETE FROM kanban_tags WHERE name = ?";
-    
-    return m_dbManager->ExecuteSQL(sql, [&tagName](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, tagName.c_str(), -1, SQLITE_STATIC);
-    });
+    return true;
 }
 
 // Card CRUD operations
 bool KanbanDatabase::CreateCard(const Kanban::Card& card, const std::string& columnId)
 {
-    int order = GetNextOrder(columnId, "card_order", "column_id");
+    if (!CheckId(card.id, "card") || !CheckId(columnId, "column")) {
+        return false;
+    }
+
+    const std::string rank = card.rank.empty() ? GetNextRank(columnId, false) : card.rank;
     
     const std::string sql = R"(
         INSERT INTO kanban_cards (id, column_id, title, description, priority, status,
-                                 color_r, color_g, color_b, color_a, assignee, due_date,
-                                 card_order, created_at, modified_at)
-        VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
+                                 color_r, color_g, color_b, color_a, assignee, due_date, due_day,
+                                 card_rank, created_ms, modified_ms)
+        VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
     )";
 
-    return m_dbManager->ExecuteSQL(sql, [&card, &columnId, order, this](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, card.id.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 2, columnId.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 3, card.title.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 4, card.description.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int(stmt, 5, static_cast<int>(card.priority));
-        sqlite3_bind_int(stmt, 6, static_cast<int>(card.status));
-        sqlite3_bind_double(stmt, 7, card.color.r);
-        sqlite3_bind_double(stmt, 8, card.color.g);
-        sqlite3_bind_double(stmt, 9, card.color.b);
-        sqlite3_bind_double(stmt, 10, card.color.a);
-        sqlite3_bind_text(stmt, 11, card.assignee.c_str(), -1, SQLITE_STATIC);
-        
-        if (!card.dueDate.empty()) {
-            sqlite3_bind_text(stmt, 12, card.dueDate.c_str(), -1, SQLITE_STATIC);
-        } else {
-            sqlite3_bind_null(stmt, 12);
-        }
-        
-        sqlite3_bind_int(stmt, 13, order);
-        sqlite3_bind_text(stmt, 14, TimePointToString(card.createdAt).c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 15, TimePointToString(card.modifiedAt).c_str(), -1, SQLITE_STATIC);
+    return m_dbManager->ExecuteSQL(sql, [&card, &columnId, &rank, this](sqlite3_stmt* stmt) {
+        BindCardRow(stmt, 1, card, columnId, rank);
     });
 }
 
+void KanbanDatabase::BindCardRow(sqlite3_stmt* stmt, int first, const Kanban::Card& card,
+                                 const std::string& columnId, const std::string& rank) const
+{
+    BindId(stmt, first, card.id);
+    BindId(stmt, first + 1, columnId);
+    sqlite3_bind_text(stmt, first + 2, card.title.c_str(), -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, first + 3, card.description.c_str(), -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, first + 4, static_cast<int>(card.priority));
+    sqlite3_bind_int(stmt, first + 5, static_cast<int>(card.status));
+    sqlite3_bind_double(stmt, first + 6, card.color.r);
+    sqlite3_bind_double(stmt, first + 7, card.color.g);
+    sqlite3_bind_double(stmt, first + 8, card.color.b);
+    sqlite3_bind_double(stmt, first + 9, card.color.a);
+    sqlite3_bind_text(stmt, first + 10, card.assignee.c_str(), -1, SQLITE_STATIC);
+    
+    BindDueDate(stmt, first + 11, card.dueDate);
+    sqlite3_bind_text(stmt, first + 13, rank.c_str(), -1, SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, first + 14, Utils::ToEpochMs(card.createdAt));
+    sqlite3_bind_int64(stmt, first + 15, Utils::ToEpochMs(card.modifiedAt));
+}
+
 std::optional<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetCard(const std::string& cardId)
 {
     std::optional<std::shared_ptr<Kanban::Card>> result;
     
     const std::string sql = R"(
         SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
-               assignee, due_date, created_at, modified_at
+               assignee, due_date, COALESCE(created_ms, unixepoch(created_at) * 1000),
+               COALESCE(modified_ms, unixepoch(modified_at) * 1000), card_rank
         FROM kanban_cards WHERE id = ?
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&cardId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, cardId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, cardId);
         },
         [&result, this](sqlite3_stmt* stmt) -> bool {
-            Kanban::Card card;
-            card.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
-            card.title = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
-            card.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-            card.priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, 3));
-            card.status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, 4));
-            card.color.r = sqlite3_column_double(stmt, 5);
-            card.color.g = sqlite3_column_double(stmt, 6);
-            card.color.b = sqlite3_column_double(stmt, 7);
-            card.color.a = sqlite3_column_double(stmt, 8);
-            card.assignee = sqlite3_column_text(stmt, 9) ? (char*)sqlite3_column_text(stmt, 9) : "";
-            card.dueDate = sqlite3_column_text(stmt, 10) ? (char*)sqlite3_column_text(stmt, 10) : "";
-            card.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 11) ? (char*)sqlite3_column_text(stmt, 11) : "");
-            card.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 12) ? (char*)sqlite3_column_text(stmt, 12) : "");
-            
-            LoadTagsForCard(card);
-            result = std::make_shared<Kanban::Card>(std::move(card));
+            auto card = ReadCardRow(stmt, 0);
+            LoadTagsForCard(*card);
+            result = std::move(card);
 
             return false;
         });
@@ -1006,32 +2247,19 @@ std::vector<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetCardsByColumn(cons
     
     const std::string sql = R"(
         SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
-               assignee, due_date, created_at, modified_at
-        FROM kanban_cards WHERE column_id = ? ORDER BY card_order
+               assignee, due_date, COALESCE(created_ms, unixepoch(created_at) * 1000),
+               COALESCE(modified_ms, unixepoch(modified_at) * 1000), card_rank
+        FROM kanban_cards WHERE column_id = ? ORDER BY card_rank
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&columnId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, columnId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, columnId);
         },
         [&cards, this](sqlite3_stmt* stmt) -> bool {
-            Kanban::Card card;
-            card.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
-            card.title = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
-            card.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-            card.priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, 3));
-            card.status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, 4));
-            card.color.r = sqlite3_column_double(stmt, 5);
-            card.color.g = sqlite3_column_double(stmt, 6);
-            card.color.b = sqlite3_column_double(stmt, 7);
-            card.color.a = sqlite3_column_double(stmt, 8);
-            card.assignee = sqlite3_column_text(stmt, 9) ? (char*)sqlite3_column_text(stmt, 9) : "";
-            card.dueDate = sqlite3_column_text(stmt, 10) ? (char*)sqlite3_column_text(stmt, 10) : "";
-            card.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 11) ? (char*)sqlite3_column_text(stmt, 11) : "");
-            card.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 12) ? (char*)sqlite3_column_text(stmt, 12) : "");
-            
-            LoadTagsForCard(card);
-            cards.push_back(std::make_shared<Kanban::Card>(std::move(card)));
+            auto card = ReadCardRow(stmt, 0);
+            LoadTagsForCard(*card);
+            cards.push_back(std::move(card));
             return true;
         });
 
@@ -1044,35 +2272,22 @@ std::vector<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetCardsByBoard(const
     
     const std::string sql = R"(
         SELECT c.id, c.title, c.description, c.priority, c.status, c.color_r, c.color_g, c.color_b, c.color_a,
-               c.assignee, c.due_date, c.created_at, c.modified_at
+               c.assignee, c.due_date, COALESCE(c.created_ms, unixepoch(c.created_at) * 1000),
+               COALESCE(c.modified_ms, unixepoch(c.modified_at) * 1000), c.card_rank
         FROM kanban_cards c
         JOIN kanban_columns col ON c.column_id = col.id
         WHERE col.board_id = ?
-        ORDER BY col.column_order, c.card_order
+        ORDER BY col.column_rank, c.card_rank
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&boardId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, boardId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, boardId);
         },
         [&cards, this](sqlite3_stmt* stmt) -> bool {
-            Kanban::Card card;
-            card.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
-            card.title = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
-            card.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-            card.priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, 3));
-            card.status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, 4));
-            card.color.r = sqlite3_column_double(stmt, 5);
-            card.color.g = sqlite3_column_double(stmt, 6);
-            card.color.b = sqlite3_column_double(stmt, 7);
-            card.color.a = sqlite3_column_double(stmt, 8);
-            card.assignee = sqlite3_column_text(stmt, 9) ? (char*)sqlite3_column_text(stmt, 9) : "";
-            card.dueDate = sqlite3_column_text(stmt, 10) ? (char*)sqlite3_column_text(stmt, 10) : "";
-            card.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 11) ? (char*)sqlite3_column_text(stmt, 11) : "");
-            card.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 12) ? (char*)sqlite3_column_text(stmt, 12) : "");
-            
-            LoadTagsForCard(card);
-            cards.push_back(std::make_shared<Kanban::Card>(std::move(card)));
+            auto card = ReadCardRow(stmt, 0);
+            LoadTagsForCard(*card);
+            cards.push_back(std::move(card));
 
             return true;
         });
@@ -1086,28 +2301,15 @@ std::vector<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetAllCards()
     
     const std::string sql = R"(
         SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
-               assignee, due_date, created_at, modified_at
-        FROM kanban_cards ORDER BY created_at DESC
+               assignee, due_date, COALESCE(created_ms, unixepoch(created_at) * 1000) AS created,
+               COALESCE(modified_ms, unixepoch(modified_at) * 1000), card_rank
+        FROM kanban_cards ORDER BY created DESC
     )";
 
-    m_dbManager->ExecuteQuery(sql, [&cards, this](sqlite3_stmt* stmt) -> bool {
-        Kanban::Card card;
-        card.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
-        card.title = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
-        card.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-        card.priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, 3));
-        card.status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, 4));
-        card.color.r = sqlite3_column_double(stmt, 5);
-        card.color.g = sqlite3_column_double(stmt, 6);
-        card.color.b = sqlite3_column_double(stmt, 7);
-        card.color.a = sqlite3_column_double(stmt, 8);
-        card.assignee = sqlite3_column_text(stmt, 9) ? (char*)sqlite3_column_text(stmt, 9) : "";
-        card.dueDate = sqlite3_column_text(stmt, 10) ? (char*)sqlite3_column_text(stmt, 10) : "";
-        card.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 11) ? (char*)sqlite3_column_text(stmt, 11) : "");
-        card.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 12) ? (char*)sqlite3_column_text(stmt, 12) : "");
-        
-        LoadTagsForCard(card);
-        cards.push_back(std::make_shared<Kanban::Card>(std::move(card)));
+    m_dbManager->ExecuteReadQuery(sql, [&cards, this](sqlite3_stmt* stmt) -> bool {
+        auto card = ReadCardRow(stmt, 0);
+        LoadTagsForCard(*card);
+        cards.push_back(std::move(card));
 
         return true;
     });
@@ -1121,32 +2323,19 @@ std::vector<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetCardsByPriority(Ka
     
     const std::string sql = R"(
         SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
-               assignee, due_date, created_at, modified_at
-        FROM kanban_cards WHERE priority = ? ORDER BY created_at DESC
+               assignee, due_date, COALESCE(created_ms, unixepoch(created_at) * 1000) AS created,
+               COALESCE(modified_ms, unixepoch(modified_at) * 1000), card_rank
+        FROM kanban_cards WHERE priority = ? ORDER BY created DESC
     )";
 
-    m_dbManager->ExecuteQuery(sql,
+    m_dbManager->ExecuteReadQuery(sql,
         [&priority](sqlite3_stmt* stmt) {
             sqlite3_bind_int(stmt, 1, static_cast<int>(priority));
         },
         [&cards, this](sqlite3_stmt* stmt) -> bool {
-            Kanban::Card card;
-            card.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
-            card.title = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
-            card.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-            card.priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, 3));
-            card.status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, 4));
-            card.color.r = sqlite3_column_double(stmt, 5);
-            card.color.g = sqlite3_column_double(stmt, 6);
-            card.color.b = sqlite3_column_double(stmt, 7);
-            card.color.a = sqlite3_column_double(stmt, 8);
-            card.assignee = sqlite3_column_text(stmt, 9) ? (char*)sqlite3_column_text(stmt, 9) : "";
-            card.dueDate = sqlite3_column_text(stmt, 10) ? (char*)sqlite3_column_text(stmt, 10) : "";
-            card.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 11) ? (char*)sqlite3_column_text(stmt, 11) : "");
-            card.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 12) ? (char*)sqlite3_column_text(stmt, 12) : "");
-            
-            LoadTagsForCard(card);
-            cards.push_back(std::make_shared<Kanban::Card>(std::move(card)));
+            auto card = ReadCardRow(stmt, 0);
+            LoadTagsForCard(*card);
+            cards.push_back(std::move(card));
             return true;
         });
 
@@ -1159,32 +2348,19 @@ std::vector<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetCardsByStatus(Kanb
     
     const std::string sql = R"(
         SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
-               assignee, due_date, created_at, modified_at
-        FROM kanban_cards WHERE status = ? ORDER BY created_at DESC
+               assignee, due_date, COALESCE(created_ms, unixepoch(created_at) * 1000) AS created,
+               COALESCE(modified_ms, unixepoch(modified_at) * 1000), card_rank
+        FROM kanban_cards WHERE status = ? ORDER BY created DESC
     )";
 
-    m_dbManager->ExecuteQuery(sql,
+    m_dbManager->ExecuteReadQuery(sql,
         [&status](sqlite3_stmt* stmt) {
             sqlite3_bind_int(stmt, 1, static_cast<int>(status));
         },
         [&cards, this](sqlite3_stmt* stmt) -> bool {
-            Kanban::Card card;
-            card.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
-            card.title = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
-            card.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-            card.priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, 3));
-            card.status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, 4));
-            card.color.r = sqlite3_column_double(stmt, 5);
-            card.color.g = sqlite3_column_double(stmt, 6);
-            card.color.b = sqlite3_column_double(stmt, 7);
-            card.color.a = sqlite3_column_double(stmt, 8);
-            card.assignee = sqlite3_column_text(stmt, 9) ? (char*)sqlite3_column_text(stmt, 9) : "";
-            card.dueDate = sqlite3_column_text(stmt, 10) ? (char*)sqlite3_column_text(stmt, 10) : "";
-            card.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 11) ? (char*)sqlite3_column_text(stmt, 11) : "");
-            card.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 12) ? (char*)sqlite3_column_text(stmt, 12) : "");
-            
-            LoadTagsForCard(card);
-            cards.push_back(std::make_shared<Kanban::Card>(std::move(card)));
+            auto card = ReadCardRow(stmt, 0);
+            LoadTagsForCard(*card);
+            cards.push_back(std::move(card));
 
             return true;
         });
@@ -1195,36 +2371,45 @@ std::vector<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetCardsByStatus(Kanb
 std::vector<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetOverdueCards()
 {
     std::vector<std::shared_ptr<Kanban::Card>> cards;
-    
+    auto readCard = [&cards, this](sqlite3_stmt* stmt) -> bool {
+        auto card = ReadCardRow(stmt, 0);
+        LoadTagsForCard(*card);
+        cards.push_back(std::move(card));
+
+        return true;
+    };
+
+    if (!m_dbManager->GetSchemaBackfill().IsComplete(CARDS_BACKFILL_JOB))
+    {
+        // Not every card has a due_day yet - compare the v1 text
+        const std::string sql = R"(
+            SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
+                   assignee, due_date, COALESCE(created_ms, unixepoch(created_at) * 1000),
+                   COALESCE(modified_ms, unixepoch(modified_at) * 1000), card_rank
+            FROM kanban_cards 
+            WHERE due_date IS NOT NULL AND due_date < CURRENT_TIMESTAMP AND status = 0
+            ORDER BY due_date ASC
+        )";
+
+        m_dbManager->ExecuteReadQuery(sql, readCard);
+        return cards;
+    }
+
+    // Range scan of (status, due_day): due before today, in due order
     const std::string sql = R"(
         SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
-               assignee, due_date, created_at, modified_at
-        FROM kanban_cards 
-        WHERE due_date IS NOT NULL AND due_date < CURRENT_TIMESTAMP AND status = 0
-        ORDER BY due_date ASC
+               assignee, due_date, created_ms, modified_ms
+        FROM kanban_cards
+        WHERE status = 0 AND due_day < ?
+        ORDER BY due_day ASC
     )";
 
-    m_dbManager->ExecuteQuery(sql, [&cards, this](sqlite3_stmt* stmt) -> bool {
-        Kanban::Card card;
-        card.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
-        card.title = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
-        card.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-        card.priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, 3));
-        card.status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, 4));
-        card.color.r = sqlite3_column_double(stmt, 5);
-        card.color.g = sqlite3_column_double(stmt, 6);
-        card.color.b = sqlite3_column_double(stmt, 7);
-        card.color.a = sqlite3_column_double(stmt, 8);
-        card.assignee = sqlite3_column_text(stmt, 9) ? (char*)sqlite3_column_text(stmt, 9) : "";
-        card.dueDate = sqlite3_column_text(stmt, 10) ? (char*)sqlite3_column_text(stmt, 10) : "";
-        card.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 11) ? (char*)sqlite3_column_text(stmt, 11) : "");
-        card.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 12) ? (char*)sqlite3_column_text(stmt, 12) : "");
-        
-        LoadTagsForCard(card);
-        cards.push_back(std::make_shared<Kanban::Card>(std::move(card)));
-
-        return true;
-    });
+    const int64_t today = Utils::GetTodayDayNumber();
+    m_dbManager->ExecuteReadQuery(sql,
+        [today](sqlite3_stmt* stmt) {
+            sqlite3_bind_int64(stmt, 1, today);
+        },
+        readCard);
 
     return cards;
 }
@@ -1235,32 +2420,19 @@ std::vector<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetCardsByAssignee(co
     
     const std::string sql = R"(
         SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
-               assignee, due_date, created_at, modified_at
-        FROM kanban_cards WHERE assignee = ? ORDER BY created_at DESC
+               assignee, due_date, COALESCE(created_ms, unixepoch(created_at) * 1000) AS created,
+               COALESCE(modified_ms, unixepoch(modified_at) * 1000), card_rank
+        FROM kanban_cards WHERE assignee = ? ORDER BY created DESC
     )";
 
-    m_dbManager->ExecuteQuery(sql,
+    m_dbManager->ExecuteReadQuery(sql,
         [&assignee](sqlite3_stmt* stmt) {
             sqlite3_bind_text(stmt, 1, assignee.c_str(), -1, SQLITE_STATIC);
         },
         [&cards, this](sqlite3_stmt* stmt) -> bool {
-            Kanban::Card card;
-            card.id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
-            card.title = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
-            card.description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-            card.priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, 3));
-            card.status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, 4));
-            card.color.r = sqlite3_column_double(stmt, 5);
-            card.color.g = sqlite3_column_double(stmt, 6);
-            card.color.b = sqlite3_column_double(stmt, 7);
-            card.color.a = sqlite3_column_double(stmt, 8);
-            card.assignee = sqlite3_column_text(stmt, 9) ? (char*)sqlite3_column_text(stmt, 9) : "";
-            card.dueDate = sqlite3_column_text(stmt, 10) ? (char*)sqlite3_column_text(stmt, 10) : "";
-            card.createdAt = StringToTimePoint(sqlite3_column_text(stmt, 11) ? (char*)sqlite3_column_text(stmt, 11) : "");
-            card.modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 12) ? (char*)sqlite3_column_text(stmt, 12) : "");
-            
-            LoadTagsForCard(card);
-            cards.push_back(std::make_shared<Kanban::Card>(std::move(card)));
+            auto card = ReadCardRow(stmt, 0);
+            LoadTagsForCard(*card);
+            cards.push_back(std::move(card));
             return true;
         });
 
@@ -1269,11 +2441,15 @@ std::vector<std::shared_ptr<Kanban::Card>> KanbanDatabase::GetCardsByAssignee(co
 
 bool KanbanDatabase::UpdateCard(const Kanban::Card& card)
 {
+    if (!CheckId(card.id, "card")) {
+        return false;
+    }
+
     const std::string sql = R"(
         UPDATE kanban_cards 
         SET title = ?, description = ?, priority = ?, status = ?,
             color_r = ?, color_g = ?, color_b = ?, color_a = ?,
-            assignee = ?, due_date = ?, modified_at = ?
+            assignee = ?, due_date = ?, due_day = ?, modified_ms = ?
         WHERE id = ?
     )";
 
@@ -1288,40 +2464,212 @@ bool KanbanDatabase::UpdateCard(const Kanban::Card& card)
         sqlite3_bind_double(stmt, 8, card.color.a);
         sqlite3_bind_text(stmt, 9, card.assignee.c_str(), -1, SQLITE_STATIC);
         
-        if (!card.dueDate.empty()) {
-            sqlite3_bind_text(stmt, 10, card.dueDate.c_str(), -1, SQLITE_STATIC);
+        BindDueDate(stmt, 10, card.dueDate);
+        sqlite3_bind_int64(stmt, 12, Utils::ToEpochMs(std::chrono::system_clock::now()));
+        BindId(stmt, 13, card.id);
+    });
+}
+
+bool KanbanDatabase::UpdateCards(const std::vector<CardWrite>& writes)
+{
+    for (const CardWrite& write : writes) {
+        if (!CheckId(write.card.id, "card") || (!write.columnId.empty() && !CheckId(write.columnId, "column"))) {
+            return false;
+        }
+    }
+
+    if (!m_dbManager->BeginTransaction()) {
+        return false;
+    }
+
+    // One commit for the batch; each statement is prepared once and rebound per card
+    const std::string moveSql = "UPDATE kanban_cards SET column_id = ?, card_rank = ?, modified_ms = ? WHERE id = ?";
+    const std::string clearTagsSql = "DELETE FROM kanban_card_tags WHERE card_id = ?";
+    const int64_t now = Utils::ToEpochMs(std::chrono::system_clock::now());
+
+    bool success = true;
+    for (const CardWrite& write : writes) {
+        const Kanban::Card& card = write.card;
+        if (write.updateFields && !UpdateCard(card)) {
+            success = false;
+            break;
+        }
+
+        if (!write.columnId.empty() &&
+            !m_dbManager->ExecuteSQL(moveSql, [&write, &card, now](sqlite3_stmt* stmt) {
+                BindId(stmt, 1, write.columnId);
+                sqlite3_bind_text(stmt, 2, card.rank.c_str(), -1, SQLITE_STATIC);
+                sqlite3_bind_int64(stmt, 3, now);
+                BindId(stmt, 4, card.id);
+            })) {
+            success = false;
+            break;
+        }
+
+        if (write.updateTags) {
+            if (!m_dbManager->ExecuteSQL(clearTagsSql, [&card](sqlite3_stmt* stmt) {
+                BindId(stmt, 1, card.id);
+            })) {
+                success = false;
+                break;
+            }
+            for (const std::string& tag : card.tags) {
+                if (!AddTagToCard(card.id, tag)) {
+                    success = false;
+                    break;
+                }
+            }
+            if (!success) {
+                break;
+            }
+        }
+    }
+
+    if (success) {
+        success = m_dbManager->CommitTransaction();
+    } else {
+        SetError("Bulk card update failed: " + m_dbManager->GetLastError());
+        m_dbManager->RollbackTransaction();
+    }
+
+    return success;
+}
+
+bool KanbanDatabase::CreateCards(const std::vector<CardInsert>& inserts)
+{
+    // The search index flushes its pending terms at every statement that writes it, so
+    // cards go in CARD_INSERT_ROWS to a statement; a shorter tail goes in one by one.
+    static const std::string insertRowsSql = [] {
+        std::string row = "(?";
+        for (int i = 1; i < CARD_INSERT_COLUMNS; ++i) {
+            row += ", ?";
+        }
+        row += ")";
+
+        std::string sql = R"(
+        INSERT INTO kanban_cards (id, column_id, title, description, priority, status,
+                                 color_r, color_g, color_b, color_a, assignee, due_date, due_day,
+                                 card_rank, created_ms, modified_ms)
+        VALUES )";
+        for (size_t i = 0; i < CARD_INSERT_ROWS; ++i) {
+            sql += (i ? ", " : "") + row;
+        }
+        return sql;
+    }();
+
+    for (const CardInsert& insert : inserts) {
+        if (!CheckId(insert.card.id, "card") || !CheckId(insert.columnId, "column")) {
+            return false;
+        }
+    }
+
+    if (!m_dbManager->BeginTransaction()) {
+        return false;
+    }
+
+    // Tags are linked before their card (foreign keys are checked at commit), so the
+    // insert trigger indexes them with the card and the search row is never rewritten.
+    bool success = m_dbManager->ExecuteSQL("PRAGMA defer_foreign_keys = ON;");
+    std::unordered_map<std::string, int64_t> tagIds;
+    for (size_t start = 0; success && start < inserts.size(); start += CARD_INSERT_ROWS) {
+        const size_t end = std::min(start + CARD_INSERT_ROWS, inserts.size());
+        bool fullRows = end - start == CARD_INSERT_ROWS;
+        for (size_t i = start; success && i < end; ++i) {
+            const Kanban::Card& card = inserts[i].card;
+            fullRows = fullRows && !card.rank.empty();
+            for (const std::string& tag : card.tags) {
+                auto found = tagIds.find(tag);
+                if (found == tagIds.end()) {
+                    int64_t tagId = -1;
+                    success = CreateTag(tag) && m_dbManager->ExecuteQuery("SELECT id FROM kanban_tags WHERE name = ?",
+                        [&tag](sqlite3_stmt* stmt) {
+                            sqlite3_bind_text(stmt, 1, tag.c_str(), -1, SQLITE_STATIC);
+                        },
+                        [&tagId](sqlite3_stmt* stmt) -> bool {
+                            tagId = sqlite3_column_int64(stmt, 0);
+                            return false;
+                        }) && tagId != -1;
+                    if (!success) {
+                        break;
+                    }
+                    found = tagIds.emplace(tag, tagId).first;
+                }
+
+                success = m_dbManager->ExecuteSQL("INSERT OR IGNORE INTO kanban_card_tags (card_id, tag_id) VALUES (?, ?)",
+                    [&card, &found](sqlite3_stmt* stmt) {
+                        BindId(stmt, 1, card.id);
+                        sqlite3_bind_int64(stmt, 2, found->second);
+                    });
+                if (!success) {
+                    break;
+                }
+            }
+        }
+
+        if (success && fullRows) {
+            success = m_dbManager->ExecuteSQL(insertRowsSql, [&inserts, start, this](sqlite3_stmt* stmt) {
+                for (size_t i = 0; i < CARD_INSERT_ROWS; ++i) {
+                    const CardInsert& insert = inserts[start + i];
+                    BindCardRow(stmt, 1 + static_cast<int>(i) * CARD_INSERT_COLUMNS, insert.card, insert.columnId,
+                                insert.card.rank);
+                }
+            });
         } else {
-            sqlite3_bind_null(stmt, 10);
+            for (size_t i = start; success && i < end; ++i) {
+                success = CreateCard(inserts[i].card, inserts[i].columnId);
+            }
         }
-        
-        sqlite3_bind_text(stmt, 11, TimePointToString(std::chrono::system_clock::now()).c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 12, card.id.c_str(), -1, SQLITE_STATIC);
-    });
+    }
+
+    if (success) {
+        success = m_dbManager->CommitTransaction();
+    } else {
+        SetError("Card import failed: " + m_dbManager->GetLastError());
+        m_dbManager->RollbackTransaction();
+    }
+    m_dbManager->ExecuteSQL("PRAGMA defer_foreign_keys = OFF;");
+
+    return success;
 }
 
 bool KanbanDatabase::DeleteCard(const std::string& cardId)
 {
+    if (!CheckId(cardId, "card")) {
+        return false;
+    }
+
     const std::string sql = "DELETE FROM kanban_cards WHERE id = ?";
     
     return m_dbManager->ExecuteSQL(sql, [&cardId](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, cardId.c_str(), -1, SQLITE_STATIC);
+        BindId(stmt, 1, cardId);
     });
 }
 
 bool KanbanDatabase::UpdateCardOrder(const std::string& columnId, const std::vector<std::string>& cardIds)
 {
+    if (!CheckId(columnId, "column")) {
+        return false;
+    }
+    for (const std::string& cardId : cardIds) {
+        if (!CheckId(cardId, "card")) {
+            return false;
+        }
+    }
+
     if (!m_dbManager->BeginTransaction()) {
         return false;
     }
 
+    // Rewrites every rank evenly spaced - a rebalance; single moves use MoveCard
+    const auto ranks = Kanban::LexoRank::Spread(cardIds.size());
     bool success = true;
     for (size_t i = 0; i < cardIds.size(); ++i) {
-        const std::string sql = "UPDATE kanban_cards SET card_order = ? WHERE id = ? AND column_id = ?";
+        const std::string sql = "UPDATE kanban_cards SET card_rank = ? WHERE id = ? AND column_id = ?";
         
-        if (!m_dbManager->ExecuteSQL(sql, [&cardIds, i, &columnId](sqlite3_stmt* stmt) {
-            sqlite3_bind_int(stmt, 1, static_cast<int>(i));
-            sqlite3_bind_text(stmt, 2, cardIds[i].c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_text(stmt, 3, columnId.c_str(), -1, SQLITE_STATIC);
+        if (!m_dbManager->ExecuteSQL(sql, [&cardIds, &ranks, i, &columnId](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, ranks[i].c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 2, cardIds[i]);
+            BindId(stmt, 3, columnId);
         })) {
             success = false;
             break;
@@ -1337,39 +2685,28 @@ bool KanbanDatabase::UpdateCardOrder(const std::string& columnId, const std::vec
     return success;
 }
 
-bool KanbanDatabase::MoveCard(const std::string& cardId, const std::string& targetColumnId, int targetIndex)
+bool KanbanDatabase::MoveCard(const std::string& cardId, const std::string& targetColumnId, const std::string& rank)
 {
-    if (!m_dbManager->BeginTransaction()) {
+    if (!CheckId(cardId, "card") || !CheckId(targetColumnId, "column")) {
         return false;
     }
 
-    // If targetIndex is -1, get the next available order
-    int order = targetIndex;
-    if (order == -1) {
-        order = GetNextOrder(targetColumnId, "card_order", "column_id");
-    }
+    // An empty rank appends to the target column
+    const std::string newRank = rank.empty() ? GetNextRank(targetColumnId, false) : rank;
 
-    // Update the card's column and position
+    // Neighbours keep their ranks, so a move is this one row whatever the column length
     const std::string sql = R"(
         UPDATE kanban_cards 
-        SET column_id = ?, card_order = ?, modified_at = ? 
+        SET column_id = ?, card_rank = ?, modified_ms = ? 
         WHERE id = ?
     )";
 
-    bool success = m_dbManager->ExecuteSQL(sql, [&cardId, &targetColumnId, order, this](sqlite3_stmt* stmt) {
-        sqlite3_bind_text(stmt, 1, targetColumnId.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int(stmt, 2, order);
-        sqlite3_bind_text(stmt, 3, TimePointToString(std::chrono::system_clock::now()).c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 4, cardId.c_str(), -1, SQLITE_STATIC);
+    return m_dbManager->ExecuteSQL(sql, [&cardId, &targetColumnId, &newRank](sqlite3_stmt* stmt) {
+        BindId(stmt, 1, targetColumnId);
+        sqlite3_bind_text(stmt, 2, newRank.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 3, Utils::ToEpochMs(std::chrono::system_clock::now()));
+        BindId(stmt, 4, cardId);
     });
-
-    if (success) {
-        m_dbManager->CommitTransaction();
-    } else {
-        m_dbManager->RollbackTransaction();
-    }
-
-    return success;
 }
 
 bool KanbanDatabase::IsCardExists(const std::string& cardId)
@@ -1380,7 +2717,7 @@ bool KanbanDatabase::IsCardExists(const std::string& cardId)
     
     m_dbManager->ExecuteQuery(sql,
         [&cardId](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, cardId.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, cardId);
         },
         [&exists](sqlite3_stmt* stmt) -> bool {
             exists = true;
@@ -1395,21 +2732,21 @@ bool KanbanDatabase::LoadBoardsForProject(Kanban::Project& project)
     std::vector<std::unique_ptr<Kanban::Board>> boards;
     
     const std::string sql = R"(
-        SELECT id, name, description, created_at, modified_at
-        FROM kanban_boards WHERE project_id = ? ORDER BY created_at DESC
+        SELECT id, name, description, created_ms, modified_ms
+        FROM kanban_boards WHERE project_id = ? ORDER BY created_ms DESC
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&project](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, project.id.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, project.id);
         },
         [&boards, this](sqlite3_stmt* stmt) -> bool {
             auto board = std::make_unique<Kanban::Board>();
-            board->id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+            board->id = ReadId(stmt, 0);
             board->name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
             board->description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-            board->createdAt = StringToTimePoint(sqlite3_column_text(stmt, 3) ? (char*)sqlite3_column_text(stmt, 3) : "");
-            board->modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 4) ? (char*)sqlite3_column_text(stmt, 4) : "");
+            board->createdAt = ReadTimestamp(stmt, 3);
+            board->modifiedAt = ReadTimestamp(stmt, 4);
             
             if (LoadColumnsForBoard(*board)) {
                 boards.push_back(std::move(board));
@@ -1427,17 +2764,17 @@ bool KanbanDatabase::LoadColumnsForBoard(Kanban::Board& board)
     
     const std::string sql = R"(
         SELECT id, name, header_color_r, header_color_g, header_color_b, header_color_a,
-               card_limit, is_collapsed, column_order
-        FROM kanban_columns WHERE board_id = ? ORDER BY column_order
+               card_limit, is_collapsed, column_rank
+        FROM kanban_columns WHERE board_id = ? ORDER BY column_rank
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&board](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, board.id.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, board.id);
         },
         [&columns, this](sqlite3_stmt* stmt) -> bool {
             auto column = std::make_unique<Kanban::Column>();
-            column->id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
+            column->id = ReadId(stmt, 0);
             column->name = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
             column->headerColor.r = sqlite3_column_double(stmt, 2);
             column->headerColor.g = sqlite3_column_double(stmt, 3);
@@ -1445,6 +2782,7 @@ bool KanbanDatabase::LoadColumnsForBoard(Kanban::Board& board)
             column->headerColor.a = sqlite3_column_double(stmt, 5);
             column->cardLimit = sqlite3_column_int(stmt, 6);
             column->isCollapsed = sqlite3_column_int(stmt, 7) != 0;
+            column->rank = sqlite3_column_text(stmt, 8) ? (char*)sqlite3_column_text(stmt, 8) : "";
 
             if (LoadCardsForColumn(*column)) {
                 columns.push_back(std::move(column));
@@ -1453,6 +2791,7 @@ bool KanbanDatabase::LoadColumnsForBoard(Kanban::Board& board)
         });
     // Logger::Debug("TEST 29. Loaded {} columns for board {}", columns.size(), board.id);
     board.columns = std::move(columns);
+    board.InvalidateCardIndex();
     return !board.columns.empty();
 }
 
@@ -1462,30 +2801,17 @@ bool KanbanDatabase::LoadCardsForColumn(Kanban::Column& column)
     
     const std::string sql = R"(
         SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
-               assignee, due_date, created_at, modified_at
-        FROM kanban_cards WHERE column_id = ? ORDER BY card_order
+               assignee, due_date, COALESCE(created_ms, unixepoch(created_at) * 1000),
+               COALESCE(modified_ms, unixepoch(modified_at) * 1000), card_rank
+        FROM kanban_cards WHERE column_id = ? ORDER BY card_rank
     )";
 
     m_dbManager->ExecuteQuery(sql,
         [&column](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, column.id.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, column.id);
         },
         [&cards, this](sqlite3_stmt* stmt) -> bool {
-            auto card = std::make_shared<Kanban::Card>();
-            card->id = sqlite3_column_text(stmt, 0) ? (char*)sqlite3_column_text(stmt, 0) : "";
-            card->title = sqlite3_column_text(stmt, 1) ? (char*)sqlite3_column_text(stmt, 1) : "";
-            card->description = sqlite3_column_text(stmt, 2) ? (char*)sqlite3_column_text(stmt, 2) : "";
-            card->priority = static_cast<Kanban::Priority>(sqlite3_column_int(stmt, 3));
-            card->status = static_cast<Kanban::CardStatus>(sqlite3_column_int(stmt, 4));
-            card->color.r = sqlite3_column_double(stmt, 5);
-            card->color.g = sqlite3_column_double(stmt, 6);
-            card->color.b = sqlite3_column_double(stmt, 7);
-            card->color.a = sqlite3_column_double(stmt, 8);
-            card->assignee = sqlite3_column_text(stmt, 9) ? (char*)sqlite3_column_text(stmt, 9) : "";
-            card->dueDate = sqlite3_column_text(stmt, 10) ? (char*)sqlite3_column_text(stmt, 10) : "";
-            card->createdAt = StringToTimePoint(sqlite3_column_text(stmt, 11) ? (char*)sqlite3_column_text(stmt, 11) : "");
-            card->modifiedAt = StringToTimePoint(sqlite3_column_text(stmt, 12) ? (char*)sqlite3_column_text(stmt, 12) : "");
-
+            auto card = ReadCardRow(stmt, 0);
             LoadTagsForCard(*card);
             cards.push_back(std::move(card));
             return true;
@@ -1507,9 +2833,9 @@ bool KanbanDatabase::LoadTagsForCard(Kanban::Card& card)
         ORDER BY t.name
     )";
 
-    m_dbManager->ExecuteQuery(sql,
+    m_dbManager->ExecuteReadQuery(sql,
         [&card](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, card.id.c_str(), -1, SQLITE_STATIC);
+            BindId(stmt, 1, card.id);
         },
         [&tags](sqlite3_stmt* stmt) -> bool {
             const char* tagName = (char*)sqlite3_column_text(stmt, 0);
@@ -1523,3 +2849,248 @@ bool KanbanDatabase::LoadTagsForCard(Kanban::Card& card)
     return !card.tags.empty();
 }
 
+// Undo journal
+bool KanbanDatabase::AppendJournalEntries(const std::vector<Kanban::JournalEntry>& entries, bool discardRedo)
+{
+    if (!m_dbManager->BeginTransaction()) {
+        return false;
+    }
+
+    bool success = !discardRedo ||
+        m_dbManager->ExecuteSQL("DELETE FROM kanban_journal WHERE undone = 1", [](sqlite3_stmt*) {});
+
+    const std::string sql = R"(
+        INSERT INTO kanban_journal (sequence, group_id, type, field, board_id, card_id,
+                                    column_before, column_after, before_value, after_value)
+        VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
+    )";
+
+    for (size_t i = 0; success && i < entries.size(); ++i) {
+        const Kanban::JournalEntry& entry = entries[i];
+        success = m_dbManager->ExecuteSQL(sql, [&entry](sqlite3_stmt* stmt) {
+            sqlite3_bind_int64(stmt, 1, entry.sequence);
+            sqlite3_bind_int64(stmt, 2, entry.group);
+            sqlite3_bind_int(stmt, 3, static_cast<int>(entry.type));
+            sqlite3_bind_int(stmt, 4, static_cast<int>(entry.field));
+            BindId(stmt, 5, entry.boardId);
+            BindId(stmt, 6, entry.cardId);
+            BindId(stmt, 7, entry.columnBefore);
+            BindId(stmt, 8, entry.columnAfter);
+            sqlite3_bind_text(stmt, 9, entry.before.data(), static_cast<int>(entry.before.size()), SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 10, entry.after.data(), static_cast<int>(entry.after.size()), SQLITE_STATIC);
+        });
+    }
+
+    if (success) {
+        success = m_dbManager->CommitTransaction();
+    } else {
+        m_dbManager->RollbackTransaction();
+    }
+
+    return success;
+}
+
+bool KanbanDatabase::SetJournalGroupUndone(int64_t group, bool undone)
+{
+    return m_dbManager->ExecuteSQL("UPDATE kanban_journal SET undone = ? WHERE group_id = ?",
+        [group, undone](sqlite3_stmt* stmt) {
+            sqlite3_bind_int(stmt, 1, undone ? 1 : 0);
+            sqlite3_bind_int64(stmt, 2, group);
+        });
+}
+
+bool KanbanDatabase::TrimJournal(int64_t oldestSequence)
+{
+    return m_dbManager->ExecuteSQL("DELETE FROM kanban_journal WHERE sequence < ?",
+        [oldestSequence](sqlite3_stmt* stmt) {
+            sqlite3_bind_int64(stmt, 1, oldestSequence);
+        });
+}
+
+std::vector<Kanban::JournalEntry> KanbanDatabase::LoadJournal(size_t limit)
+{
+    std::vector<Kanban::JournalEntry> entries;
+
+    const std::string sql = R"(
+        SELECT sequence, group_id, type, field, board_id, card_id, column_before, column_after,
+               before_value, after_value, undone
+        FROM kanban_journal ORDER BY sequence DESC LIMIT ?
+    )";
+
+    auto readText = [](sqlite3_stmt* stmt, int column) {
+        const char* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, column));
+        return text ? std::string(text, static_cast<size_t>(sqlite3_column_bytes(stmt, column))) : std::string();
+    };
+
+    m_dbManager->ExecuteQuery(sql,
+        [limit](sqlite3_stmt* stmt) {
+            sqlite3_bind_int64(stmt, 1, static_cast<int64_t>(limit));
+        },
+        [&entries, &readText](sqlite3_stmt* stmt) -> bool {
+            Kanban::JournalEntry entry;
+            entry.sequence = sqlite3_column_int64(stmt, 0);
+            entry.group = sqlite3_column_int64(stmt, 1);
+            entry.type = static_cast<Kanban::JournalEntry::Type>(sqlite3_column_int(stmt, 2));
+            entry.field = static_cast<Kanban::JournalEntry::Field>(sqlite3_column_int(stmt, 3));
+            entry.boardId = ReadId(stmt, 4);
+            entry.cardId = ReadId(stmt, 5);
+            entry.columnBefore = ReadId(stmt, 6);
+            entry.columnAfter = ReadId(stmt, 7);
+            entry.before = readText(stmt, 8);
+            entry.after = readText(stmt, 9);
+            entry.undone = sqlite3_column_int(stmt, 10) != 0;
+            entries.push_back(std::move(entry));
+            return true;
+        });
+
+    std::reverse(entries.begin(), entries.end());
+    return entries;
+}
+
+bool KanbanDatabase::ArchiveCards(int64_t cutoffMs, std::vector<std::string>& archivedIds, size_t batchSize)
+{
+    const std::string selectSql = R"(
+        SELECT id FROM kanban_cards WHERE status IN (1, 2) AND modified_ms < ?1 LIMIT ?2
+    )";
+    const std::string copySql = R"(
+        INSERT INTO kanban_cards_archive (id, column_id, board_id, title, description, priority, status,
+                                          color_r, color_g, color_b, color_a, assignee, due_date, due_day,
+                                          created_ms, modified_ms, card_rank, tags, archived_ms)
+        SELECT c.id, c.column_id, col.board_id, c.title, c.description, c.priority, c.status,
+               c.color_r, c.color_g, c.color_b, c.color_a, c.assignee, c.due_date, c.due_day,
+               c.created_ms, c.modified_ms, c.card_rank,
+               (SELECT group_concat(t.name, char(31)) FROM kanban_card_tags ct
+                JOIN kanban_tags t ON t.id = ct.tag_id WHERE ct.card_id = c.id),
+               ?2
+        FROM kanban_cards c JOIN kanban_columns col ON col.id = c.column_id
+        WHERE c.id IN (SELECT value FROM json_each(?1))
+    )";
+    const std::string deleteSql = "DELETE FROM kanban_cards WHERE id IN (SELECT value FROM json_each(?1))";
+
+    const int64_t nowMs = Utils::ToEpochMs(std::chrono::system_clock::now());
+    const size_t archivedBefore = archivedIds.size();
+    while (true) {
+        const size_t first = archivedIds.size();
+        std::string idList = "[";
+        bool ok = m_dbManager->ExecuteQuery(selectSql,
+            [cutoffMs, batchSize](sqlite3_stmt* stmt) {
+                sqlite3_bind_int64(stmt, 1, cutoffMs);
+                sqlite3_bind_int64(stmt, 2, static_cast<int64_t>(batchSize));
+            },
+            [&](sqlite3_stmt* stmt) -> bool {
+                archivedIds.push_back(ReadId(stmt, 0));
+                idList += (archivedIds.size() > first + 1 ? "," : "") + std::to_string(sqlite3_column_int64(stmt, 0));
+                return true;
+            });
+        idList += "]";
+        if (!ok) {
+            SetError("Card archive failed: " + m_dbManager->GetLastError());
+            return false;
+        }
+        if (archivedIds.size() == first) {
+            break;
+        }
+
+        if (!m_dbManager->BeginTransaction()) {
+            archivedIds.resize(first);
+            return false;
+        }
+        ok = m_dbManager->ExecuteSQL(copySql, [&idList, nowMs](sqlite3_stmt* stmt) {
+                 sqlite3_bind_text(stmt, 1, idList.c_str(), -1, SQLITE_STATIC);
+                 sqlite3_bind_int64(stmt, 2, nowMs);
+             }) &&
+             m_dbManager->ExecuteSQL(deleteSql, [&idList](sqlite3_stmt* stmt) {
+                 sqlite3_bind_text(stmt, 1, idList.c_str(), -1, SQLITE_STATIC);
+             });
+        if (!ok || !m_dbManager->CommitTransaction()) {
+            SetError("Card archive failed: " + m_dbManager->GetLastError());
+            m_dbManager->RollbackTransaction();
+            archivedIds.resize(first);
+            return false;
+        }
+    }
+
+    if (archivedIds.size() > archivedBefore) {
+        Logger::Info("Archived {} cards", archivedIds.size() - archivedBefore);
+    }
+    return true;
+}
+
+std::vector<Kanban::ArchivedCard> KanbanDatabase::GetArchivedCards(const std::string& boardId, size_t offset, size_t limit)
+{
+    std::vector<Kanban::ArchivedCard> cards;
+
+    const std::string sql = R"(
+        SELECT id, title, description, priority, status, color_r, color_g, color_b, color_a,
+               assignee, due_date, created_ms, modified_ms, card_rank, tags, column_id, archived_ms
+        FROM kanban_cards_archive WHERE board_id = ?1
+        ORDER BY archived_ms DESC, id DESC LIMIT ?2 OFFSET ?3
+    )";
+
+    m_dbManager->ExecuteReadQuery(sql,
+        [&boardId, offset, limit](sqlite3_stmt* stmt) {
+            BindId(stmt, 1, boardId);
+            sqlite3_bind_int64(stmt, 2, static_cast<int64_t>(limit));
+            sqlite3_bind_int64(stmt, 3, static_cast<int64_t>(offset));
+        },
+        [&cards, this](sqlite3_stmt* stmt) -> bool {
+            Kanban::ArchivedCard archived;
+            ReadCardRow(stmt, 0, archived.card);
+            const char* tags = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 14));
+            if (tags && *tags) {
+                archived.card.tags = Utils::Split(tags, '\x1f');
+            }
+            archived.columnId = ReadId(stmt, 15);
+            archived.archivedAt = ReadTimestamp(stmt, 16);
+            cards.push_back(std::move(archived));
+            return true;
+        });
+
+    return cards;
+}
+
+int KanbanDatabase::GetArchivedCardCount(const std::string& boardId)
+{
+    int count = 0;
+    m_dbManager->ExecuteReadQuery("SELECT COUNT(*) FROM kanban_cards_archive WHERE board_id = ?",
+        [&boardId](sqlite3_stmt* stmt) {
+            BindId(stmt, 1, boardId);
+        },
+        [&count](sqlite3_stmt* stmt) -> bool {
+            count = sqlite3_column_int(stmt, 0);
+            return false;
+        });
+    return count;
+}
+
+bool KanbanDatabase::RestoreArchivedCard(const Kanban::Card& card, const std::string& columnId)
+{
+    if (!CheckId(card.id, "card") || !CheckId(columnId, "column")) {
+        return false;
+    }
+
+    if (!m_dbManager->BeginTransaction()) {
+        return false;
+    }
+
+    bool success = DeleteArchivedCard(card.id) && m_dbManager->GetChangesCount() > 0 &&
+                   CreateCards({ CardInsert{ card, columnId } });
+    if (success) {
+        success = m_dbManager->CommitTransaction();
+    } else {
+        SetError("Card restore failed: " + m_dbManager->GetLastError());
+        m_dbManager->RollbackTransaction();
+    }
+    return success;
+}
+
+bool KanbanDatabase::DeleteArchivedCard(const std::string& cardId)
+{
+    if (!CheckId(cardId, "card")) {
+        return false;
+    }
+
+    return m_dbManager->ExecuteSQL("DELETE FROM kanban_cards_archive WHERE id = ?", [&cardId](sqlite3_stmt* stmt) {
+        BindId(stmt, 1, cardId);
+    });
+}
@@ -2,9 +2,12 @@
 
 #include "DatabaseManager.h"
 #include "core/Kanban/KanbanManager.h"
+#include "core/Kanban/KanbanJournal.h"
 #include <vector>
 #include <memory>
 #include <optional>
+#include <cstdint>
+#include <unordered_map>
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -23,6 +26,12 @@ public:
     bool CreateProject(const Kanban::Project& project);
     std::optional<std::unique_ptr<Kanban::Project>> GetProject(const std::string& projectId);
     std::vector<std::unique_ptr<Kanban::Project>> GetAllProjects();
+    std::vector<std::unique_ptr<Kanban::Project>> GetAllProjectsBulk(); // Same tree from one scan per table
+
+    // Lazy loading - projects with board headers only (no columns, card counts stored on
+    // the board), then the columns, cards and tags of one board on demand
+    std::vector<std::unique_ptr<Kanban::Project>> GetProjectHeaders();
+    bool LoadBoardContents(Kanban::Board& board);
     std::vector<std::unique_ptr<Kanban::Project>> GetActiveProjects();
     bool UpdateProject(const Kanban::Project& project);
     bool DeleteProject(const std::string& projectId);
@@ -46,7 +55,8 @@ public:
     std::vector<std::unique_ptr<Kanban::Column>> GetAllColumns();
     bool UpdateColumn(const Kanban::Column& column);
     bool DeleteColumn(const std::string& columnId);
-    bool UpdateColumnOrder(const std::string& boardId, const std::vector<std::string>& columnIds);
+    bool UpdateColumnOrder(const std::string& boardId, const std::vector<std::string>& columnIds); // Rebalances
+    bool MoveColumn(const std::string& columnId, const std::string& rank);
     bool IsColumnExists(const std::string& columnId);
     
     // Card CRUD operations
@@ -61,8 +71,28 @@ public:
     std::vector<std::shared_ptr<Kanban::Card>> GetCardsByAssignee(const std::string& assignee);
     bool UpdateCard(const Kanban::Card& card);
     bool DeleteCard(const std::string& cardId);
-    bool UpdateCardOrder(const std::string& columnId, const std::vector<std::string>& cardIds);
-    bool MoveCard(const std::string& cardId, const std::string& targetColumnId, int targetIndex = -1);
+
+    // Bulk write of changed cards in one transaction, through the cached statements of
+    // the single-card calls: the fields as UpdateCard, the column and card.rank when
+    // columnId is set, and the tag list when updateTags is set
+    struct CardWrite
+    {
+        Kanban::Card card;
+        std::string columnId;
+        bool updateFields = true;
+        bool updateTags = false;
+    };
+    bool UpdateCards(const std::vector<CardWrite>& writes);
+
+    // Insert of a batch of new cards with their tags in one transaction (imports)
+    struct CardInsert
+    {
+        Kanban::Card card;
+        std::string columnId;
+    };
+    bool CreateCards(const std::vector<CardInsert>& inserts);
+    bool UpdateCardOrder(const std::string& columnId, const std::vector<std::string>& cardIds); // Rebalances
+    bool MoveCard(const std::string& cardId, const std::string& targetColumnId, const std::string& rank = "");
     bool IsCardExists(const std::string& cardId);
     
     // Tag operations
@@ -73,6 +103,43 @@ public:
     bool RemoveTagFromCard(const std::string& cardId, const std::string& tagName);
     bool UpdateCardTags(const std::string& cardId, const std::vector<std::string>& tags);
     bool DeleteTag(const std::string& tagName);
+
+    // Full-text search over card title, description, assignee and tags. Every word matches
+    // as a prefix, "quoted words" as a phrase and column:word (title, description, assignee,
+    // tags) in one column only. Best matches first; an empty boardId searches all boards.
+    std::vector<Kanban::SearchHit> SearchCards(const std::string& query, const std::string& boardId = "", size_t limit = 50);
+    static constexpr const char* SEARCH_MATCH_BEGIN = "[";
+    static constexpr const char* SEARCH_MATCH_END = "]";
+
+    // Streaming export: the project, then for each board its header, its columns and the
+    // cards of each column in rank order. Cards come off one cursor per column into a
+    // reused Card, so memory does not grow with the board. A boardId limits the export to
+    // that board, and projectId may then be empty. A callback returning false stops it.
+    struct ExportVisitor
+    {
+        std::function<bool(const Kanban::Project&)> project;
+        std::function<bool(const Kanban::Board&)> board;
+        std::function<bool(const Kanban::Column&)> column;
+        std::function<bool(const Kanban::Card&)> card;
+    };
+    bool ExportProject(const std::string& projectId, const std::string& boardId, const ExportVisitor& visitor);
+
+    // Undo journal (kanban_journal). Appending with discardRedo first deletes the undone
+    // rows, as recording a new change does in memory.
+    bool AppendJournalEntries(const std::vector<Kanban::JournalEntry>& entries, bool discardRedo);
+    bool SetJournalGroupUndone(int64_t group, bool undone);
+    bool TrimJournal(int64_t oldestSequence); // Deletes the rows recorded before it
+    std::vector<Kanban::JournalEntry> LoadJournal(size_t limit); // Newest `limit` entries, oldest first
+
+    // Cold storage (kanban_cards_archive). Completed and archived cards last changed before
+    // cutoffMs move out of kanban_cards in batches, one transaction each, with their tags
+    // folded into the row; hydration, statistics and search no longer see them. The
+    // archive is read a page at a time, most recently archived first.
+    bool ArchiveCards(int64_t cutoffMs, std::vector<std::string>& archivedIds, size_t batchSize = 500);
+    std::vector<Kanban::ArchivedCard> GetArchivedCards(const std::string& boardId, size_t offset, size_t limit);
+    int GetArchivedCardCount(const std::string& boardId);
+    bool RestoreArchivedCard(const Kanban::Card& card, const std::string& columnId); // Back into kanban_cards as given
+    bool DeleteArchivedCard(const std::string& cardId);
     
     // Settings operations
     // bool SetSetting(const std::string& key, const std::string& value);
@@ -81,13 +148,17 @@ public:
     
     // Utility methods
     std::string GetLastError() const { return m_lastError; }
+    std::string ResolveLegacyId(const std::string& legacyId); // Id of a row migrated from a v3 string id
 
 private:
     std::shared_ptr<DatabaseManager> m_dbManager;
     std::string m_lastError;
 
     // Schema versioning
-    static constexpr int CURRENT_SCHEMA_VERSION = 1;
+    static constexpr int CURRENT_SCHEMA_VERSION = 7;
+    static constexpr const char* CARDS_BACKFILL_JOB = "kanban_cards.v2";
+    static constexpr int CARD_INSERT_COLUMNS = 16;
+    static constexpr size_t CARD_INSERT_ROWS = 64; // Rows per statement in CreateCards
     
     // Table creation methods
     bool CreateTables();
@@ -98,14 +169,30 @@ private:
     bool CreateTagsTable();
     bool CreateCardsTagsNormalizationTable();
     bool CreateKanbanSettingTable();
+    bool CreateCardSearchTable();
+    bool CreateJournalTable();
+    bool CreateArchiveTable();
     bool CreateIndexes();
 
     bool MigrateSchema(int fromVersion, int toVersion);
     bool MigrateToVersion1();
+    bool MigrateToVersion2();
+    bool MigrateToVersion3();
+    bool MigrateToVersion4();
+    bool MigrateToVersion5();
+    bool MigrateToVersion6();
+    bool MigrateToVersion7();
     
     // Helper methods for data conversion
-    std::string TimePointToString(const std::chrono::system_clock::time_point& tp) const;
-    std::chrono::system_clock::time_point StringToTimePoint(const std::string& str) const;
+    std::chrono::system_clock::time_point ReadTimestamp(sqlite3_stmt* stmt, int column) const;
+    void BindDueDate(sqlite3_stmt* stmt, int index, const std::string& dueDate) const;
+    void BindCardRow(sqlite3_stmt* stmt, int first, const Kanban::Card& card, const std::string& columnId,
+                     const std::string& rank) const; // The CARD_INSERT_COLUMNS, from first
+    static bool BindId(sqlite3_stmt* stmt, int index, const std::string& id); // Binds NULL, false for a non-id
+    bool CheckId(const std::string& id, const char* kind); // Writes call this first; sets the error
+    static std::string ReadId(sqlite3_stmt* stmt, int column);
+    static int64_t ParseId(const std::string& id); // -1 for text that is not an id
+    static std::string BuildMatchExpression(const std::string& query);
     void SetError(const std::string& error);
     
     // Internal helper methods for loading related data
@@ -113,5 +200,13 @@ private:
     bool LoadColumnsForBoard(Kanban::Board& board);
     bool LoadCardsForColumn(Kanban::Column& column);
     bool LoadTagsForCard(Kanban::Card& card);
-    int GetNextOrder(const std::string& parentId, const std::string& orderColumn, const std::string& parentColumn);
+    bool LoadBoardContents(const std::unordered_map<int64_t, Kanban::Board*>& boardById,
+                           const std::string& boardId);
+    std::vector<std::unique_ptr<Kanban::Project>> LoadProjectRows(
+        std::unordered_map<int64_t, Kanban::Project*>& projectById);
+    std::unique_ptr<Kanban::Board> ReadBoardRow(sqlite3_stmt* stmt, int first) const;
+    std::unique_ptr<Kanban::Column> ReadColumnRow(sqlite3_stmt* stmt, int first) const;
+    std::shared_ptr<Kanban::Card> ReadCardRow(sqlite3_stmt* stmt, int first) const;
+    void ReadCardRow(sqlite3_stmt* stmt, int first, Kanban::Card& card) const;
+    std::string GetNextRank(const std::string& parentId, bool forColumn);
 };
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include "PersistenceWorker.h"
+#include "DatabaseManager.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+PersistenceWorker::PersistenceWorker(std::shared_ptr<DatabaseManager> dbManager)
+    : PersistenceWorker(std::move(dbManager), Options())
+{
+}
+
+PersistenceWorker::PersistenceWorker(std::shared_ptr<DatabaseManager> dbManager, const Options& options)
+    : m_dbManager(std::move(dbManager))
+    , m_options(options)
+{
+    m_options.maxBatchSize = std::max<size_t>(1, m_options.maxBatchSize);
+}
+
+PersistenceWorker::~PersistenceWorker()
+{
+    Stop();
+}
+
+bool PersistenceWorker::Start()
+{
+    if (IsRunning())
+    {
+        return true;
+    }
+
+    if (!m_dbManager || !m_dbManager->IsConnected())
+    {
+        Logger::Error("PersistenceWorker: database is not connected");
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = false;
+    }
+
+    m_thread = std::thread(&PersistenceWorker::WorkerLoop, this);
+    Logger::Debug("PersistenceWorker started (batch {} / {} ms)",
+                  m_options.maxBatchSize, m_options.maxDelay.count());
+    return true;
+}
+
+void PersistenceWorker::Stop()
+{
+    if (!IsRunning())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+    m_thread.join();
+
+    Logger::Debug("PersistenceWorker stopped - {} writes in {} batches, {} failed",
+                  m_stats.completed, m_stats.batches, m_stats.failed);
+}
+
+void PersistenceWorker::Enqueue(WriteCommand command, std::string description)
+{
+    if (!command)
+    {
+        return;
+    }
+
+    PendingWrite write{ std::move(command), std::move(description), std::chrono::steady_clock::now() };
+
+    if (!IsRunning())
+    {
+        // Not started (or already stopped): behave like a plain synchronous write
+        bool success = RunCommand(write);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_stats.enqueued;
+        ++m_stats.completed;
+        if (!success)
+        {
+            ++m_stats.failed;
+            ++m_failedSinceFlush;
+        }
+        return;
+    }
+
+    size_t queued = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(write));
+        ++m_enqueuedSeq;
+        ++m_stats.enqueued;
+        queued = m_queue.size();
+    }
+
+    // The worker sleeps through the group-commit window; only wake it for the
+    // first write of a batch or when the batch is full
+    if (queued == 1 || queued >= m_options.maxBatchSize)
+    {
+        m_workAvailable.notify_one();
+    }
+}
+
+bool PersistenceWorker::Flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (IsRunning())
+    {
+        const uint64_t target = m_enqueuedSeq;
+
+        ++m_pendingFlushes;
+        m_workAvailable.notify_one();
+        m_batchDone.wait(lock, [this, target]() { return m_completedSeq >= target; });
+        --m_pendingFlushes;
+    }
+
+    bool success = m_failedSinceFlush == 0;
+    m_failedSinceFlush = 0;
+    return success;
+}
+
+PersistenceWorker::Stats PersistenceWorker::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats = m_stats;
+    stats.pending = m_queue.size();
+    return stats;
+}
+
+void PersistenceWorker::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_workAvailable.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+
+        if (m_queue.empty())
+        {
+            break; // Stopping and fully drained
+        }
+
+        // Group commit window: keep collecting until the batch is full, the oldest
+        // write is due, or someone is waiting on a flush/shutdown
+        const auto deadline = m_queue.front().enqueuedAt + m_options.maxDelay;
+        m_workAvailable.wait_until(lock, deadline, [this]() {
+            return m_stopping || m_pendingFlushes > 0 || m_queue.size() >= m_options.maxBatchSize;
+        });
+
+        std::deque<PendingWrite> batch;
+        const size_t count = std::min(m_queue.size(), m_options.maxBatchSize);
+        std::move(m_queue.begin(), m_queue.begin() + count, std::back_inserter(batch));
+        m_queue.erase(m_queue.begin(), m_queue.begin() + count);
+
+        lock.unlock();
+        const size_t failed = RunBatch(batch);
+        lock.lock();
+
+        m_completedSeq += count;
+        m_stats.completed += count;
+        m_stats.failed += failed;
+        m_failedSinceFlush += failed;
+        ++m_stats.batches;
+        m_stats.largestBatch = std::max(m_stats.largestBatch, count);
+
+        m_batchDone.notify_all();
+    }
+}
+
+size_t PersistenceWorker::RunBatch(std::deque<PendingWrite>& batch)
+{
+    // Without the outer transaction every command still runs, just in autocommit mode
+    const bool grouped = m_dbManager->BeginTransaction();
+    if (!grouped)
+    {
+        Logger::Error("PersistenceWorker: failed to begin batch transaction: {}", m_dbManager->GetLastError());
+    }
+
+    size_t failed = 0;
+    for (PendingWrite& write : batch)
+    {
+        const bool isolated = m_dbManager->BeginTransaction();
+        const bool success = RunCommand(write);
+
+        if (isolated)
+        {
+            if (success)
+            {
+                m_dbManager->CommitTransaction();
+            }
+            else
+            {
+                m_dbManager->RollbackTransaction();
+            }
+        }
+
+        if (!success)
+        {
+            ++failed;
+        }
+    }
+
+    if (grouped && !m_dbManager->CommitTransaction())
+    {
+        Logger::Error("PersistenceWorker: failed to commit batch of {} writes: {}",
+                      batch.size(), m_dbManager->GetLastError());
+        failed = batch.size();
+    }
+
+    return failed;
+}
+
+bool PersistenceWorker::RunCommand(PendingWrite& write)
+{
+    bool success = false;
+    try
+    {
+        success = write.command();
+    }
+    catch (const std::exception& e)
+    {
+        Logger::Error("PersistenceWorker: write '{}' threw: {}", write.description, e.what());
+        return false;
+    }
+
+    if (!success)
+    {
+        Logger::Error("PersistenceWorker: write '{}' failed: {}", write.description, m_dbManager->GetLastError());
+    }
+    return success;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class DatabaseManager;
+
+// Write-behind queue for database mutations. Commands run on a dedicated thread and
+// are grouped into one transaction per batch, so the UI thread never waits for a WAL
+// commit. Each command runs inside its own savepoint: a failing command is rolled back
+// and logged without discarding the rest of its batch.
+class PersistenceWorker
+{
+public:
+    // Returns false if the write failed
+    using WriteCommand = std::function<bool()>;
+
+    struct Options
+    {
+        size_t maxBatchSize = 256;                  // Commit as soon as this many writes are queued
+        std::chrono::milliseconds maxDelay{ 50 };   // ...or once the oldest queued write is this old
+    };
+
+    struct Stats
+    {
+        uint64_t enqueued = 0;
+        uint64_t completed = 0;
+        uint64_t failed = 0;
+        uint64_t batches = 0;
+        size_t largestBatch = 0;
+        size_t pending = 0;
+    };
+
+    explicit PersistenceWorker(std::shared_ptr<DatabaseManager> dbManager);
+    PersistenceWorker(std::shared_ptr<DatabaseManager> dbManager, const Options& options);
+    ~PersistenceWorker();
+
+    // Lifecycle - Stop() drains the queue before joining the thread
+    bool Start();
+    void Stop();
+    bool IsRunning() const { return m_thread.joinable(); }
+
+    // Queue a write. Commands must capture everything they need by value; while the
+    // worker is stopped they run synchronously on the calling thread instead.
+    void Enqueue(WriteCommand command, std::string description = {});
+
+    // Barrier: blocks until every command queued before the call has been committed.
+    // Returns false if any write failed since the previous Flush().
+    bool Flush();
+
+    Stats GetStats() const;
+
+private:
+    struct PendingWrite
+    {
+        WriteCommand command;
+        std::string description;
+        std::chrono::steady_clock::time_point enqueuedAt;
+    };
+
+    void WorkerLoop();
+    size_t RunBatch(std::deque<PendingWrite>& batch);
+    bool RunCommand(PendingWrite& write);
+
+    std::shared_ptr<DatabaseManager> m_dbManager;
+    Options m_options;
+
+    std::thread m_thread;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_batchDone;
+    std::deque<PendingWrite> m_queue;
+    bool m_stopping = false;
+    int m_pendingFlushes = 0;
+
+    // Sequence numbers let Flush() wait for exactly the writes that preceded it
+    uint64_t m_enqueuedSeq = 0;
+    uint64_t m_completedSeq = 0;
+    uint64_t m_failedSinceFlush = 0;
+    Stats m_stats;
+
+    // Non-copyable
+    PersistenceWorker(const PersistenceWorker&) = delete;
+    PersistenceWorker& operator=(const PersistenceWorker&) = delete;
+};
@@ -1,9 +1,11 @@
 #include "PomodoroDatabase.h"
 #include "core/Logger.h"
+#include "core/Utils.h"
 #include "sqlite3.h"
 #include <sstream>
 #include <iomanip>
 #include <ctime>
+#include <cstdio>
 
 PomodoroDatabase::PomodoroDatabase(std::shared_ptr<DatabaseManager> dbManager)
     : m_dbManager(dbManager)
@@ -26,7 +28,7 @@ bool PomodoroDatabase::Initialize()
     }
 
     // Handle schema migrations
-    int currentVersion = m_dbManager->GetSchemaVersion();
+    int currentVersion = m_dbManager->GetSchemaVersion("pomodoro");
     if (currentVersion < CURRENT_SCHEMA_VERSION)
     {
         Logger::Info("PomodoroDatabase: Migrating schema from version {} to {}", currentVersion, CURRENT_SCHEMA_VERSION);
@@ -37,7 +39,25 @@ bool PomodoroDatabase::Initialize()
             return false;
         }
         
-        m_dbManager->SetSchemaVersion(CURRENT_SCHEMA_VERSION);
+        m_dbManager->SetSchemaVersion("pomodoro", CURRENT_SCHEMA_VERSION);
+    }
+
+    // Sessions recorded before version 2 get their integer columns after startup; date
+    // queries keep using the text column until the job is done
+    SchemaBackfill::Job sessions;
+    sessions.name = SESSIONS_BACKFILL_JOB;
+    sessions.table = "pomodoro_sessions";
+    sessions.assignments = R"(
+        start_ms = COALESCE(start_ms, unixepoch(start_time) * 1000),
+        end_ms = COALESCE(end_ms, unixepoch(end_time) * 1000),
+        day = COALESCE(day, CAST(julianday(date) - 2440587.5 AS INTEGER)))";
+    sessions.onComplete = {
+        "CREATE INDEX IF NOT EXISTS idx_pomodoro_sessions_day ON pomodoro_sessions(day, start_ms);",
+        "DROP INDEX IF EXISTS idx_pomodoro_sessions_date;" };
+
+    if (!m_dbManager->GetSchemaBackfill().AddJob(sessions))
+    {
+        Logger::Warning("PomodoroDatabase: session timestamp backfill not scheduled");
     }
 
     Logger::Info("PomodoroDatabase initialized successfully");
@@ -100,10 +120,12 @@ bool PomodoroDatabase::CreateSessionsTable()
             completed BOOLEAN NOT NULL DEFAULT 0,
             paused_seconds INTEGER NOT NULL DEFAULT 0,
             date TEXT NOT NULL, -- YYYY-MM-DD format
-            created_at DATETIME DEFAULT CURRENT_TIMESTAMP
+            created_at DATETIME DEFAULT CURRENT_TIMESTAMP,
+            start_ms INTEGER,   -- Epoch milliseconds; start_time/end_time are the v1 columns
+            end_ms INTEGER,
+            day INTEGER         -- Days since 1970-01-01 of date
         );
         
-        CREATE INDEX IF NOT EXISTS idx_pomodoro_sessions_date ON pomodoro_sessions(date);
         CREATE INDEX IF NOT EXISTS idx_pomodoro_sessions_type ON pomodoro_sessions(session_type);
         CREATE INDEX IF NOT EXISTS idx_pomodoro_sessions_completed ON pomodoro_sessions(completed);
     )";
@@ -146,6 +168,9 @@ bool PomodoroDatabase::MigrateSchema(int fromVersion, int toVersion)
             case 0: // Migrate from 0 to 1
                 success = MigrateToVersion1();
                 break;
+            case 1: // Integer timestamps and day numbers
+                success = MigrateToVersion2();
+                break;
             default:
                 Logger::Warning("PomodoroDatabase: Unknown migration version {}", version + 1);
                 break;
@@ -168,6 +193,23 @@ bool PomodoroDatabase::MigrateToVersion1()
     return true;
 }
 
+bool PomodoroDatabase::MigrateToVersion2()
+{
+    // Only adds the columns - filling them is the backfill job's work, so a long
+    // session history does not hold up startup
+    const char* columns[] = { "start_ms", "end_ms", "day" };
+
+    for (const char* column : columns)
+    {
+        if (!m_dbManager->ColumnExists("pomodoro_sessions", column) &&
+            !m_dbManager->ExecuteSQL(std::string("ALTER TABLE pomodoro_sessions ADD COLUMN ") + column + " INTEGER;"))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool PomodoroDatabase::SaveConfiguration(const PomodoroTimer::PomodoroConfig& config)
 {
     const std::string sql = R"(
@@ -230,7 +272,7 @@ bool PomodoroDatabase::LoadConfiguration(PomodoroTimer::PomodoroConfig& config)
 
     bool found = false;
     
-    bool success = m_dbManager->ExecuteQuery(sql, [&config, &found](sqlite3_stmt* stmt) {
+    bool success = m_dbManager->ExecuteReadQuery(sql, [&config, &found](sqlite3_stmt* stmt) {
         config.workDurationMinutes = sqlite3_column_int(stmt, 0);
         config.shortBreakMinutes = sqlite3_column_int(stmt, 1);
         config.longBreakMinutes = sqlite3_column_int(stmt, 2);
@@ -281,14 +323,21 @@ bool PomodoroDatabase::ConfigurationExists()
 int PomodoroDatabase::StartSession(const std::string& sessionType, int sessionNumber, const std::string& date)
 {
     const std::string sql = R"(
-        INSERT INTO pomodoro_sessions (session_type, session_number, start_time, date)
-        VALUES (?, ?, CURRENT_TIMESTAMP, ?);
+        INSERT INTO pomodoro_sessions (session_type, session_number, start_time, date, start_ms, day)
+        VALUES (?, ?, CURRENT_TIMESTAMP, ?, ?, ?);
     )";
 
+    const int64_t startMs = Utils::ToEpochMs(std::chrono::system_clock::now());
+
+    // Keep the insert and the rowid read together while the persistence worker writes
+    auto lock = m_dbManager->Lock();
+
     bool success = m_dbManager->ExecuteSQL(sql, [&](sqlite3_stmt* stmt) {
         sqlite3_bind_text(stmt, 1, sessionType.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_int(stmt, 2, sessionNumber);
         sqlite3_bind_text(stmt, 3, date.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 4, startMs);
+        BindDate(stmt, 5, date, true);
     });
 
     if (success)
@@ -305,14 +354,16 @@ bool PomodoroDatabase::EndSession(int sessionId, bool completed, int pausedSecon
 {
     const std::string sql = R"(
         UPDATE pomodoro_sessions 
-        SET end_time = CURRENT_TIMESTAMP, completed = ?, paused_seconds = ?
+        SET end_ms = ?, completed = ?, paused_seconds = ?
         WHERE id = ?;
     )";
 
+    const int64_t endMs = Utils::ToEpochMs(std::chrono::system_clock::now());
     bool success = m_dbManager->ExecuteSQL(sql, [&](sqlite3_stmt* stmt) {
-        sqlite3_bind_int(stmt, 1, completed ? 1 : 0);
-        sqlite3_bind_int(stmt, 2, pausedSeconds);
-        sqlite3_bind_int(stmt, 3, sessionId);
+        sqlite3_bind_int64(stmt, 1, endMs);
+        sqlite3_bind_int(stmt, 2, completed ? 1 : 0);
+        sqlite3_bind_int(stmt, 3, pausedSeconds);
+        sqlite3_bind_int(stmt, 4, sessionId);
     });
 
     if (success)
@@ -343,39 +394,23 @@ bool PomodoroDatabase::UpdateSessionPausedTime(int sessionId, int pausedSeconds)
 
 std::vector<PomodoroSession> PomodoroDatabase::GetSessionsForDate(const std::string& date)
 {
-    const std::string sql = R"(
-        SELECT id, session_type, session_number, start_time, end_time, completed, paused_seconds, date
+    const bool byDay = SessionDaysReady();
+    const std::string sql = std::string(R"(
+        SELECT id, session_type, session_number, COALESCE(start_ms, unixepoch(start_time) * 1000) AS start,
+               COALESCE(end_ms, unixepoch(end_time) * 1000), completed, paused_seconds, date
         FROM pomodoro_sessions 
-        WHERE date = ?
-        ORDER BY start_time ASC;
+        WHERE )") + (byDay ? "day = ?" : "date = ?") + R"(
+        ORDER BY start ASC;
     )";
 
     std::vector<PomodoroSession> sessions;
     
     m_dbManager->ExecuteQuery(sql, 
-        [&date](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, date.c_str(), -1, SQLITE_STATIC);
+        [&date, byDay, this](sqlite3_stmt* stmt) {
+            BindDate(stmt, 1, date, byDay);
         },
         [&sessions, this](sqlite3_stmt* stmt) {
-            PomodoroSession session;
-            session.id = sqlite3_column_int(stmt, 0);
-            session.sessionType = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-            session.sessionNumber = sqlite3_column_int(stmt, 2);
-            
-            std::string startTimeStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-            session.startTime = ParseDateTime(startTimeStr);
-            
-            if (sqlite3_column_type(stmt, 4) != SQLITE_NULL)
-            {
-                std::string endTimeStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
-                session.endTime = ParseDateTime(endTimeStr);
-            }
-            
-            session.completed = sqlite3_column_int(stmt, 5) != 0;
-            session.pausedSeconds = sqlite3_column_int(stmt, 6);
-            session.date = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 7));
-            
-            sessions.push_back(session);
+            sessions.push_back(ReadSessionRow(stmt));
             return true; // Continue
         }
     );
@@ -385,40 +420,30 @@ std::vector<PomodoroSession> PomodoroDatabase::GetSessionsForDate(const std::str
 
 std::vector<PomodoroSession> PomodoroDatabase::GetSessionsForDateRange(const std::string& startDate, const std::string& endDate)
 {
-    const std::string sql = R"(
-        SELECT id, session_type, session_number, start_time, end_time, completed, paused_seconds, date
+    // Once every row has its day number the range is an integer scan of (day, start_ms)
+    const bool byDay = SessionDaysReady();
+    const std::string sql = byDay ? R"(
+        SELECT id, session_type, session_number, start_ms, end_ms, completed, paused_seconds, date
+        FROM pomodoro_sessions 
+        WHERE day BETWEEN ? AND ?
+        ORDER BY day ASC, start_ms ASC;
+    )" : R"(
+        SELECT id, session_type, session_number, COALESCE(start_ms, unixepoch(start_time) * 1000) AS start,
+               COALESCE(end_ms, unixepoch(end_time) * 1000), completed, paused_seconds, date
         FROM pomodoro_sessions 
         WHERE date BETWEEN ? AND ?
-        ORDER BY date ASC, start_time ASC;
+        ORDER BY date ASC, start ASC;
     )";
 
     std::vector<PomodoroSession> sessions;
     
-    m_dbManager->ExecuteQuery(sql, 
-        [&](sqlite3_stmt* stmt) {
-            sqlite3_bind_text(stmt, 1, startDate.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_text(stmt, 2, endDate.c_str(), -1, SQLITE_STATIC);
+    m_dbManager->ExecuteReadQuery(sql, 
+        [&, this](sqlite3_stmt* stmt) {
+            BindDate(stmt, 1, startDate, byDay);
+            BindDate(stmt, 2, endDate, byDay);
         },
         [&sessions, this](sqlite3_stmt* stmt) {
-            PomodoroSession session;
-            session.id = sqlite3_column_int(stmt, 0);
-            session.sessionType = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-            session.sessionNumber = sqlite3_column_int(stmt, 2);
-            
-            std::string startTimeStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-            session.startTime = ParseDateTime(startTimeStr);
-            
-            if (sqlite3_column_type(stmt, 4) != SQLITE_NULL)
-            {
-                std::string endTimeStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
-                session.endTime = ParseDateTime(endTimeStr);
-            }
-            
-            session.completed = sqlite3_column_int(stmt, 5) != 0;
-            session.pausedSeconds = sqlite3_column_int(stmt, 6);
-            session.date = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 7));
-            
-            sessions.push_back(session);
+            sessions.push_back(ReadSessionRow(stmt));
             return true; // Continue
         }
     );
@@ -429,7 +454,8 @@ std::vector<PomodoroSession> PomodoroDatabase::GetSessionsForDateRange(const std
 PomodoroSession PomodoroDatabase::GetSession(int sessionId)
 {
     const std::string sql = R"(
-        SELECT id, session_type, session_number, start_time, end_time, completed, paused_seconds, date
+        SELECT id, session_type, session_number, COALESCE(start_ms, unixepoch(start_time) * 1000),
+               COALESCE(end_ms, unixepoch(end_time) * 1000), completed, paused_seconds, date
         FROM pomodoro_sessions 
         WHERE id = ?;
     )";
@@ -441,23 +467,7 @@ PomodoroSession PomodoroDatabase::GetSession(int sessionId)
             sqlite3_bind_int(stmt, 1, sessionId);
         },
         [&session, this](sqlite3_stmt* stmt) {
-            session.id = sqlite3_column_int(stmt, 0);
-            session.sessionType = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-            session.sessionNumber = sqlite3_column_int(stmt, 2);
-            
-            std::string startTimeStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-            session.startTime = ParseDateTime(startTimeStr);
-            
-            if (sqlite3_column_type(stmt, 4) != SQLITE_NULL)
-            {
-                std::string endTimeStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
-                session.endTime = ParseDateTime(endTimeStr);
-            }
-            
-            session.completed = sqlite3_column_int(stmt, 5) != 0;
-            session.pausedSeconds = sqlite3_column_int(stmt, 6);
-            session.date = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 7));
-            
+            session = ReadSessionRow(stmt);
             return false; // Stop after first row
         }
     );
@@ -468,42 +478,52 @@ PomodoroSession PomodoroDatabase::GetSession(int sessionId)
 PomodoroSession PomodoroDatabase::GetLastSession()
 {
     const std::string sql = R"(
-        SELECT id, session_type, session_number, start_time, end_time, completed, paused_seconds, date
+        SELECT id, session_type, session_number, COALESCE(start_ms, unixepoch(start_time) * 1000) AS start,
+               COALESCE(end_ms, unixepoch(end_time) * 1000), completed, paused_seconds, date
         FROM pomodoro_sessions 
-        ORDER BY start_time DESC 
+        ORDER BY start DESC 
         LIMIT 1;
     )";
 
     PomodoroSession session;
     
     m_dbManager->ExecuteQuery(sql, [&session, this](sqlite3_stmt* stmt) {
-        session.id = sqlite3_column_int(stmt, 0);
-        session.sessionType = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-        session.sessionNumber = sqlite3_column_int(stmt, 2);
-        
-        std::string startTimeStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-        session.startTime = ParseDateTime(startTimeStr);
-        
-        if (sqlite3_column_type(stmt, 4) != SQLITE_NULL)
-        {
-            std::string endTimeStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
-            session.endTime = ParseDateTime(endTimeStr);
-        }
-        
-        session.completed = sqlite3_column_int(stmt, 5) != 0;
-        session.pausedSeconds = sqlite3_column_int(stmt, 6);
-        session.date = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 7));
-        
+        session = ReadSessionRow(stmt);
         return false; // Stop after first row
     });
 
     return session;
 }
 
+PomodoroSession PomodoroDatabase::ReadSessionRow(sqlite3_stmt* stmt) const
+{
+    // id, session_type, session_number, start ms, end ms, completed, paused_seconds, date
+    PomodoroSession session;
+    session.id = sqlite3_column_int(stmt, 0);
+    session.sessionType = sqlite3_column_text(stmt, 1) ? reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1)) : "";
+    session.sessionNumber = sqlite3_column_int(stmt, 2);
+
+    if (sqlite3_column_type(stmt, 3) != SQLITE_NULL)
+    {
+        session.startTime = Utils::FromEpochMs(sqlite3_column_int64(stmt, 3));
+    }
+
+    if (sqlite3_column_type(stmt, 4) != SQLITE_NULL)
+    {
+        session.endTime = Utils::FromEpochMs(sqlite3_column_int64(stmt, 4));
+    }
+
+    session.completed = sqlite3_column_int(stmt, 5) != 0;
+    session.pausedSeconds = sqlite3_column_int(stmt, 6);
+    session.date = sqlite3_column_text(stmt, 7) ? reinterpret_cast<const char*>(sqlite3_column_text(stmt, 7)) : "";
+    return session;
+}
+
 bool PomodoroDatabase::UpdateDailyStatistics(const std::string& date)
 {
     // Calculate statistics from sessions for this date
-    const std::string sessionSQL = R"(
+    const bool byDay = SessionDaysReady();
+    const std::string sessionSQL = std::string(R"(
         SELECT 
             COUNT(*) as total_sessions,
             SUM(CASE WHEN completed = 1 THEN 1 ELSE 0 END) as completed_sessions,
@@ -513,8 +533,7 @@ bool PomodoroDatabase::UpdateDailyStatistics(const std::string& date)
                      ELSE 0 END) as total_break_time,
             SUM(paused_seconds) as total_paused_time
         FROM pomodoro_sessions 
-        WHERE date = ?;
-    )";
+        WHERE )") + (byDay ? "day = ?;" : "date = ?;");
 
     // Load current configuration to get durations
     PomodoroTimer::PomodoroConfig config;
@@ -531,7 +550,7 @@ bool PomodoroDatabase::UpdateDailyStatistics(const std::string& date)
             sqlite3_bind_int(stmt, 1, config.workDurationMinutes);
             sqlite3_bind_int(stmt, 2, config.shortBreakMinutes);
             sqlite3_bind_int(stmt, 3, config.longBreakMinutes);
-            sqlite3_bind_text(stmt, 4, date.c_str(), -1, SQLITE_STATIC);
+            BindDate(stmt, 4, date, byDay);
         },
         [&](sqlite3_stmt* stmt) {
             totalSessions = sqlite3_column_int(stmt, 0);
@@ -573,7 +592,7 @@ PomodoroStatistics PomodoroDatabase::GetDailyStatistics(const std::string& date)
     PomodoroStatistics stats;
     stats.date = date;
 
-    m_dbManager->ExecuteQuery(sql,
+    m_dbManager->ExecuteReadQuery(sql,
         [&date](sqlite3_stmt* stmt) {
             sqlite3_bind_text(stmt, 1, date.c_str(), -1, SQLITE_STATIC);
         },
@@ -595,15 +614,101 @@ PomodoroStatistics PomodoroDatabase::GetDailyStatistics(const std::string& date)
     return stats;
 }
 
-bool PomodoroDatabase::ClearOldSessions(int daysToKeep)
+std::vector<PomodoroStatistics> PomodoroDatabase::GetStatisticsForDateRange(const std::string& startDate, const std::string& endDate)
 {
     const std::string sql = R"(
+        SELECT date, total_sessions, completed_sessions, total_work_time, total_break_time, total_paused_time, last_updated
+        FROM pomodoro_statistics 
+        WHERE date BETWEEN ? AND ?
+        ORDER BY date ASC;
+    )";
+
+    std::vector<PomodoroStatistics> statistics;
+
+    m_dbManager->ExecuteReadQuery(sql,
+        [&](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, startDate.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 2, endDate.c_str(), -1, SQLITE_STATIC);
+        },
+        [&statistics, this](sqlite3_stmt* stmt) {
+            PomodoroStatistics stats;
+            stats.date = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+            stats.totalSessions = sqlite3_column_int(stmt, 1);
+            stats.completedSessions = sqlite3_column_int(stmt, 2);
+            stats.totalWorkTime = sqlite3_column_int(stmt, 3);
+            stats.totalBreakTime = sqlite3_column_int(stmt, 4);
+            stats.totalPausedTime = sqlite3_column_int(stmt, 5);
+
+            std::string lastUpdatedStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 6));
+            stats.lastUpdated = ParseDateTime(lastUpdatedStr);
+
+            statistics.push_back(stats);
+            return true; // Continue
+        }
+    );
+
+    return statistics;
+}
+
+PomodoroDatabase::WeeklyStats PomodoroDatabase::GetWeeklyStatistics(const std::string& date)
+{
+    WeeklyStats stats;
+    stats.weekStartDate = GetWeekStartDate(date);
+
+    int activeDays = 0;
+    AggregateSessions(stats.weekStartDate, AddDays(stats.weekStartDate, 6),
+                      stats.totalSessions, stats.completedSessions, stats.totalWorkMinutes, activeDays);
+
+    if (stats.totalSessions > 0)
+    {
+        stats.completionRate = static_cast<float>(stats.completedSessions) / stats.totalSessions * 100.0f;
+    }
+
+    return stats;
+}
+
+PomodoroDatabase::MonthlyStats PomodoroDatabase::GetMonthlyStatistics(int year, int month)
+{
+    MonthlyStats stats;
+    stats.year = year;
+    stats.month = month;
+
+    // First to last day of the month, the day before the 1st of the next one
+    const int64_t firstDay = Utils::DaysFromCivil(year, month, 1);
+    const int64_t nextMonth = month == 12 ? Utils::DaysFromCivil(year + 1, 1, 1) : Utils::DaysFromCivil(year, month + 1, 1);
+
+    AggregateSessions(Utils::FormatDayNumber(firstDay), Utils::FormatDayNumber(nextMonth - 1),
+                      stats.totalSessions, stats.completedSessions, stats.totalWorkMinutes, stats.activeDays);
+
+    if (stats.totalSessions > 0)
+    {
+        stats.completionRate = static_cast<float>(stats.completedSessions) / stats.totalSessions * 100.0f;
+    }
+
+    return stats;
+}
+
+bool PomodoroDatabase::ClearOldSessions(int daysToKeep)
+{
+    const bool byDay = SessionDaysReady();
+    const std::string sql = byDay ? R"(
+        DELETE FROM pomodoro_sessions 
+        WHERE day < ?;
+    )" : R"(
         DELETE FROM pomodoro_sessions 
         WHERE date < date('now', '-' || ? || ' days');
     )";
 
-    bool success = m_dbManager->ExecuteSQL(sql, [daysToKeep](sqlite3_stmt* stmt) {
-        sqlite3_bind_int(stmt, 1, daysToKeep);
+    const int64_t cutoff = Utils::GetTodayDayNumber() - daysToKeep;
+    bool success = m_dbManager->ExecuteSQL(sql, [daysToKeep, byDay, cutoff](sqlite3_stmt* stmt) {
+        if (byDay)
+        {
+            sqlite3_bind_int64(stmt, 1, cutoff);
+        }
+        else
+        {
+            sqlite3_bind_int(stmt, 1, daysToKeep);
+        }
     });
 
     if (success)
@@ -683,6 +788,98 @@ std::chrono::system_clock::time_point PomodoroDatabase::ParseDateTime(const std:
     return std::chrono::system_clock::from_time_t(std::mktime(&tm));
 }
 
+std::string PomodoroDatabase::GetWeekStartDate(const std::string& date) const
+{
+    int64_t day = 0;
+    if (!Utils::ParseDayNumber(date, day))
+    {
+        return date;
+    }
+
+    // 1970-01-01 was a Thursday; weeks start on Monday
+    const int64_t daysSinceMonday = ((day + 3) % 7 + 7) % 7;
+    return Utils::FormatDayNumber(day - daysSinceMonday);
+}
+
+std::string PomodoroDatabase::AddDays(const std::string& date, int days) const
+{
+    int64_t day = 0;
+    if (!Utils::ParseDayNumber(date, day))
+    {
+        return date;
+    }
+
+    return Utils::FormatDayNumber(day + days);
+}
+
+bool PomodoroDatabase::SessionDaysReady() const
+{
+    return m_dbManager->GetSchemaBackfill().IsComplete(SESSIONS_BACKFILL_JOB);
+}
+
+void PomodoroDatabase::BindDate(sqlite3_stmt* stmt, int index, const std::string& date, bool asDayNumber) const
+{
+    int64_t day = 0;
+    if (!asDayNumber)
+    {
+        sqlite3_bind_text(stmt, index, date.c_str(), -1, SQLITE_TRANSIENT);
+    }
+    else if (Utils::ParseDayNumber(date, day))
+    {
+        sqlite3_bind_int64(stmt, index, day);
+    }
+    else
+    {
+        sqlite3_bind_null(stmt, index);
+    }
+}
+
+bool PomodoroDatabase::AggregateSessions(const std::string& startDate, const std::string& endDate,
+                                         int& totalSessions, int& completedSessions,
+                                         int& workMinutes, int& activeDays)
+{
+    const bool byDay = SessionDaysReady();
+    const std::string sql = byDay ? R"(
+        SELECT 
+            COUNT(*),
+            SUM(CASE WHEN completed = 1 THEN 1 ELSE 0 END),
+            SUM(CASE WHEN session_type = 'work' AND completed = 1 THEN ? ELSE 0 END),
+            COUNT(DISTINCT day)
+        FROM pomodoro_sessions 
+        WHERE day BETWEEN ? AND ?;
+    )" : R"(
+        SELECT 
+            COUNT(*),
+            SUM(CASE WHEN completed = 1 THEN 1 ELSE 0 END),
+            SUM(CASE WHEN session_type = 'work' AND completed = 1 THEN ? ELSE 0 END),
+            COUNT(DISTINCT date)
+        FROM pomodoro_sessions 
+        WHERE date BETWEEN ? AND ?;
+    )";
+
+    // Work time is credited at the configured duration, as in UpdateDailyStatistics
+    PomodoroTimer::PomodoroConfig config;
+    if (!LoadConfiguration(config))
+    {
+        config = PomodoroTimer::PomodoroConfig();
+    }
+
+    return m_dbManager->ExecuteReadQuery(sql,
+        [&](sqlite3_stmt* stmt) {
+            sqlite3_bind_int(stmt, 1, config.workDurationMinutes);
+            BindDate(stmt, 2, startDate, byDay);
+            BindDate(stmt, 3, endDate, byDay);
+        },
+        [&](sqlite3_stmt* stmt) {
+            totalSessions = sqlite3_column_int(stmt, 0);
+            completedSessions = sqlite3_column_int(stmt, 1);
+            workMinutes = sqlite3_column_int(stmt, 2);
+            activeDays = sqlite3_column_int(stmt, 3);
+            return false; // Single row
+        }
+    );
+}
+
 // Additional methods can be implemented as needed
 bool PomodoroDatabase::ExportData(const std::string& filePath)
 {
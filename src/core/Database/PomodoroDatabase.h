@@ -99,12 +99,19 @@ private:
     std::shared_ptr<DatabaseManager> m_dbManager;
     
     // Schema versions
-    static constexpr int CURRENT_SCHEMA_VERSION = 1;
+    static constexpr int CURRENT_SCHEMA_VERSION = 2;
+    static constexpr const char* SESSIONS_BACKFILL_JOB = "pomodoro_sessions.v2";
     
     // Helper methods
     std::string FormatDateTime(const std::chrono::system_clock::time_point& timePoint) const;
     std::chrono::system_clock::time_point ParseDateTime(const std::string& dateTimeStr) const;
     std::string GetWeekStartDate(const std::string& date) const;
+    std::string AddDays(const std::string& date, int days) const;
+    bool SessionDaysReady() const; // Every session has its day number
+    void BindDate(sqlite3_stmt* stmt, int index, const std::string& date, bool asDayNumber) const;
+    PomodoroSession ReadSessionRow(sqlite3_stmt* stmt) const;
+    bool AggregateSessions(const std::string& startDate, const std::string& endDate,
+                           int& totalSessions, int& completedSessions, int& workMinutes, int& activeDays);
     
     // Table creation methods
     bool CreateConfigurationTable();
@@ -113,4 +120,5 @@ private:
     
     // Migration methods
     bool MigrateToVersion1();
+    bool MigrateToVersion2();
 };
\ No newline at end of file
@@ -0,0 +1,406 @@
+#include "QueryProfiler.h"
+#include "core/Logger.h"
+#include "sqlite3.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace
+{
+    constexpr size_t kMaxSamplesPerStatement = 1024;
+    constexpr size_t kMaxSlowQueries = 256;
+
+    double NsToMs(uint64_t ns)
+    {
+        return static_cast<double>(ns) / 1e6;
+    }
+
+    double Percentile(const std::vector<uint64_t>& sorted, double p)
+    {
+        if (sorted.empty()) return 0.0;
+        size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return NsToMs(sorted[std::min(index, sorted.size() - 1)]);
+    }
+
+    std::string JsonEscape(const std::string& text)
+    {
+        std::string result;
+        result.reserve(text.size() + 8);
+        for (char c : text)
+        {
+            switch (c)
+            {
+                case '"':  result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\n': result += "\\n"; break;
+                case '\r': result += "\\r"; break;
+                case '\t': result += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char buffer[8];
+                        std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned char>(c));
+                        result += buffer;
+                    }
+                    else
+                    {
+                        result += c;
+                    }
+            }
+        }
+        return result;
+    }
+}
+
+QueryProfiler::QueryProfiler(double slowThresholdMs)
+    : m_slowThresholdMs(slowThresholdMs)
+{
+}
+
+QueryProfiler::~QueryProfiler()
+{
+    if (m_explainDatabase)
+    {
+        sqlite3_close(m_explainDatabase);
+    }
+}
+
+bool QueryProfiler::AttachExplainDatabase(const std::string& databasePath)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_explainDatabase)
+    {
+        sqlite3_close(m_explainDatabase);
+        m_explainDatabase = nullptr;
+    }
+
+    if (databasePath.empty() || databasePath == ":memory:")
+    {
+        return false;
+    }
+
+    if (sqlite3_open_v2(databasePath.c_str(), &m_explainDatabase, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK)
+    {
+        Logger::Warning("QueryProfiler: cannot open {} for query plans", databasePath);
+        sqlite3_close(m_explainDatabase);
+        m_explainDatabase = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void QueryProfiler::Trace(sqlite3* database)
+{
+    if (database)
+    {
+        sqlite3_trace_v2(database, SQLITE_TRACE_STMT | SQLITE_TRACE_PROFILE | SQLITE_TRACE_ROW, &QueryProfiler::TraceCallback, this);
+    }
+}
+
+void QueryProfiler::Untrace(sqlite3* database)
+{
+    if (database)
+    {
+        sqlite3_trace_v2(database, 0, nullptr, nullptr);
+    }
+}
+
+int QueryProfiler::TraceCallback(unsigned type, void* context, void* p, void* x)
+{
+    auto* profiler = static_cast<QueryProfiler*>(context);
+    auto* statement = static_cast<sqlite3_stmt*>(p);
+
+    if (type == SQLITE_TRACE_STMT)
+    {
+        profiler->OnStatement(statement);
+    }
+    else if (type == SQLITE_TRACE_ROW)
+    {
+        profiler->OnRow(statement);
+    }
+    else if (type == SQLITE_TRACE_PROFILE)
+    {
+        profiler->OnProfile(statement, static_cast<int64_t>(*static_cast<sqlite3_int64*>(x)));
+    }
+    return 0;
+}
+
+void QueryProfiler::OnStatement(sqlite3_stmt* statement)
+{
+    // Also fired for each trigger sub-program; keep the outermost start
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running.emplace(statement, Running{ std::chrono::steady_clock::now(), 0 });
+}
+
+void QueryProfiler::OnRow(sqlite3_stmt* statement)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_running[statement].rows;
+}
+
+void QueryProfiler::OnProfile(sqlite3_stmt* statement, int64_t elapsedNs)
+{
+    const char* text = sqlite3_sql(statement);
+    if (!text)
+    {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    uint64_t ns = static_cast<uint64_t>(std::max<int64_t>(0, elapsedNs));
+    std::string sql(text);
+    std::string plan;
+    bool slow = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Entry& entry = m_entries[sql];
+
+        auto running = m_running.find(statement);
+        if (running != m_running.end())
+        {
+            if (running->second.start.time_since_epoch().count() != 0)
+            {
+                ns = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - running->second.start).count());
+            }
+            entry.rows += running->second.rows;
+            m_running.erase(running);
+        }
+
+        ++entry.calls;
+        entry.totalNs += ns;
+        entry.maxNs = std::max(entry.maxNs, ns);
+
+        // Reservoir sampling keeps the percentiles unbiased with bounded memory
+        if (entry.samples.size() < kMaxSamplesPerStatement)
+        {
+            entry.samples.push_back(ns);
+        }
+        else
+        {
+            m_sampleSeed = m_sampleSeed * 6364136223846793005ull + 1442695040888963407ull;
+            uint64_t slot = (m_sampleSeed >> 17) % entry.calls;
+            if (slot < kMaxSamplesPerStatement)
+            {
+                entry.samples[slot] = ns;
+            }
+        }
+
+        if (NsToMs(ns) >= m_slowThresholdMs)
+        {
+            slow = true;
+            plan = ExplainLocked(sql);
+
+            SlowQuery query;
+            query.sql = Normalize(sql);
+            query.durationMs = NsToMs(ns);
+            query.plan = plan;
+            query.timestamp = std::chrono::system_clock::now();
+
+            m_slowQueries.push_back(std::move(query));
+            if (m_slowQueries.size() > kMaxSlowQueries)
+            {
+                m_slowQueries.pop_front();
+            }
+        }
+    }
+
+    if (slow)
+    {
+        Logger::Warning("Slow query ({} ms): {}{}", NsToMs(ns), Normalize(sql),
+                        plan.empty() ? std::string() : "\n" + plan);
+    }
+}
+
+std::string QueryProfiler::ExplainLocked(const std::string& sql)
+{
+    auto cached = m_plans.find(sql);
+    if (cached != m_plans.end())
+    {
+        return cached->second;
+    }
+
+    std::string plan;
+    sqlite3_stmt* statement = nullptr;
+    const std::string explain = "EXPLAIN QUERY PLAN " + sql;
+
+    if (m_explainDatabase &&
+        sqlite3_prepare_v2(m_explainDatabase, explain.c_str(), -1, &statement, nullptr) == SQLITE_OK)
+    {
+        // Columns: id, parent, notused, detail - indent children under their parent
+        std::map<int, int> depth;
+        while (sqlite3_step(statement) == SQLITE_ROW)
+        {
+            int id = sqlite3_column_int(statement, 0);
+            int parent = sqlite3_column_int(statement, 1);
+            const char* detail = reinterpret_cast<const char*>(sqlite3_column_text(statement, 3));
+
+            int level = depth.count(parent) ? depth[parent] + 1 : 0;
+            depth[id] = level;
+
+            if (!plan.empty()) plan += "\n";
+            plan += std::string(static_cast<size_t>(level) * 2, ' ') + (detail ? detail : "");
+        }
+    }
+    sqlite3_finalize(statement);
+
+    m_plans[sql] = plan;
+    return plan;
+}
+
+void QueryProfiler::RecordCacheHit(const std::string& sql)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_entries[sql].cacheHits;
+}
+
+std::vector<QueryProfiler::StatementStats> QueryProfiler::GetStatementStats() const
+{
+    // Statements that only differ in whitespace are reported together
+    struct Merged
+    {
+        StatementStats stats;
+        std::vector<uint64_t> samples;
+    };
+    std::unordered_map<std::string, Merged> merged;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [sql, entry] : m_entries)
+        {
+            Merged& target = merged[Normalize(sql)];
+            target.stats.calls += entry.calls;
+            target.stats.totalMs += NsToMs(entry.totalNs);
+            target.stats.maxMs = std::max(target.stats.maxMs, NsToMs(entry.maxNs));
+            target.stats.rows += entry.rows;
+            target.stats.cacheHits += entry.cacheHits;
+            target.samples.insert(target.samples.end(), entry.samples.begin(), entry.samples.end());
+        }
+    }
+
+    std::vector<StatementStats> result;
+    result.reserve(merged.size());
+    for (auto& [sql, target] : merged)
+    {
+        std::sort(target.samples.begin(), target.samples.end());
+        target.stats.sql = sql;
+        target.stats.p50Ms = Percentile(target.samples, 0.50);
+        target.stats.p99Ms = Percentile(target.samples, 0.99);
+        result.push_back(std::move(target.stats));
+    }
+
+    std::sort(result.begin(), result.end(), [](const StatementStats& a, const StatementStats& b) {
+        return a.totalMs > b.totalMs;
+    });
+    return result;
+}
+
+std::vector<QueryProfiler::SlowQuery> QueryProfiler::GetSlowQueries() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::vector<SlowQuery>(m_slowQueries.begin(), m_slowQueries.end());
+}
+
+void QueryProfiler::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_running.clear();
+    m_slowQueries.clear();
+}
+
+std::string QueryProfiler::ToJson() const
+{
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\n  \"slowThresholdMs\": " << m_slowThresholdMs.load() << ",\n  \"statements\": [";
+
+    const auto statements = GetStatementStats();
+    for (size_t i = 0; i < statements.size(); ++i)
+    {
+        const StatementStats& s = statements[i];
+        json << (i ? "," : "") << "\n    {"
+             << "\"sql\": \"" << JsonEscape(s.sql) << "\", "
+             << "\"calls\": " << s.calls << ", "
+             << "\"totalMs\": " << s.totalMs << ", "
+             << "\"p50Ms\": " << s.p50Ms << ", "
+             << "\"p99Ms\": " << s.p99Ms << ", "
+             << "\"maxMs\": " << s.maxMs << ", "
+             << "\"rows\": " << s.rows << ", "
+             << "\"cacheHits\": " << s.cacheHits << "}";
+    }
+
+    json << "\n  ],\n  \"slowQueries\": [";
+
+    const auto slowQueries = GetSlowQueries();
+    for (size_t i = 0; i < slowQueries.size(); ++i)
+    {
+        const SlowQuery& q = slowQueries[i];
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(q.timestamp.time_since_epoch()).count();
+        json << (i ? "," : "") << "\n    {"
+             << "\"sql\": \"" << JsonEscape(q.sql) << "\", "
+             << "\"durationMs\": " << q.durationMs << ", "
+             << "\"timestampMs\": " << ms << ", "
+             << "\"plan\": \"" << JsonEscape(q.plan) << "\"}";
+    }
+
+    json << "\n  ]\n}\n";
+    return json.str();
+}
+
+bool QueryProfiler::DumpJson(const std::string& filePath) const
+{
+    std::ofstream file(filePath, std::ios::trunc);
+    if (!file.is_open())
+    {
+        Logger::Error("QueryProfiler: cannot write {}", filePath);
+        return false;
+    }
+
+    file << ToJson();
+    return file.good();
+}
+
+std::string QueryProfiler::Normalize(const std::string& sql)
+{
+    // Collapse whitespace runs outside of string literals, trim, drop a trailing ';'
+    std::string result;
+    result.reserve(sql.size());
+
+    bool inString = false;
+    bool pendingSpace = false;
+    for (char c : sql)
+    {
+        if (!inString && std::isspace(static_cast<unsigned char>(c)))
+        {
+            pendingSpace = !result.empty();
+            continue;
+        }
+
+        if (pendingSpace)
+        {
+            result += ' ';
+            pendingSpace = false;
+        }
+
+        if (c == '\'')
+        {
+            inString = !inString;
+        }
+        result += c;
+    }
+
+    while (!result.empty() && (result.back() == ';' || result.back() == ' '))
+    {
+        result.pop_back();
+    }
+    return result;
+}
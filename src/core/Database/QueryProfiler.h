@@ -0,0 +1,110 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Forward declare SQLite types
+struct sqlite3;
+struct sqlite3_stmt;
+
+// Per-statement timing collected through sqlite3_trace_v2. SQLite's own profile time
+// has millisecond resolution on most platforms, so each statement is also timed from
+// its first step (SQLITE_TRACE_STMT) with steady_clock. Time spent in nested queries
+// issued from a result callback counts towards the outer statement as well.
+// Statements slower than the threshold also go to a bounded slow-query log with
+// their EXPLAIN QUERY PLAN, which is looked up on a separate read-only connection
+// so the traced connection is never re-entered from inside its own callback.
+class QueryProfiler
+{
+public:
+    struct StatementStats
+    {
+        std::string sql;        // Whitespace-normalized text, parameters left as '?'
+        uint64_t calls = 0;
+        double totalMs = 0.0;
+        double p50Ms = 0.0;
+        double p99Ms = 0.0;
+        double maxMs = 0.0;
+        uint64_t rows = 0;      // Rows stepped across all calls
+        uint64_t cacheHits = 0; // Executions served from a StatementCache
+    };
+
+    struct SlowQuery
+    {
+        std::string sql;
+        double durationMs = 0.0;
+        std::string plan;
+        std::chrono::system_clock::time_point timestamp;
+    };
+
+    explicit QueryProfiler(double slowThresholdMs = 50.0);
+    ~QueryProfiler();
+
+    // Opens the connection used for EXPLAIN QUERY PLAN; without it plans are left empty
+    bool AttachExplainDatabase(const std::string& databasePath);
+
+    // Install or remove the trace hook on a connection
+    void Trace(sqlite3* database);
+    void Untrace(sqlite3* database);
+
+    // Called by DatabaseManager when a StatementCache lease was a hit
+    void RecordCacheHit(const std::string& sql);
+
+    double GetSlowThresholdMs() const { return m_slowThresholdMs; }
+    void SetSlowThresholdMs(double thresholdMs) { m_slowThresholdMs = thresholdMs; }
+
+    // Sorted by total time, most expensive first
+    std::vector<StatementStats> GetStatementStats() const;
+    std::vector<SlowQuery> GetSlowQueries() const;
+    void Reset();
+
+    std::string ToJson() const;
+    bool DumpJson(const std::string& filePath) const;
+
+private:
+    struct Entry
+    {
+        uint64_t calls = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxNs = 0;
+        uint64_t rows = 0;
+        uint64_t cacheHits = 0;
+        std::vector<uint64_t> samples; // Reservoir for the percentiles
+    };
+
+    // A statement between its first step and its reset
+    struct Running
+    {
+        std::chrono::steady_clock::time_point start;
+        uint64_t rows = 0;
+    };
+
+    static int TraceCallback(unsigned type, void* context, void* p, void* x);
+    void OnStatement(sqlite3_stmt* statement);
+    void OnRow(sqlite3_stmt* statement);
+    void OnProfile(sqlite3_stmt* statement, int64_t elapsedNs);
+    std::string ExplainLocked(const std::string& sql);
+
+    static std::string Normalize(const std::string& sql);
+
+    mutable std::mutex m_mutex;
+    std::atomic<double> m_slowThresholdMs; // Set from any thread, read in the trace callback
+    sqlite3* m_explainDatabase = nullptr;
+
+    // Keyed by the raw SQL text, merged by normalized text when reported
+    std::unordered_map<std::string, Entry> m_entries;
+    std::unordered_map<sqlite3_stmt*, Running> m_running;
+    std::unordered_map<std::string, std::string> m_plans;
+    std::deque<SlowQuery> m_slowQueries;
+    uint64_t m_sampleSeed = 0x9E3779B97F4A7C15ull;
+
+    // Non-copyable
+    QueryProfiler(const QueryProfiler&) = delete;
+    QueryProfiler& operator=(const QueryProfiler&) = delete;
+};
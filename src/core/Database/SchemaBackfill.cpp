@@ -0,0 +1,253 @@
+#include "SchemaBackfill.h"
+#include "DatabaseManager.h"
+#include "core/Logger.h"
+#include "sqlite3.h"
+
+#include <algorithm>
+
+SchemaBackfill::SchemaBackfill(DatabaseManager& dbManager)
+    : m_dbManager(dbManager)
+{
+}
+
+bool SchemaBackfill::CreateProgressTable()
+{
+    if (m_tableCreated)
+    {
+        return true;
+    }
+
+    const std::string sql = R"(
+        CREATE TABLE IF NOT EXISTS schema_backfill (
+            name TEXT PRIMARY KEY,
+            table_name TEXT NOT NULL,
+            last_rowid INTEGER NOT NULL DEFAULT 0,
+            end_rowid INTEGER NOT NULL DEFAULT 0,
+            completed INTEGER NOT NULL DEFAULT 0,
+            updated_at DATETIME DEFAULT CURRENT_TIMESTAMP
+        );
+    )";
+
+    m_tableCreated = m_dbManager.ExecuteSQL(sql);
+    return m_tableCreated;
+}
+
+bool SchemaBackfill::AddJob(const Job& job)
+{
+    std::lock_guard<std::mutex> stepLock(m_stepMutex);
+
+    if (!CreateProgressTable())
+    {
+        Logger::Error("SchemaBackfill: failed to create progress table: {}", m_dbManager.GetLastError());
+        return false;
+    }
+
+    auto state = std::make_unique<JobState>();
+    state->job = job;
+    state->progress.name = job.name;
+
+    bool found = false;
+    m_dbManager.ExecuteQuery("SELECT last_rowid, end_rowid, completed FROM schema_backfill WHERE name = ?;",
+        [&job](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, job.name.c_str(), -1, SQLITE_STATIC);
+        },
+        [&state, &found](sqlite3_stmt* stmt) {
+            state->progress.lastRowId = sqlite3_column_int64(stmt, 0);
+            state->progress.endRowId = sqlite3_column_int64(stmt, 1);
+            state->progress.complete = sqlite3_column_int(stmt, 2) != 0;
+            found = true;
+            return false;
+        });
+
+    if (!found)
+    {
+        // Rows past the current end are written in the new format by the upgraded code
+        m_dbManager.ExecuteQuery("SELECT IFNULL(MAX(rowid), 0) FROM " + job.table + ";",
+            [&state](sqlite3_stmt* stmt) {
+                state->progress.endRowId = sqlite3_column_int64(stmt, 0);
+                return false;
+            });
+
+        const bool registered = m_dbManager.ExecuteSQL(
+            "INSERT INTO schema_backfill (name, table_name, end_rowid) VALUES (?, ?, ?);",
+            [&job, &state](sqlite3_stmt* stmt) {
+                sqlite3_bind_text(stmt, 1, job.name.c_str(), -1, SQLITE_STATIC);
+                sqlite3_bind_text(stmt, 2, job.table.c_str(), -1, SQLITE_STATIC);
+                sqlite3_bind_int64(stmt, 3, state->progress.endRowId);
+            });
+
+        if (!registered)
+        {
+            Logger::Error("SchemaBackfill: failed to register '{}': {}", job.name, m_dbManager.GetLastError());
+            return false;
+        }
+
+        if (state->progress.endRowId > 0)
+        {
+            Logger::Info("SchemaBackfill: '{}' will convert {} up to rowid {}",
+                         job.name, job.table, state->progress.endRowId);
+        }
+    }
+
+    // Nothing to convert still has to run the completion statements
+    if (!state->progress.complete && state->progress.endRowId == 0)
+    {
+        Progress progress;
+        if (!RunStep(*state, 1, progress))
+        {
+            return false;
+        }
+        state->progress = progress;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto existing = std::find_if(m_jobs.begin(), m_jobs.end(),
+                                 [&job](const auto& other) { return other->job.name == job.name; });
+    if (existing != m_jobs.end())
+    {
+        *existing = std::move(state);
+    }
+    else
+    {
+        m_jobs.push_back(std::move(state));
+    }
+    return true;
+}
+
+bool SchemaBackfill::Step(size_t batchRows)
+{
+    std::lock_guard<std::mutex> stepLock(m_stepMutex);
+
+    JobState* state = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& job : m_jobs)
+        {
+            if (!job->progress.complete)
+            {
+                state = job.get();
+                break;
+            }
+        }
+    }
+
+    if (!state)
+    {
+        return true; // Everything converted
+    }
+
+    Progress progress;
+    if (!RunStep(*state, std::max<size_t>(1, batchRows), progress))
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    state->progress = progress;
+    return true;
+}
+
+bool SchemaBackfill::RunStep(JobState& state, size_t batchRows, Progress& progress)
+{
+    progress = state.progress;
+    const int64_t upper = std::min(progress.endRowId, progress.lastRowId + static_cast<int64_t>(batchRows));
+    const bool last = upper >= progress.endRowId;
+
+    if (!m_dbManager.BeginTransaction())
+    {
+        Logger::Error("SchemaBackfill: failed to begin batch for '{}': {}", state.job.name, m_dbManager.GetLastError());
+        return false;
+    }
+
+    bool success = true;
+    if (upper > progress.lastRowId)
+    {
+        const std::string sql = "UPDATE " + state.job.table + " SET " + state.job.assignments +
+                                " WHERE rowid > ? AND rowid <= ?;";
+        success = m_dbManager.ExecuteSQL(sql, [&progress, upper](sqlite3_stmt* stmt) {
+            sqlite3_bind_int64(stmt, 1, progress.lastRowId);
+            sqlite3_bind_int64(stmt, 2, upper);
+        });
+    }
+
+    for (size_t i = 0; success && last && i < state.job.onComplete.size(); ++i)
+    {
+        success = m_dbManager.ExecuteSQL(state.job.onComplete[i]);
+    }
+
+    if (success)
+    {
+        success = m_dbManager.ExecuteSQL(
+            "UPDATE schema_backfill SET last_rowid = ?, completed = ?, updated_at = CURRENT_TIMESTAMP WHERE name = ?;",
+            [&state, upper, last](sqlite3_stmt* stmt) {
+                sqlite3_bind_int64(stmt, 1, upper);
+                sqlite3_bind_int(stmt, 2, last ? 1 : 0);
+                sqlite3_bind_text(stmt, 3, state.job.name.c_str(), -1, SQLITE_STATIC);
+            });
+    }
+
+    if (!success)
+    {
+        Logger::Error("SchemaBackfill: batch for '{}' failed: {}", state.job.name, m_dbManager.GetLastError());
+        m_dbManager.RollbackTransaction();
+        return false;
+    }
+
+    if (!m_dbManager.CommitTransaction())
+    {
+        Logger::Error("SchemaBackfill: failed to commit batch for '{}': {}", state.job.name, m_dbManager.GetLastError());
+        return false;
+    }
+
+    progress.lastRowId = upper;
+    progress.complete = last;
+
+    if (last && progress.endRowId > 0)
+    {
+        Logger::Info("SchemaBackfill: '{}' complete", state.job.name);
+    }
+    return true;
+}
+
+bool SchemaBackfill::RunToCompletion(size_t batchRows)
+{
+    while (!IsComplete())
+    {
+        if (!Step(batchRows))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SchemaBackfill::IsComplete() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::all_of(m_jobs.begin(), m_jobs.end(), [](const auto& job) { return job->progress.complete; });
+}
+
+bool SchemaBackfill::IsComplete(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& job : m_jobs)
+    {
+        if (job->job.name == name)
+        {
+            return job->progress.complete;
+        }
+    }
+    return false; // Unknown jobs have not run
+}
+
+std::vector<SchemaBackfill::Progress> SchemaBackfill::GetProgress() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<Progress> progress;
+    progress.reserve(m_jobs.size());
+    for (const auto& job : m_jobs)
+    {
+        progress.push_back(job->progress);
+    }
+    return progress;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class DatabaseManager;
+
+// Fills columns added by a schema upgrade from their legacy counterparts a batch of
+// rows at a time, so a large database converts in the background instead of blocking
+// startup. A job walks its table in rowid order up to the last row that existed when
+// it was first registered - rows written afterwards are already in the new format.
+// Progress is kept in the schema_backfill table and survives restarts.
+class SchemaBackfill
+{
+public:
+    struct Job
+    {
+        std::string name;                    // Progress key, e.g. "kanban_cards.v2"
+        std::string table;
+        std::string assignments;             // SET clause; must keep values that are already filled
+        std::vector<std::string> onComplete; // Run in the transaction of the last batch (index swaps)
+    };
+
+    struct Progress
+    {
+        std::string name;
+        int64_t lastRowId = 0;
+        int64_t endRowId = 0;
+        bool complete = false;
+    };
+
+    explicit SchemaBackfill(DatabaseManager& dbManager);
+
+    // Registers a job (again) and loads its persisted progress. A job over an empty
+    // table completes immediately.
+    bool AddJob(const Job& job);
+
+    // Converts up to batchRows rows of the first unfinished job in one transaction.
+    // Returns false on error; a failed batch is retried by the next call.
+    bool Step(size_t batchRows);
+    bool RunToCompletion(size_t batchRows = 5000);
+
+    bool IsComplete() const;
+    bool IsComplete(const std::string& name) const;
+    std::vector<Progress> GetProgress() const;
+
+private:
+    struct JobState
+    {
+        Job job;
+        Progress progress;
+    };
+
+    bool CreateProgressTable();
+    bool RunStep(JobState& state, size_t batchRows, Progress& progress);
+
+    DatabaseManager& m_dbManager;
+    std::vector<std::unique_ptr<JobState>> m_jobs;
+    mutable std::mutex m_mutex;   // Job list and progress, read from any thread
+    std::mutex m_stepMutex;       // One batch at a time
+    bool m_tableCreated = false;
+
+    // Non-copyable
+    SchemaBackfill(const SchemaBackfill&) = delete;
+    SchemaBackfill& operator=(const SchemaBackfill&) = delete;
+};
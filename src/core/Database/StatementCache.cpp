@@ -0,0 +1,177 @@
+#include "StatementCache.h"
+#include "core/Logger.h"
+#include "sqlite3.h"
+
+#include <utility>
+
+// Lease implementation
+StatementCache::Lease::Lease(StatementCache* cache, sqlite3_stmt* statement, Entry* entry, bool cacheHit)
+    : m_cache(cache)
+    , m_statement(statement)
+    , m_entry(entry)
+    , m_cacheHit(cacheHit)
+{
+}
+
+StatementCache::Lease::Lease(Lease&& other) noexcept
+    : m_cache(std::exchange(other.m_cache, nullptr))
+    , m_statement(std::exchange(other.m_statement, nullptr))
+    , m_entry(std::exchange(other.m_entry, nullptr))
+    , m_cacheHit(std::exchange(other.m_cacheHit, false))
+{
+}
+
+StatementCache::Lease& StatementCache::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        m_cache = std::exchange(other.m_cache, nullptr);
+        m_statement = std::exchange(other.m_statement, nullptr);
+        m_entry = std::exchange(other.m_entry, nullptr);
+        m_cacheHit = std::exchange(other.m_cacheHit, false);
+    }
+    return *this;
+}
+
+StatementCache::Lease::~Lease()
+{
+    Release();
+}
+
+void StatementCache::Lease::Release()
+{
+    if (m_cache && m_statement)
+    {
+        m_cache->Release(m_statement, m_entry);
+    }
+    m_cache = nullptr;
+    m_statement = nullptr;
+    m_entry = nullptr;
+}
+
+// StatementCache implementation
+StatementCache::StatementCache(size_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+StatementCache::~StatementCache()
+{
+    Clear();
+}
+
+StatementCache::Lease StatementCache::Acquire(sqlite3* database, const std::string& sql)
+{
+    if (!database)
+    {
+        return Lease();
+    }
+
+    auto found = m_index.find(sql);
+    if (found != m_index.end() && !found->second->inUse)
+    {
+        ++m_hits;
+        m_entries.splice(m_entries.begin(), m_entries, found->second);
+        Entry& entry = m_entries.front();
+        entry.inUse = true;
+        return Lease(this, entry.statement, &entry, true);
+    }
+
+    ++m_misses;
+
+    sqlite3_stmt* statement = nullptr;
+    int result = sqlite3_prepare_v2(database, sql.c_str(), static_cast<int>(sql.size()), &statement, nullptr);
+    if (result != SQLITE_OK)
+    {
+        Logger::Error("Failed to prepare SQL statement: {} - SQL: {}", sqlite3_errmsg(database), sql);
+        sqlite3_finalize(statement);
+        return Lease();
+    }
+
+    // Re-entrant use of the same SQL (e.g. from inside a result callback) runs on
+    // a private copy so the outer cursor is left untouched
+    if (found != m_index.end() || m_capacity == 0)
+    {
+        return Lease(this, statement, nullptr);
+    }
+
+    m_entries.push_front(Entry{ sql, statement, true });
+    m_index.emplace(sql, m_entries.begin());
+    EvictToCapacity();
+
+    return Lease(this, statement, &m_entries.front());
+}
+
+void StatementCache::Release(sqlite3_stmt* statement, Entry* entry)
+{
+    if (!entry)
+    {
+        sqlite3_finalize(statement);
+        return;
+    }
+
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
+    entry->inUse = false;
+
+    EvictToCapacity();
+}
+
+void StatementCache::EvictToCapacity()
+{
+    // Walk from the least recently used end, skipping statements still on loan
+    auto it = m_entries.end();
+    while (m_entries.size() > m_capacity && it != m_entries.begin())
+    {
+        --it;
+        if (it->inUse)
+        {
+            continue;
+        }
+
+        sqlite3_finalize(it->statement);
+        m_index.erase(it->sql);
+        it = m_entries.erase(it);
+        ++m_evictions;
+    }
+}
+
+void StatementCache::Clear()
+{
+    for (Entry& entry : m_entries)
+    {
+        if (entry.inUse)
+        {
+            Logger::Warning("Finalizing a cached statement that is still in use - SQL: {}", entry.sql);
+        }
+        sqlite3_finalize(entry.statement);
+    }
+
+    m_entries.clear();
+    m_index.clear();
+}
+
+void StatementCache::SetCapacity(size_t capacity)
+{
+    m_capacity = capacity;
+    EvictToCapacity();
+}
+
+StatementCache::Stats StatementCache::GetStats() const
+{
+    Stats stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    stats.evictions = m_evictions;
+    stats.size = m_entries.size();
+    stats.capacity = m_capacity;
+    return stats;
+}
+
+void StatementCache::ResetStats()
+{
+    m_hits = 0;
+    m_misses = 0;
+    m_evictions = 0;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+// Forward declare SQLite types
+struct sqlite3;
+struct sqlite3_stmt;
+
+// LRU cache of prepared statements for a single connection, keyed by SQL text.
+// Statements are reset and have their bindings cleared when handed back, so a
+// cached statement never holds a read snapshot or a pointer into caller memory.
+class StatementCache
+{
+public:
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t size = 0;
+        size_t capacity = 0;
+    };
+
+    struct Entry;
+
+    // Borrowed statement, returned to the cache (or finalized) on destruction
+    class Lease
+    {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        ~Lease();
+
+        bool IsValid() const { return m_statement != nullptr; }
+        sqlite3_stmt* Get() const { return m_statement; }
+        bool WasCacheHit() const { return m_cacheHit; }
+
+    private:
+        friend class StatementCache;
+        Lease(StatementCache* cache, sqlite3_stmt* statement, Entry* entry, bool cacheHit = false);
+        void Release();
+
+        StatementCache* m_cache = nullptr;
+        sqlite3_stmt* m_statement = nullptr;
+        Entry* m_entry = nullptr; // Null for uncached one-off statements
+        bool m_cacheHit = false;
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+    };
+
+    explicit StatementCache(size_t capacity = 64);
+    ~StatementCache();
+
+    // Returns an invalid lease if the SQL fails to prepare. A statement that is
+    // already leased (nested query with the same text) gets a one-off uncached copy.
+    Lease Acquire(sqlite3* database, const std::string& sql);
+
+    // Finalizes every cached statement - must run before the connection closes
+    // and while no lease is outstanding
+    void Clear();
+
+    void SetCapacity(size_t capacity);
+    size_t GetCapacity() const { return m_capacity; }
+    Stats GetStats() const;
+    void ResetStats();
+
+    struct Entry
+    {
+        std::string sql;
+        sqlite3_stmt* statement = nullptr;
+        bool inUse = false;
+    };
+
+private:
+    using EntryList = std::list<Entry>;
+
+    void Release(sqlite3_stmt* statement, Entry* entry);
+    void EvictToCapacity();
+
+    EntryList m_entries; // Most recently used first
+    std::unordered_map<std::string, EntryList::iterator> m_index;
+    size_t m_capacity;
+
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+    uint64_t m_evictions = 0;
+
+    // Non-copyable
+    StatementCache(const StatementCache&) = delete;
+    StatementCache& operator=(const StatementCache&) = delete;
+};
@@ -0,0 +1,441 @@
+#include "TodoDatabase.h"
+#include "core/Logger.h"
+#include "core/Utils.h"
+#include "sqlite3.h"
+
+namespace
+{
+    constexpr char TAG_SEPARATOR = '\x1f';
+
+    const char* TASK_COLUMNS = R"(
+        id, title, description, priority, status, due_date, due_time, is_all_day, category, tags,
+        position, created_ms, completed_ms, repeat_rule)";
+
+    void BindText(sqlite3_stmt* stmt, int index, const std::string& text)
+    {
+        if (text.empty())
+            sqlite3_bind_null(stmt, index);
+        else
+            sqlite3_bind_text(stmt, index, text.c_str(), -1, SQLITE_TRANSIENT);
+    }
+
+    std::string ReadText(sqlite3_stmt* stmt, int column)
+    {
+        const unsigned char* text = sqlite3_column_text(stmt, column);
+        return text ? reinterpret_cast<const char*>(text) : std::string();
+    }
+}
+
+TodoDatabase::TodoDatabase(std::shared_ptr<DatabaseManager> dbManager)
+    : m_dbManager(dbManager)
+{
+}
+
+bool TodoDatabase::Initialize()
+{
+    if (!m_dbManager || !m_dbManager->IsConnected())
+    {
+        Logger::Error("TodoDatabase: Database manager not available");
+        return false;
+    }
+
+    if (!CreateTables())
+    {
+        Logger::Error("TodoDatabase: Failed to create tables");
+        return false;
+    }
+
+    int currentVersion = m_dbManager->GetSchemaVersion("todo");
+    if (currentVersion < CURRENT_SCHEMA_VERSION)
+    {
+        Logger::Info("TodoDatabase: Migrating schema from version {} to {}", currentVersion, CURRENT_SCHEMA_VERSION);
+
+        if (!MigrateSchema(currentVersion, CURRENT_SCHEMA_VERSION))
+        {
+            Logger::Error("TodoDatabase: Schema migration failed");
+            return false;
+        }
+
+        m_dbManager->SetSchemaVersion("todo", CURRENT_SCHEMA_VERSION);
+    }
+
+    Logger::Info("TodoDatabase initialized successfully");
+    return true;
+}
+
+bool TodoDatabase::CreateTables()
+{
+    bool success = true;
+    success &= CreateTasksTable();
+    success &= CreateOccurrencesTable();
+    return success;
+}
+
+bool TodoDatabase::CreateTasksTable()
+{
+    // One row per task. Loading goes by due_day, so a window of days is an index range
+    // and the open-task index only holds what can still become overdue.
+    const std::string sql = R"(
+        CREATE TABLE IF NOT EXISTS todo_tasks (
+            id TEXT PRIMARY KEY,
+            title TEXT NOT NULL,
+            description TEXT,
+            priority INTEGER NOT NULL DEFAULT 1,
+            status INTEGER NOT NULL DEFAULT 0,
+            due_date TEXT,      -- YYYY-MM-DD format
+            due_day INTEGER,    -- Days since 1970-01-01 of due_date, NULL without one
+            due_time TEXT,      -- HH:MM format
+            is_all_day BOOLEAN NOT NULL DEFAULT 1,
+            category TEXT,
+            tags TEXT,          -- Tag names joined by char(31)
+            position INTEGER NOT NULL DEFAULT 0, -- Order within the day
+            created_ms INTEGER NOT NULL,
+            completed_ms INTEGER,
+            repeat_rule TEXT    -- RRULE-style, NULL unless the task repeats
+        );
+
+        CREATE INDEX IF NOT EXISTS idx_todo_tasks_day ON todo_tasks(due_day, position);
+        CREATE INDEX IF NOT EXISTS idx_todo_tasks_open ON todo_tasks(due_day) WHERE status <> 2;
+    )";
+
+    return m_dbManager->ExecuteSQL(sql);
+}
+
+bool TodoDatabase::CreateOccurrencesTable()
+{
+    // Only the occurrences of a repeating task that differ from its rule - completed,
+    // in progress or skipped - so a rule running for years costs rows per exception
+    const std::string sql = R"(
+        CREATE TABLE IF NOT EXISTS todo_task_occurrences (
+            task_id TEXT NOT NULL,
+            day INTEGER NOT NULL,   -- Days since 1970-01-01 of the occurrence
+            skipped BOOLEAN NOT NULL DEFAULT 0,
+            status INTEGER NOT NULL DEFAULT 0,
+            completed_ms INTEGER,
+            PRIMARY KEY (task_id, day)
+        ) WITHOUT ROWID;
+    )";
+
+    return m_dbManager->ExecuteSQL(sql);
+}
+
+bool TodoDatabase::MigrateSchema(int fromVersion, int toVersion)
+{
+    if (fromVersion >= toVersion)
+    {
+        return true; // No migration needed
+    }
+
+    // Version 1 is the first schema; CreateTables has already made it
+    for (int version = fromVersion; version < toVersion; ++version)
+    {
+        bool success = true;
+        switch (version)
+        {
+        case 0:
+            break;
+        case 1:
+            success = MigrateToVersion2();
+            break;
+        default:
+            Logger::Warning("TodoDatabase: Unknown migration version {}", version + 1);
+            break;
+        }
+
+        if (!success)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TodoDatabase::MigrateToVersion2()
+{
+    // Version 2 adds repeating tasks: a rule column on the task and the occurrence table,
+    // which CreateTables has already made
+    if (m_dbManager->ColumnExists("todo_tasks", "repeat_rule"))
+    {
+        return true;
+    }
+    return m_dbManager->ExecuteSQL("ALTER TABLE todo_tasks ADD COLUMN repeat_rule TEXT;");
+}
+
+bool TodoDatabase::SaveTasks(const std::vector<StoredTask>& tasks)
+{
+    if (tasks.empty())
+    {
+        return true;
+    }
+
+    const std::string sql = std::string("INSERT OR REPLACE INTO todo_tasks (") + TASK_COLUMNS + R"(, due_day)
+        VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);
+    )";
+    const std::string clearOccurrencesSql = "DELETE FROM todo_task_occurrences WHERE task_id = ?;";
+    const std::string occurrenceSql = R"(
+        INSERT INTO todo_task_occurrences (task_id, day, skipped, status, completed_ms)
+        VALUES (?, ?, ?, ?, ?);
+    )";
+
+    if (!m_dbManager->BeginTransaction())
+    {
+        return false;
+    }
+
+    for (const StoredTask& stored : tasks)
+    {
+        const Todo::Task& task = stored.task;
+        std::string tags;
+        for (const std::string& tag : task.tags)
+        {
+            tags += (tags.empty() ? "" : std::string(1, TAG_SEPARATOR)) + tag;
+        }
+
+        bool ok = m_dbManager->ExecuteSQL(sql, [&](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, task.id.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 2, task.title.c_str(), -1, SQLITE_TRANSIENT);
+            BindText(stmt, 3, task.description);
+            sqlite3_bind_int(stmt, 4, static_cast<int>(task.priority));
+            sqlite3_bind_int(stmt, 5, static_cast<int>(task.status));
+            BindText(stmt, 6, task.dueDate);
+            BindText(stmt, 7, task.dueTime);
+            sqlite3_bind_int(stmt, 8, task.isAllDay ? 1 : 0);
+            BindText(stmt, 9, task.category);
+            BindText(stmt, 10, tags);
+            sqlite3_bind_int(stmt, 11, stored.position);
+            sqlite3_bind_int64(stmt, 12, Utils::ToEpochMs(task.createdAt));
+            if (task.completedAt.time_since_epoch().count() != 0)
+                sqlite3_bind_int64(stmt, 13, Utils::ToEpochMs(task.completedAt));
+            else
+                sqlite3_bind_null(stmt, 13);
+            BindText(stmt, 14, task.recurrence.ToString());
+
+            int64_t dueDay = 0;
+            if (Utils::ParseDayNumber(task.dueDate, dueDay))
+                sqlite3_bind_int64(stmt, 15, dueDay);
+            else
+                sqlite3_bind_null(stmt, 15);
+        });
+
+        // A task that stopped repeating keeps its occurrence rows until it is deleted or
+        // repeats again; nothing reads them in between
+        if (ok && task.recurrence.IsRepeating())
+        {
+            ok = m_dbManager->ExecuteSQL(clearOccurrencesSql, [&task](sqlite3_stmt* stmt) {
+                sqlite3_bind_text(stmt, 1, task.id.c_str(), -1, SQLITE_TRANSIENT);
+            });
+
+            for (auto exception = stored.exceptions.begin(); ok && exception != stored.exceptions.end(); ++exception)
+            {
+                ok = m_dbManager->ExecuteSQL(occurrenceSql, [&task, &exception](sqlite3_stmt* stmt) {
+                    const Todo::OccurrenceException& state = exception->second;
+                    sqlite3_bind_text(stmt, 1, task.id.c_str(), -1, SQLITE_TRANSIENT);
+                    sqlite3_bind_int64(stmt, 2, exception->first);
+                    sqlite3_bind_int(stmt, 3, state.skipped ? 1 : 0);
+                    sqlite3_bind_int(stmt, 4, static_cast<int>(state.status));
+                    if (state.completedAt.time_since_epoch().count() != 0)
+                        sqlite3_bind_int64(stmt, 5, Utils::ToEpochMs(state.completedAt));
+                    else
+                        sqlite3_bind_null(stmt, 5);
+                });
+            }
+        }
+
+        if (!ok)
+        {
+            Logger::Error("TodoDatabase: Failed to save task {}: {}", task.id, m_dbManager->GetLastError());
+            m_dbManager->RollbackTransaction();
+            return false;
+        }
+    }
+
+    return m_dbManager->CommitTransaction();
+}
+
+bool TodoDatabase::DeleteTasks(const std::vector<std::string>& taskIds)
+{
+    if (taskIds.empty())
+    {
+        return true;
+    }
+
+    if (!m_dbManager->BeginTransaction())
+    {
+        return false;
+    }
+
+    for (const std::string& taskId : taskIds)
+    {
+        auto bindId = [&taskId](sqlite3_stmt* stmt) {
+            sqlite3_bind_text(stmt, 1, taskId.c_str(), -1, SQLITE_TRANSIENT);
+        };
+        bool ok = m_dbManager->ExecuteSQL("DELETE FROM todo_tasks WHERE id = ?;", bindId) &&
+                  m_dbManager->ExecuteSQL("DELETE FROM todo_task_occurrences WHERE task_id = ?;", bindId);
+
+        if (!ok)
+        {
+            Logger::Error("TodoDatabase: Failed to delete task {}: {}", taskId, m_dbManager->GetLastError());
+            m_dbManager->RollbackTransaction();
+            return false;
+        }
+    }
+
+    return m_dbManager->CommitTransaction();
+}
+
+std::vector<TodoDatabase::StoredTask> TodoDatabase::GetTasksInDayRange(int64_t firstDay, int64_t lastDay)
+{
+    const std::string sql = std::string("SELECT ") + TASK_COLUMNS + R"(
+        FROM todo_tasks
+        WHERE due_day BETWEEN ? AND ? AND repeat_rule IS NULL
+        ORDER BY due_day ASC, position ASC;
+    )";
+
+    std::vector<StoredTask> tasks;
+
+    m_dbManager->ExecuteReadQuery(sql,
+        [firstDay, lastDay](sqlite3_stmt* stmt) {
+            sqlite3_bind_int64(stmt, 1, firstDay);
+            sqlite3_bind_int64(stmt, 2, lastDay);
+        },
+        [&tasks, this](sqlite3_stmt* stmt) {
+            tasks.push_back(ReadTaskRow(stmt));
+            return true; // Continue
+        }
+    );
+
+    return tasks;
+}
+
+std::vector<TodoDatabase::StoredTask> TodoDatabase::GetOpenTasksBefore(int64_t day)
+{
+    // Both terms match the partial index's WHERE, so each is a range of it
+    const std::string sql = std::string("SELECT ") + TASK_COLUMNS + R"(
+        FROM todo_tasks
+        WHERE status <> 2 AND (due_day < ? OR due_day IS NULL) AND repeat_rule IS NULL
+        ORDER BY due_day ASC, position ASC;
+    )";
+
+    std::vector<StoredTask> tasks;
+
+    m_dbManager->ExecuteReadQuery(sql,
+        [day](sqlite3_stmt* stmt) {
+            sqlite3_bind_int64(stmt, 1, day);
+        },
+        [&tasks, this](sqlite3_stmt* stmt) {
+            tasks.push_back(ReadTaskRow(stmt));
+            return true; // Continue
+        }
+    );
+
+    return tasks;
+}
+
+std::vector<TodoDatabase::StoredTask> TodoDatabase::GetRepeatingTasks()
+{
+    const std::string sql = std::string("SELECT ") + TASK_COLUMNS + R"(
+        FROM todo_tasks
+        WHERE repeat_rule IS NOT NULL
+        ORDER BY id ASC;
+    )";
+
+    std::vector<StoredTask> tasks;
+    m_dbManager->ExecuteReadQuery(sql,
+        [&tasks, this](sqlite3_stmt* stmt) {
+            tasks.push_back(ReadTaskRow(stmt));
+            return true; // Continue
+        }
+    );
+
+    // Exceptions come back in task id order too, so one pass pairs them up
+    const std::string occurrencesSql = R"(
+        SELECT o.task_id, o.day, o.skipped, o.status, o.completed_ms
+        FROM todo_task_occurrences o
+        JOIN todo_tasks t ON t.id = o.task_id
+        WHERE t.repeat_rule IS NOT NULL
+        ORDER BY o.task_id ASC, o.day ASC;
+    )";
+
+    size_t next = 0;
+    m_dbManager->ExecuteReadQuery(occurrencesSql,
+        [&tasks, &next](sqlite3_stmt* stmt) {
+            const std::string taskId = ReadText(stmt, 0);
+            while (next < tasks.size() && tasks[next].task.id < taskId)
+            {
+                ++next;
+            }
+            if (next == tasks.size() || tasks[next].task.id != taskId)
+            {
+                return true; // Continue
+            }
+
+            Todo::OccurrenceException& exception = tasks[next].exceptions[sqlite3_column_int64(stmt, 1)];
+            exception.skipped = sqlite3_column_int(stmt, 2) != 0;
+            exception.status = static_cast<Todo::Status>(sqlite3_column_int(stmt, 3));
+            if (sqlite3_column_type(stmt, 4) != SQLITE_NULL)
+            {
+                exception.completedAt = Utils::FromEpochMs(sqlite3_column_int64(stmt, 4));
+            }
+            return true; // Continue
+        }
+    );
+
+    return tasks;
+}
+
+int TodoDatabase::GetTaskCount()
+{
+    int count = 0;
+    m_dbManager->ExecuteReadQuery("SELECT COUNT(*) FROM todo_tasks;",
+        [&count](sqlite3_stmt* stmt) {
+            count = sqlite3_column_int(stmt, 0);
+            return false;
+        });
+    return count;
+}
+
+bool TodoDatabase::GetTaskCounts(int& total, int& completed)
+{
+    total = 0;
+    completed = 0;
+    const std::string sql = R"(
+        SELECT COUNT(*), COALESCE(SUM(status = 2), 0) FROM todo_tasks WHERE repeat_rule IS NULL;
+    )";
+
+    return m_dbManager->ExecuteReadQuery(sql,
+        [&total, &completed](sqlite3_stmt* stmt) {
+            total = sqlite3_column_int(stmt, 0);
+            completed = sqlite3_column_int(stmt, 1);
+            return false;
+        });
+}
+
+TodoDatabase::StoredTask TodoDatabase::ReadTaskRow(sqlite3_stmt* stmt) const
+{
+    StoredTask stored;
+    Todo::Task& task = stored.task;
+    task.id = ReadText(stmt, 0);
+    task.title = ReadText(stmt, 1);
+    task.description = ReadText(stmt, 2);
+    task.priority = static_cast<Todo::Priority>(sqlite3_column_int(stmt, 3));
+    task.status = static_cast<Todo::Status>(sqlite3_column_int(stmt, 4));
+    task.dueDate = ReadText(stmt, 5);
+    task.dueTime = ReadText(stmt, 6);
+    task.isAllDay = sqlite3_column_int(stmt, 7) != 0;
+    task.category = ReadText(stmt, 8);
+
+    const std::string tags = ReadText(stmt, 9);
+    if (!tags.empty())
+    {
+        task.tags = Utils::Split(tags, TAG_SEPARATOR);
+    }
+
+    stored.position = sqlite3_column_int(stmt, 10);
+    task.createdAt = Utils::FromEpochMs(sqlite3_column_int64(stmt, 11));
+    if (sqlite3_column_type(stmt, 12) != SQLITE_NULL)
+    {
+        task.completedAt = Utils::FromEpochMs(sqlite3_column_int64(stmt, 12));
+    }
+    Todo::Recurrence::Parse(ReadText(stmt, 13), task.recurrence);
+    return stored;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "DatabaseManager.h"
+#include "core/Todo/TodoManager.h"
+#include <memory>
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+class TodoDatabase
+{
+public:
+    // A task with its place in its day's list; a repeating task also carries the
+    // occurrences that differ from its rule
+    struct StoredTask
+    {
+        Todo::Task task;
+        int position = 0;
+        std::map<int64_t, Todo::OccurrenceException> exceptions;
+    };
+
+    TodoDatabase(std::shared_ptr<DatabaseManager> dbManager);
+    ~TodoDatabase() = default;
+
+    // Database initialization
+    bool Initialize();
+    bool CreateTables();
+    bool MigrateSchema(int fromVersion, int toVersion);
+
+    // Writes - rows are inserted or replaced by task id, all in one transaction. A
+    // repeating task's occurrence rows are replaced along with it.
+    bool SaveTasks(const std::vector<StoredTask>& tasks);
+    bool DeleteTasks(const std::vector<std::string>& taskIds);
+
+    // Reads by due day (days since 1970-01-01), in day then position order. The open
+    // tasks are those not completed that are due before a day or have no due date -
+    // what the overdue list needs from outside a loaded window. Both leave out repeating
+    // tasks, which are read all together with their occurrence exceptions.
+    std::vector<StoredTask> GetTasksInDayRange(int64_t firstDay, int64_t lastDay);
+    std::vector<StoredTask> GetOpenTasksBefore(int64_t day);
+    std::vector<StoredTask> GetRepeatingTasks();
+    int GetTaskCount();
+    bool GetTaskCounts(int& total, int& completed); // Tasks that do not repeat, and how many are completed
+
+private:
+    std::shared_ptr<DatabaseManager> m_dbManager;
+
+    // Schema versions
+    static constexpr int CURRENT_SCHEMA_VERSION = 2;
+
+    // Helper methods
+    StoredTask ReadTaskRow(sqlite3_stmt* stmt) const;
+
+    // Table creation methods
+    bool CreateTasksTable();
+    bool CreateOccurrencesTable();
+
+    // Migration methods
+    bool MigrateToVersion2();
+};
@@ -0,0 +1,104 @@
+#include "IdGenerator.h"
+
+#include <chrono>
+#include <mutex>
+#include <random>
+
+namespace
+{
+    constexpr uint64_t SEQUENCE_MASK = (1ull << IdGenerator::SEQUENCE_BITS) - 1;
+    constexpr uint64_t NODE_MASK = (1ull << IdGenerator::NODE_BITS) - 1;
+    constexpr uint64_t TIMESTAMP_MASK = (1ull << IdGenerator::TIMESTAMP_BITS) - 1;
+
+    std::mutex s_mutex;
+    uint64_t s_lastMs = 0;
+    uint64_t s_sequence = 0;
+    uint64_t s_node = 0;
+    bool s_nodeSet = false;
+
+    uint64_t NowMs()
+    {
+        const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        return now > IdGenerator::EPOCH_MS ? static_cast<uint64_t>(now - IdGenerator::EPOCH_MS) : 0;
+    }
+}
+
+uint64_t IdGenerator::Next()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    if (!s_nodeSet)
+    {
+        // Two processes sharing a database rarely pick the same node, and when they do
+        // they also need the same millisecond and sequence to collide
+        std::random_device rd;
+        s_node = rd() & NODE_MASK;
+        s_nodeSet = true;
+    }
+
+    // A clock that stepped back keeps counting from the last timestamp used, and a full
+    // sequence borrows the next millisecond, so ids never repeat or go backwards
+    const uint64_t now = NowMs();
+    if (now > s_lastMs)
+    {
+        s_lastMs = now;
+        s_sequence = 0;
+    }
+    else if (++s_sequence > SEQUENCE_MASK)
+    {
+        ++s_lastMs;
+        s_sequence = 0;
+    }
+
+    return ((s_lastMs & TIMESTAMP_MASK) << (NODE_BITS + SEQUENCE_BITS)) | (s_node << SEQUENCE_BITS) | s_sequence;
+}
+
+std::string IdGenerator::ToString(uint64_t id)
+{
+    char buffer[16];
+    char* end = buffer + sizeof(buffer);
+    char* p = end;
+    do
+    {
+        const int digit = static_cast<int>(id % 36);
+        *--p = static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        id /= 36;
+    } while (id != 0);
+
+    return std::string(p, end);
+}
+
+bool IdGenerator::Parse(const std::string& text, uint64_t& id)
+{
+    // 13 base-36 digits cover 63 bits; anything longer cannot be one of ours
+    if (text.empty() || text.size() > 13)
+    {
+        return false;
+    }
+
+    uint64_t value = 0;
+    for (char c : text)
+    {
+        int digit;
+        if (c >= '0' && c <= '9') digit = c - '0';
+        else if (c >= 'a' && c <= 'z') digit = c - 'a' + 10;
+        else return false;
+
+        if (value > (static_cast<uint64_t>(INT64_MAX) - digit) / 36)
+        {
+            return false;
+        }
+        value = value * 36 + digit;
+    }
+
+    id = value;
+    return true;
+}
+
+void IdGenerator::SetNode(uint32_t node)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_node = node & NODE_MASK;
+    s_nodeSet = true;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Collision-free 64-bit identifiers for stored entities, laid out as
+//   41 bits milliseconds since 2024-01-01 | 10 bits node | 12 bits sequence
+// Ids from one process are strictly increasing, also when the clock steps back, and
+// stay positive so they can be SQLite INTEGER PRIMARY KEY values. The text form is
+// base-36 (at most 13 characters), short enough for the small-string buffer.
+class IdGenerator
+{
+public:
+    static uint64_t Next();
+    static std::string NextString() { return ToString(Next()); }
+
+    static std::string ToString(uint64_t id);
+    static bool Parse(const std::string& text, uint64_t& id); // False for non base-36 text such as legacy ids
+
+    // Node bits of this process; random unless set before the first Next()
+    static void SetNode(uint32_t node);
+
+    static constexpr int SEQUENCE_BITS = 12;
+    static constexpr int NODE_BITS = 10;
+    static constexpr int TIMESTAMP_BITS = 41;
+    static constexpr int64_t EPOCH_MS = 1704067200000; // 2024-01-01T00:00:00Z
+};
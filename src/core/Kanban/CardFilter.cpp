@@ -0,0 +1,292 @@
+#include "core/Kanban/CardFilter.h"
+
+#include <algorithm>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Kanban
+{
+    // CardFilter Implementation
+    bool CardFilter::IsEmpty() const
+    {
+        return priorities == 0 && statuses == 0 && assignee.empty() && tags.empty() && !dueFrom && !dueTo &&
+               !overdueOnly;
+    }
+
+    bool CardFilter::operator==(const CardFilter& other) const
+    {
+        return priorities == other.priorities && statuses == other.statuses && assignee == other.assignee &&
+               tags == other.tags && dueFrom == other.dueFrom && dueTo == other.dueTo &&
+               overdueOnly == other.overdueOnly;
+    }
+
+    // SlotBitset Implementation
+    void SlotBitset::Set(size_t slot)
+    {
+        if (slot / 64 >= m_words.size())
+        {
+            m_words.resize(slot / 64 + 1, 0);
+        }
+        m_words[slot / 64] |= uint64_t(1) << (slot % 64);
+    }
+
+    void SlotBitset::Reset(size_t slot)
+    {
+        if (slot / 64 < m_words.size())
+        {
+            m_words[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+        }
+    }
+
+    bool SlotBitset::Test(size_t slot) const
+    {
+        return slot / 64 < m_words.size() && (m_words[slot / 64] >> (slot % 64)) & 1;
+    }
+
+    bool SlotBitset::None() const
+    {
+        return std::all_of(m_words.begin(), m_words.end(), [](uint64_t word) { return word == 0; });
+    }
+
+    size_t SlotBitset::Count() const
+    {
+        size_t count = 0;
+        for (uint64_t word : m_words)
+        {
+            for (; word; word &= word - 1)
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    SlotBitset& SlotBitset::operator&=(const SlotBitset& other)
+    {
+        if (m_words.size() > other.m_words.size())
+        {
+            m_words.resize(other.m_words.size());
+        }
+        for (size_t i = 0; i < m_words.size(); ++i)
+        {
+            m_words[i] &= other.m_words[i];
+        }
+        return *this;
+    }
+
+    SlotBitset& SlotBitset::operator|=(const SlotBitset& other)
+    {
+        if (m_words.size() < other.m_words.size())
+        {
+            m_words.resize(other.m_words.size(), 0);
+        }
+        for (size_t i = 0; i < other.m_words.size(); ++i)
+        {
+            m_words[i] |= other.m_words[i];
+        }
+        return *this;
+    }
+
+    size_t SlotBitset::CountTrailingZeros(uint64_t word)
+    {
+#if defined(_MSC_VER)
+        unsigned long index = 0;
+        _BitScanForward64(&index, word);
+        return index;
+#elif defined(__GNUC__)
+        return static_cast<size_t>(__builtin_ctzll(word));
+#else
+        size_t index = 0;
+        for (; !(word & 1); word >>= 1)
+        {
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    // CardFilterIndex Implementation
+    uint32_t CardFilterIndex::ValueTable::Add(const std::string& text, uint32_t slot)
+    {
+        auto found = ids.find(text);
+        uint32_t id;
+        if (found != ids.end())
+        {
+            id = found->second;
+        }
+        else
+        {
+            if (freeIds.empty())
+            {
+                id = static_cast<uint32_t>(values.size());
+                values.emplace_back();
+            }
+            else
+            {
+                id = freeIds.back();
+                freeIds.pop_back();
+            }
+            values[id].text = text;
+            ids.emplace(text, id);
+        }
+
+        values[id].cards.Set(slot);
+        ++values[id].count;
+        return id;
+    }
+
+    void CardFilterIndex::ValueTable::Remove(uint32_t id, uint32_t slot)
+    {
+        Value& value = values[id];
+        value.cards.Reset(slot);
+        if (--value.count == 0)
+        {
+            ids.erase(value.text);
+            value = Value();
+            freeIds.push_back(id);
+        }
+    }
+
+    const SlotBitset* CardFilterIndex::ValueTable::Find(const std::string& text) const
+    {
+        auto found = ids.find(text);
+        return found != ids.end() ? &values[found->second].cards : nullptr;
+    }
+
+    uint32_t CardFilterIndex::Add(const Attributes& attributes)
+    {
+        uint32_t index;
+        if (m_freeSlots.empty())
+        {
+            index = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+        else
+        {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+
+        Slot& slot = m_slots[index];
+        slot.priority = static_cast<uint8_t>(attributes.priority);
+        slot.status = static_cast<uint8_t>(attributes.status);
+        slot.hasDueDay = attributes.hasDueDay;
+        slot.dueDay = attributes.dueDay;
+
+        m_live.Set(index);
+        m_byPriority[slot.priority].Set(index);
+        m_byStatus[slot.status].Set(index);
+        if (attributes.hasDueDay)
+        {
+            m_hasDueDay.Set(index);
+        }
+        if (attributes.overdue)
+        {
+            m_overdue.Set(index);
+        }
+
+        slot.assignee = attributes.assignee && !attributes.assignee->empty()
+            ? m_assignees.Add(*attributes.assignee, index) : NO_VALUE;
+        slot.tags.clear();
+        if (attributes.tags)
+        {
+            const auto& tags = *attributes.tags;
+            for (auto tag = tags.begin(); tag != tags.end(); ++tag)
+            {
+                if (std::find(tags.begin(), tag, *tag) == tag) // A tag listed twice counts once
+                {
+                    slot.tags.push_back(m_tags.Add(*tag, index));
+                }
+            }
+        }
+        return index;
+    }
+
+    void CardFilterIndex::Remove(uint32_t index)
+    {
+        if (index >= m_slots.size() || !m_live.Test(index))
+        {
+            return;
+        }
+
+        Slot& slot = m_slots[index];
+        m_live.Reset(index);
+        m_byPriority[slot.priority].Reset(index);
+        m_byStatus[slot.status].Reset(index);
+        m_hasDueDay.Reset(index);
+        m_overdue.Reset(index);
+        if (slot.assignee != NO_VALUE)
+        {
+            m_assignees.Remove(slot.assignee, index);
+        }
+        for (uint32_t tag : slot.tags)
+        {
+            m_tags.Remove(tag, index);
+        }
+        slot.tags.clear();
+        m_freeSlots.push_back(index);
+    }
+
+    void CardFilterIndex::SetOverdue(uint32_t slot, bool overdue)
+    {
+        if (overdue)
+            m_overdue.Set(slot);
+        else
+            m_overdue.Reset(slot);
+    }
+
+    void CardFilterIndex::Clear()
+    {
+        *this = CardFilterIndex();
+    }
+
+    void CardFilterIndex::Match(const CardFilter& filter, SlotBitset& result) const
+    {
+        result = m_live;
+
+        // One bitset per set criterion; a set of enum values is the union of theirs
+        auto matchAny = [&result](const SlotBitset* bitsets, int count, uint8_t mask) {
+            if (mask == 0)
+                return;
+            SlotBitset any;
+            for (int i = 0; i < count; ++i)
+            {
+                if (mask & (1u << i))
+                    any |= bitsets[i];
+            }
+            result &= any;
+        };
+        matchAny(m_byPriority, 4, filter.priorities);
+        matchAny(m_byStatus, 3, filter.statuses);
+
+        if (!filter.assignee.empty())
+        {
+            const SlotBitset* cards = m_assignees.Find(filter.assignee);
+            result &= cards ? *cards : SlotBitset();
+        }
+        for (const std::string& tag : filter.tags)
+        {
+            const SlotBitset* cards = m_tags.Find(tag);
+            result &= cards ? *cards : SlotBitset();
+        }
+        if (filter.overdueOnly)
+        {
+            result &= m_overdue;
+        }
+
+        // A window is a range, not a value: the cards left over are checked against their day
+        if (filter.dueFrom || filter.dueTo)
+        {
+            result &= m_hasDueDay;
+            SlotBitset inWindow;
+            result.ForEach([&](size_t slot) {
+                const int64_t day = m_slots[slot].dueDay;
+                if ((!filter.dueFrom || day >= *filter.dueFrom) && (!filter.dueTo || day <= *filter.dueTo))
+                    inWindow.Set(slot);
+            });
+            result = std::move(inWindow);
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Kanban
+{
+    // Cards a board shows. Every criterion that is set has to match; an empty filter
+    // matches every card.
+    struct CardFilter
+    {
+        uint8_t priorities = 0;        // Bit per Priority value, 0 for any
+        uint8_t statuses = 0;          // Bit per CardStatus value, 0 for any
+        std::string assignee;          // Exact match, empty for any
+        std::vector<std::string> tags; // Cards carrying all of them
+        std::optional<int64_t> dueFrom; // Due day window (day numbers as in Utils), inclusive;
+        std::optional<int64_t> dueTo;   // cards without a due date are outside any window
+        bool overdueOnly = false;
+
+        bool IsEmpty() const;
+        bool operator==(const CardFilter& other) const;
+        bool operator!=(const CardFilter& other) const { return !(*this == other); }
+    };
+
+    // Growable bitset; bits past the stored words read as zero, so a value carried by a
+    // few cards in low slots stays small.
+    class SlotBitset
+    {
+    public:
+        void Set(size_t slot);
+        void Reset(size_t slot);
+        bool Test(size_t slot) const;
+        bool None() const;
+        size_t Count() const;
+
+        SlotBitset& operator&=(const SlotBitset& other);
+        SlotBitset& operator|=(const SlotBitset& other);
+        void Clear() { m_words.clear(); }
+
+        // Calls op(slot) for each set bit, in slot order
+        template <typename Op>
+        void ForEach(Op&& op) const
+        {
+            for (size_t i = 0; i < m_words.size(); ++i)
+            {
+                for (uint64_t word = m_words[i]; word; word &= word - 1)
+                {
+                    op(i * 64 + CountTrailingZeros(word));
+                }
+            }
+        }
+
+    private:
+        static size_t CountTrailingZeros(uint64_t word);
+
+        std::vector<uint64_t> m_words;
+    };
+
+    // Per-attribute bitsets over card slots. A board gives each indexed card a slot and
+    // updates its bits as the card changes, so a filter costs a handful of word-wide ANDs
+    // over the slots instead of a look at every card. Assignees and tags are interned;
+    // a value's bitset goes away with its last card.
+    class CardFilterIndex
+    {
+    public:
+        struct Attributes
+        {
+            int priority = 0;
+            int status = 0;
+            const std::string* assignee = nullptr;
+            const std::vector<std::string>* tags = nullptr;
+            bool hasDueDay = false;
+            int64_t dueDay = 0;
+            bool overdue = false;
+        };
+
+        uint32_t Add(const Attributes& attributes); // Returns the card's slot
+        void Remove(uint32_t slot);
+        void SetOverdue(uint32_t slot, bool overdue);
+        void Clear();
+
+        // Slots of the cards that pass the filter
+        void Match(const CardFilter& filter, SlotBitset& result) const;
+        size_t GetSlotCount() const { return m_slots.size(); }
+
+    private:
+        static constexpr uint32_t NO_VALUE = UINT32_MAX;
+
+        struct Value
+        {
+            std::string text;
+            SlotBitset cards;
+            size_t count = 0;
+        };
+
+        struct Slot
+        {
+            uint8_t priority = 0;
+            uint8_t status = 0;
+            bool hasDueDay = false;
+            int64_t dueDay = 0;
+            uint32_t assignee = NO_VALUE;
+            std::vector<uint32_t> tags;
+        };
+
+        // Interned assignees or tags, each with the slots that carry it
+        struct ValueTable
+        {
+            std::unordered_map<std::string, uint32_t> ids;
+            std::vector<Value> values;
+            std::vector<uint32_t> freeIds;
+
+            uint32_t Add(const std::string& text, uint32_t slot);
+            void Remove(uint32_t id, uint32_t slot);
+            const SlotBitset* Find(const std::string& text) const;
+        };
+
+        std::vector<Slot> m_slots;
+        std::vector<uint32_t> m_freeSlots;
+        SlotBitset m_live;
+        SlotBitset m_byPriority[4]; // Indexed by Priority
+        SlotBitset m_byStatus[3];   // Indexed by CardStatus
+        SlotBitset m_overdue;
+        SlotBitset m_hasDueDay;
+
+        ValueTable m_assignees;
+        ValueTable m_tags;
+    };
+}
@@ -0,0 +1,288 @@
+#include "core/Kanban/KanbanJournal.h"
+#include "core/Kanban/KanbanManager.h"
+#include "core/Utils.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace Kanban
+{
+    namespace
+    {
+        // Values are written as "<length>:<bytes>" one after another, so any text
+        // round-trips without escaping
+        void Put(std::string& out, const std::string& value)
+        {
+            out += std::to_string(value.size());
+            out += ':';
+            out += value;
+        }
+
+        bool Take(const std::string& text, size_t& pos, std::string& value)
+        {
+            const size_t colon = text.find(':', pos);
+            if (colon == std::string::npos || colon == pos)
+                return false;
+
+            char* end = nullptr;
+            const unsigned long long length = std::strtoull(text.c_str() + pos, &end, 10);
+            if (end != text.c_str() + colon || length > text.size() - colon - 1)
+                return false;
+
+            value.assign(text, colon + 1, static_cast<size_t>(length));
+            pos = colon + 1 + static_cast<size_t>(length);
+            return true;
+        }
+
+        bool TakeInt(const std::string& text, size_t& pos, int64_t& value)
+        {
+            std::string digits;
+            if (!Take(text, pos, digits) || digits.empty())
+                return false;
+
+            char* end = nullptr;
+            value = std::strtoll(digits.c_str(), &end, 10);
+            return *end == '\0';
+        }
+
+        std::string EncodeList(const std::vector<std::string>& values)
+        {
+            std::string out;
+            Put(out, std::to_string(values.size()));
+            for (const auto& value : values)
+            {
+                Put(out, value);
+            }
+            return out;
+        }
+
+        bool DecodeList(const std::string& text, size_t& pos, std::vector<std::string>& values)
+        {
+            int64_t count = 0;
+            if (!TakeInt(text, pos, count) || count < 0)
+                return false;
+
+            values.assign(static_cast<size_t>(count), std::string());
+            for (auto& value : values)
+            {
+                if (!Take(text, pos, value))
+                    return false;
+            }
+            return true;
+        }
+
+        std::string EncodeColor(const Color& color)
+        {
+            char buffer[96];
+            std::snprintf(buffer, sizeof(buffer), "%.9g %.9g %.9g %.9g", color.r, color.g, color.b, color.a);
+            return buffer;
+        }
+
+        bool DecodeColor(const std::string& text, Color& color)
+        {
+            return std::sscanf(text.c_str(), "%f %f %f %f", &color.r, &color.g, &color.b, &color.a) == 4;
+        }
+
+        bool DecodeEnum(const std::string& text, int last, int& value)
+        {
+            char* end = nullptr;
+            const long parsed = std::strtol(text.c_str(), &end, 10);
+            if (text.empty() || *end != '\0' || parsed < 0 || parsed > last)
+                return false;
+
+            value = static_cast<int>(parsed);
+            return true;
+        }
+    }
+
+    size_t JournalEntry::GetBytes() const
+    {
+        return sizeof(JournalEntry) + boardId.capacity() + cardId.capacity() + columnBefore.capacity() +
+               columnAfter.capacity() + before.capacity() + after.capacity();
+    }
+
+    std::string JournalEntry::EncodeCard(const Card& card)
+    {
+        std::string out;
+        out.reserve(64 + card.title.size() + card.description.size());
+        Put(out, card.id);
+        Put(out, card.title);
+        Put(out, card.description);
+        Put(out, std::to_string(static_cast<int>(card.priority)));
+        Put(out, std::to_string(static_cast<int>(card.status)));
+        Put(out, EncodeColor(card.color));
+        Put(out, card.assignee);
+        Put(out, card.dueDate);
+        Put(out, card.rank);
+        Put(out, std::to_string(Utils::ToEpochMs(card.createdAt)));
+        Put(out, std::to_string(Utils::ToEpochMs(card.modifiedAt)));
+        out += EncodeList(card.tags);
+        return out;
+    }
+
+    bool JournalEntry::DecodeCard(const std::string& text, Card& card)
+    {
+        size_t pos = 0;
+        std::string priority, status, color;
+        int64_t createdMs = 0, modifiedMs = 0;
+        if (!Take(text, pos, card.id) || !Take(text, pos, card.title) || !Take(text, pos, card.description) ||
+            !Take(text, pos, priority) || !Take(text, pos, status) || !Take(text, pos, color) ||
+            !Take(text, pos, card.assignee) || !Take(text, pos, card.dueDate) || !Take(text, pos, card.rank) ||
+            !TakeInt(text, pos, createdMs) || !TakeInt(text, pos, modifiedMs) || !DecodeList(text, pos, card.tags))
+        {
+            return false;
+        }
+
+        card.createdAt = Utils::FromEpochMs(createdMs);
+        card.modifiedAt = Utils::FromEpochMs(modifiedMs);
+        return SetField(card, Field::Priority, priority) && SetField(card, Field::Status, status) &&
+               SetField(card, Field::Color, color);
+    }
+
+    std::string JournalEntry::GetField(const Card& card, Field field)
+    {
+        switch (field)
+        {
+            case Field::Title:       return card.title;
+            case Field::Description: return card.description;
+            case Field::Priority:    return std::to_string(static_cast<int>(card.priority));
+            case Field::Status:      return std::to_string(static_cast<int>(card.status));
+            case Field::Color:       return EncodeColor(card.color);
+            case Field::Assignee:    return card.assignee;
+            case Field::DueDate:     return card.dueDate;
+            case Field::Tags:        return EncodeList(card.tags);
+            default:                 return std::string();
+        }
+    }
+
+    bool JournalEntry::SetField(Card& card, Field field, const std::string& value)
+    {
+        int number = 0;
+        size_t pos = 0;
+        switch (field)
+        {
+            case Field::Title:       card.title = value; return true;
+            case Field::Description: card.description = value; return true;
+            case Field::Assignee:    card.assignee = value; return true;
+            case Field::DueDate:     card.dueDate = value; return true;
+            case Field::Color:       return DecodeColor(value, card.color);
+            case Field::Tags:        return DecodeList(value, pos, card.tags);
+            case Field::Priority:
+                if (!DecodeEnum(value, static_cast<int>(Priority::Urgent), number)) return false;
+                card.priority = static_cast<Priority>(number);
+                return true;
+            case Field::Status:
+                if (!DecodeEnum(value, static_cast<int>(CardStatus::Archived), number)) return false;
+                card.status = static_cast<CardStatus>(number);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void Journal::SetCapacity(size_t bytes)
+    {
+        m_capacity = bytes;
+        Evict();
+    }
+
+    bool Journal::Record(JournalEntry entry)
+    {
+        const bool discardedRedo = m_cursor < m_entries.size();
+        while (m_entries.size() > m_cursor)
+        {
+            m_bytes -= m_entries.back().GetBytes();
+            m_entries.pop_back();
+        }
+
+        entry.undone = false;
+        m_bytes += entry.GetBytes();
+        m_entries.push_back(std::move(entry));
+        m_cursor = m_entries.size();
+        Evict();
+        return discardedRedo;
+    }
+
+    std::vector<JournalEntry> Journal::TakeUndo()
+    {
+        std::vector<JournalEntry> group;
+        if (!CanUndo())
+            return group;
+
+        const int64_t id = m_entries[m_cursor - 1].group;
+        while (m_cursor > 0 && m_entries[m_cursor - 1].group == id)
+        {
+            JournalEntry& entry = m_entries[--m_cursor];
+            entry.undone = true;
+            group.push_back(entry);
+        }
+        return group;
+    }
+
+    std::vector<JournalEntry> Journal::TakeRedo()
+    {
+        std::vector<JournalEntry> group;
+        if (!CanRedo())
+            return group;
+
+        const int64_t id = m_entries[m_cursor].group;
+        while (m_cursor < m_entries.size() && m_entries[m_cursor].group == id)
+        {
+            JournalEntry& entry = m_entries[m_cursor++];
+            entry.undone = false;
+            group.push_back(entry);
+        }
+        return group;
+    }
+
+    void Journal::Restore(std::vector<JournalEntry> entries)
+    {
+        Clear();
+        for (auto& entry : entries)
+        {
+            m_bytes += entry.GetBytes();
+            m_entries.push_back(std::move(entry));
+        }
+
+        // Undone entries only make sense as a tail - anything applied after them
+        // would have discarded them
+        m_cursor = 0;
+        while (m_cursor < m_entries.size() && !m_entries[m_cursor].undone)
+        {
+            ++m_cursor;
+        }
+        Evict();
+    }
+
+    void Journal::Clear()
+    {
+        m_entries.clear();
+        m_cursor = 0;
+        m_bytes = 0;
+    }
+
+    void Journal::Evict()
+    {
+        // Whole groups from the oldest end; the newest group stays even when over the cap
+        while (m_bytes > m_capacity && !m_entries.empty())
+        {
+            const int64_t id = m_entries.front().group;
+            size_t count = 0;
+            while (count < m_entries.size() && m_entries[count].group == id)
+            {
+                ++count;
+            }
+            if (count == m_entries.size())
+            {
+                break;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                m_bytes -= m_entries.front().GetBytes();
+                m_entries.pop_front();
+            }
+            m_cursor = m_cursor > count ? m_cursor - count : 0;
+        }
+    }
+}
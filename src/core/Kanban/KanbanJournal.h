@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace Kanban
+{
+    struct Card;
+
+    // One invertible change to a card. Only what changed is kept: a field's old and new
+    // text, the column and rank on either side of a move, or the whole card for a
+    // create or delete.
+    struct JournalEntry
+    {
+        enum class Type : uint8_t
+        {
+            CardCreated = 0, // columnAfter, after = encoded card
+            CardDeleted,     // columnBefore, before = encoded card
+            CardMoved,       // columnBefore/After, before/after = ranks
+            CardChanged      // field, before/after = field values
+        };
+
+        enum class Field : uint8_t
+        {
+            None = 0,
+            Title,
+            Description,
+            Priority,
+            Status,
+            Color,
+            Assignee,
+            DueDate,
+            Tags
+        };
+
+        int64_t sequence = 0; // Recording order, also the kanban_journal key
+        int64_t group = 0;    // Entries of one user action share it and are undone together
+        Type type = Type::CardChanged;
+        Field field = Field::None;
+        std::string boardId;
+        std::string cardId;
+        std::string columnBefore;
+        std::string columnAfter;
+        std::string before;
+        std::string after;
+        bool undone = false;
+
+        size_t GetBytes() const;
+
+        // Text forms of whole cards and single fields
+        static std::string EncodeCard(const Card& card);
+        static bool DecodeCard(const std::string& text, Card& card);
+        static std::string GetField(const Card& card, Field field);
+        static bool SetField(Card& card, Field field, const std::string& value);
+    };
+
+    // Undo/redo history. Entries sit in a ring in recording order with the redo entries
+    // (undone ones) after the cursor; when their size passes the cap the oldest groups are
+    // dropped. Undo and redo hand out one group at a time, so both cost the size of the
+    // change rather than the board.
+    class Journal
+    {
+    public:
+        void SetCapacity(size_t bytes);
+        size_t GetCapacity() const { return m_capacity; }
+
+        // Appends an entry, dropping the redo entries first. Returns true if there were any.
+        bool Record(JournalEntry entry);
+
+        bool CanUndo() const { return m_cursor > 0; }
+        bool CanRedo() const { return m_cursor < m_entries.size(); }
+
+        // Entries of the group to undo (newest first) or redo (oldest first); empty if none
+        std::vector<JournalEntry> TakeUndo();
+        std::vector<JournalEntry> TakeRedo();
+
+        // History read back from the database, in recording order
+        void Restore(std::vector<JournalEntry> entries);
+        void Clear();
+
+        size_t GetEntryCount() const { return m_entries.size(); }
+        size_t GetBytes() const { return m_bytes; }
+        int64_t GetOldestSequence() const { return m_entries.empty() ? 0 : m_entries.front().sequence; }
+
+    private:
+        void Evict();
+
+        std::deque<JournalEntry> m_entries;
+        size_t m_cursor = 0; // Entries before it are applied, from it on undone
+        size_t m_bytes = 0;
+        size_t m_capacity = 1u << 20;
+    };
+}
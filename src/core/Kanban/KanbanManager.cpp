@@ -1,14 +1,73 @@
 #include "core/Kanban/KanbanManager.h"
+#include "core/Kanban/LexoRank.h"
+#include "core/Kanban/KanbanTransfer.h"
+#include "core/IdGenerator.h"
 #include "core/Database/KanbanDatabase.h"
+#include "core/Database/PersistenceWorker.h"
 #include "app/AppConfig.h"
 #include "core/Logger.h"
+#include "core/Utils.h"
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <sstream>
+#include <unordered_set>
 #include <iomanip>
-#include <random>
+
+namespace
+{
+    Kanban::JournalEntry MakeJournalEntry(Kanban::JournalEntry::Type type, const std::string& boardId,
+                                          const std::string& cardId)
+    {
+        Kanban::JournalEntry entry;
+        entry.type = type;
+        entry.boardId = boardId;
+        entry.cardId = cardId;
+        return entry;
+    }
+
+    // Undo history read back at startup; the memory cap trims it further
+    constexpr size_t JOURNAL_LOAD_LIMIT = 4096;
+
+    std::vector<std::string> CardIds(const Kanban::Column& column)
+    {
+        std::vector<std::string> ids;
+        ids.reserve(column.cards.size());
+        for (const auto& card : column.cards)
+        {
+            ids.push_back(card->id);
+        }
+        return ids;
+    }
+}
 
 namespace Kanban
 {
+    // CardCounts Implementation
+    void CardCounts::Add(CardStatus status, Priority priority, bool isOverdue, int sign)
+    {
+        total += sign;
+        byStatus[static_cast<int>(status)] += sign;
+        byPriority[static_cast<int>(priority)] += sign;
+        if (isOverdue) overdue += sign;
+    }
+
+    CardCounts& CardCounts::operator+=(const CardCounts& other)
+    {
+        total += other.total;
+        for (int i = 0; i < 3; ++i) byStatus[i] += other.byStatus[i];
+        for (int i = 0; i < 4; ++i) byPriority[i] += other.byPriority[i];
+        overdue += other.overdue;
+        return *this;
+    }
+
+    bool CardCounts::operator==(const CardCounts& other) const
+    {
+        return total == other.total && overdue == other.overdue &&
+               std::equal(std::begin(byStatus), std::end(byStatus), std::begin(other.byStatus)) &&
+               std::equal(std::begin(byPriority), std::end(byPriority), std::begin(other.byPriority));
+    }
+
     // Card Implementation
     Card::Card()
     {
@@ -42,30 +101,31 @@ namespace Kanban
 
     bool Card::IsOverdue() const
     {
-        if (dueDate.empty()) return false;
-        // Simplified check - in real implementation, parse dueDate and compare with current time
-        auto now = std::chrono::system_clock::now();
-        return false; // TODO: Implement proper date comparison
+        return IsOverdue(Utils::GetTodayDayNumber());
+    }
+
+    bool Card::IsOverdue(int64_t today) const
+    {
+        int64_t dueDay = 0;
+        return status == CardStatus::Active && GetDueDay(dueDay) && dueDay < today;
+    }
+
+    bool Card::GetDueDay(int64_t& dueDay) const
+    {
+        return !dueDate.empty() && Utils::ParseDayNumber(dueDate, dueDay);
     }
 
     std::string Card::GenerateId()
     {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<> dis(1000, 9999);
-        
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        
-        std::stringstream ss;
-        ss << "card_" << time_t << "_" << dis(gen);
-        return ss.str();
+        // Also runs for every card hydrated from the database - cheap, and short enough
+        // to stay in the small-string buffer
+        return IdGenerator::NextString();
     }
 
     // Column Implementation
     Column::Column()
     {
-        id = "col_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count());
+        id = IdGenerator::NextString();
         headerColor = Color(0.3f, 0.5f, 0.8f); // Default blue
     }
 
@@ -78,19 +138,26 @@ namespace Kanban
     {
         if (card && (cardLimit < 0 || static_cast<int>(cards.size()) < cardLimit))
         {
+            if (card->rank.empty())
+            {
+                card->rank = LexoRank::Between(cards.empty() ? std::string() : cards.back()->rank, std::string());
+            }
             cards.push_back(card);
+            countsValid = false;
         }
     }
 
     void Column::RemoveCard(const std::string& cardId)
     {
-        cards.erase(
-            std::remove_if(cards.begin(), cards.end(),
-                [&cardId](const std::shared_ptr<Card>& card) {
-                    return card && card->id == cardId;
-                }),
-            cards.end()
-        );
+        auto removed = std::remove_if(cards.begin(), cards.end(),
+            [&cardId](const std::shared_ptr<Card>& card) {
+                return card && card->id == cardId;
+            });
+        if (removed != cards.end())
+        {
+            cards.erase(removed, cards.end());
+            countsValid = false;
+        }
     }
 
     std::shared_ptr<Card> Column::FindCard(const std::string& cardId)
@@ -113,34 +180,54 @@ namespace Kanban
         return -1;
     }
 
+    const CardCounts& Column::GetCardCounts() const
+    {
+        if (!countsValid)
+        {
+            const int64_t today = Utils::GetTodayDayNumber();
+            counts = CardCounts();
+            for (const auto& card : cards)
+            {
+                if (card) counts.Add(card->status, card->priority, card->IsOverdue(today));
+            }
+            countsValid = true;
+        }
+        return counts;
+    }
+
     int Column::GetActiveCardCount() const
     {
-        return static_cast<int>(std::count_if(cards.begin(), cards.end(),
-            [](const std::shared_ptr<Card>& card) {
-                return card && card->status == CardStatus::Active;
-            }));
+        return GetCardCounts().byStatus[static_cast<int>(CardStatus::Active)];
     }
 
     int Column::GetCompletedCardCount() const
     {
-        return static_cast<int>(std::count_if(cards.begin(), cards.end(),
-            [](const std::shared_ptr<Card>& card) {
-                return card && card->status == CardStatus::Completed;
-            }));
+        return GetCardCounts().byStatus[static_cast<int>(CardStatus::Completed)];
+    }
+
+    void Column::RebalanceRanks()
+    {
+        const auto ranks = LexoRank::Spread(cards.size());
+        for (size_t i = 0; i < cards.size(); ++i)
+        {
+            cards[i]->rank = ranks[i];
+        }
     }
 
     int Column::GetUrgentCardCount() const
     {
-        return static_cast<int>(std::count_if(cards.begin(), cards.end(),
-            [](const std::shared_ptr<Card>& card) {
-                return card && card->priority == Priority::Urgent;
-            }));
+        return GetCardCounts().byPriority[static_cast<int>(Priority::Urgent)];
+    }
+
+    int Column::GetOverdueCardCount() const
+    {
+        return GetCardCounts().overdue;
     }
 
     // Board Implementation
     Board::Board()
     {
-        id = "board_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count());
+        id = IdGenerator::NextString();
         createdAt = std::chrono::system_clock::now();
         modifiedAt = createdAt;
     }
@@ -153,19 +240,40 @@ namespace Kanban
     void Board::AddColumn(const Kanban::Column& column)
     {
         auto newColumn = std::make_unique<Column>(column);
+        if (newColumn->rank.empty())
+        {
+            newColumn->rank = LexoRank::Between(columns.empty() ? std::string() : columns.back()->rank, std::string());
+        }
+        if (!newColumn->cards.empty())
+        {
+            InvalidateCardIndex(); // Its cards are not indexed or counted yet
+        }
         columns.push_back(std::move(newColumn));
         modifiedAt = std::chrono::system_clock::now();
     }
 
     void Board::AddColumn(const std::string& name)
     {
-        auto column = std::make_unique<Column>(name);
-        columns.push_back(std::move(column));
-        modifiedAt = std::chrono::system_clock::now();
+        AddColumn(Column(name));
     }
 
     void Board::RemoveColumn(const std::string& columnId)
     {
+        Column* column = FindColumn(columnId);
+        if (column && cardIndexValid)
+        {
+            UpdateOverdue();
+            for (const auto& card : column->cards)
+            {
+                auto it = cardIndex.find(card->id);
+                if (it != cardIndex.end())
+                {
+                    CountCard(it->second, countedDay, -1);
+                    cardIndex.erase(it);
+                }
+            }
+        }
+
         columns.erase(
             std::remove_if(columns.begin(), columns.end(),
                 [&columnId](const std::unique_ptr<Column>& col) {
@@ -185,10 +293,24 @@ namespace Kanban
             auto column = std::move(columns[fromIndex]);
             columns.erase(columns.begin() + fromIndex);
             columns.insert(columns.begin() + toIndex, std::move(column));
+
+            // Only the moved column gets a new rank
+            columns[toIndex]->rank = LexoRank::Between(
+                toIndex > 0 ? columns[toIndex - 1]->rank : std::string(),
+                toIndex + 1 < static_cast<int>(columns.size()) ? columns[toIndex + 1]->rank : std::string());
             modifiedAt = std::chrono::system_clock::now();
         }
     }
 
+    void Board::RebalanceColumnRanks()
+    {
+        const auto ranks = LexoRank::Spread(columns.size());
+        for (size_t i = 0; i < columns.size(); ++i)
+        {
+            columns[i]->rank = ranks[i];
+        }
+    }
+
     Column* Board::FindColumn(const std::string& columnId)
     {
         auto it = std::find_if(columns.begin(), columns.end(),
@@ -209,90 +331,456 @@ namespace Kanban
         return -1;
     }
 
-    std::shared_ptr<Card> Board::FindCard(const std::string& cardId)
+    void Board::BuildCardIndex() const
     {
-        for (auto& column : columns)
+        cardIndex.clear();
+        cardCounts = CardCounts();
+        dueHeap = DueHeap();
+        countedDay = Utils::GetTodayDayNumber();
+        filterIndex.Clear();
+        slotLocations.clear();
+        visibleValid = false;
+
+        for (const auto& column : columns)
         {
-            if (column)
+            column->counts = CardCounts();
+            column->countsValid = true;
+            for (size_t i = 0; i < column->cards.size(); ++i)
             {
-                auto card = column->FindCard(cardId);
-                if (card) return card;
+                CardLocation& location = cardIndex[column->cards[i]->id];
+                location = CardLocation{ column.get(), column->cards[i].get(), i };
+                CountCard(location, countedDay, 1);
             }
         }
-        return nullptr;
+        cardIndexValid = true;
     }
 
-    bool Board::MoveCard(const std::string& cardId, const std::string& targetColumnId, int targetIndex)
+    void Board::InvalidateCardIndex()
+    {
+        cardIndexValid = false;
+        for (const auto& column : columns)
+        {
+            column->countsValid = false;
+        }
+    }
+
+    void Board::CountCard(CardLocation& location, int64_t today, int sign) const
     {
-        auto card = FindCard(cardId);
-        if (!card) return false;
+        // Adding takes a fresh look at the card; removing takes out what was added, even when
+        // the card has changed since
+        if (sign > 0)
+        {
+            const Card& card = *location.card;
+            location.priority = card.priority;
+            location.status = card.status;
+            location.hasDueDay = card.GetDueDay(location.dueDay);
+            location.overdue = location.status == CardStatus::Active && location.hasDueDay && location.dueDay < today;
 
-        auto targetColumn = FindColumn(targetColumnId);
-        if (!targetColumn) return false;
+            if (location.status == CardStatus::Active && location.hasDueDay && !location.overdue)
+            {
+                // Entries of removed or changed cards are skipped when popped; rebuild the heap
+                // once they outnumber the live ones
+                if (dueHeap.size() > 2 * cardIndex.size() + 64)
+                {
+                    DueHeap live;
+                    for (const auto& [id, other] : cardIndex)
+                    {
+                        if (other.status == CardStatus::Active && other.hasDueDay && !other.overdue && &other != &location)
+                            live.emplace(other.dueDay, id);
+                    }
+                    dueHeap = std::move(live);
+                }
+                dueHeap.emplace(location.dueDay, card.id);
+            }
 
-        // Remove from source column
-        for (auto& column : columns)
+            CardFilterIndex::Attributes attributes;
+            attributes.priority = static_cast<int>(location.priority);
+            attributes.status = static_cast<int>(location.status);
+            attributes.assignee = &card.assignee;
+            attributes.tags = &card.tags;
+            attributes.hasDueDay = location.hasDueDay;
+            attributes.dueDay = location.dueDay;
+            attributes.overdue = location.overdue;
+            location.slot = filterIndex.Add(attributes);
+            if (location.slot >= slotLocations.size())
+            {
+                slotLocations.resize(location.slot + 1, nullptr);
+            }
+            slotLocations[location.slot] = &location;
+        }
+        else
+        {
+            filterIndex.Remove(location.slot);
+            slotLocations[location.slot] = nullptr;
+        }
+        visibleValid = false;
+
+        cardCounts.Add(location.status, location.priority, location.overdue, sign);
+        location.column->counts.Add(location.status, location.priority, location.overdue, sign);
+    }
+
+    void Board::UpdateOverdue() const
+    {
+        const int64_t today = Utils::GetTodayDayNumber();
+        if (!cardIndexValid || today == countedDay)
+        {
+            return;
+        }
+        if (today < countedDay)
+        {
+            BuildCardIndex(); // Clock went back a day - overdue flags have to be taken back
+            return;
+        }
+
+        countedDay = today;
+        while (!dueHeap.empty() && dueHeap.top().first < today)
         {
-            if (column)
+            auto it = cardIndex.find(dueHeap.top().second);
+            if (it != cardIndex.end())
             {
-                int cardIndex = column->FindCardIndex(cardId);
-                if (cardIndex >= 0)
+                CardLocation& location = it->second;
+                if (location.status == CardStatus::Active && location.hasDueDay && !location.overdue &&
+                    location.dueDay == dueHeap.top().first)
                 {
-                    column->cards.erase(column->cards.begin() + cardIndex);
-                    break;
+                    location.overdue = true;
+                    ++cardCounts.overdue;
+                    ++location.column->counts.overdue;
+                    filterIndex.SetOverdue(location.slot, true);
+                    visibleValid = false;
                 }
             }
+            dueHeap.pop();
         }
+    }
 
-        // Add to target column
-        if (targetIndex < 0 || targetIndex >= static_cast<int>(targetColumn->cards.size()))
+    Board::CardLocation* Board::LocateCard(const std::string& cardId)
+    {
+        if (!cardIndexValid)
         {
-            targetColumn->cards.push_back(card);
+            BuildCardIndex();
         }
-        else
+
+        auto it = cardIndex.find(cardId);
+        if (it == cardIndex.end())
+        {
+            return nullptr;
+        }
+
+        // Moves and removals shift the cards behind them without touching their entries;
+        // the card pointer finds the new position with a scan of one column
+        CardLocation& location = it->second;
+        auto& cards = location.column->cards;
+        if (location.position >= cards.size() || cards[location.position].get() != location.card)
+        {
+            auto found = std::find_if(cards.begin(), cards.end(),
+                [&location](const std::shared_ptr<Card>& card) { return card.get() == location.card; });
+            if (found == cards.end())
+            {
+                Logger::Warning("Card index out of date for board {}, rebuilding", id);
+                BuildCardIndex();
+                it = cardIndex.find(cardId);
+                return it != cardIndex.end() ? &it->second : nullptr;
+            }
+            location.position = static_cast<size_t>(found - cards.begin());
+        }
+        return &location;
+    }
+
+    bool Board::ValidateCardIndex() const
+    {
+        if (!cardIndexValid)
+        {
+            return true; // Rebuilt on the next lookup
+        }
+
+        size_t count = 0;
+        for (const auto& column : columns)
+        {
+            for (const auto& card : column->cards)
+            {
+                auto it = cardIndex.find(card->id);
+                if (it == cardIndex.end() || it->second.column != column.get() || it->second.card != card.get())
+                {
+                    Logger::Error("Card index mismatch on board {}: card {}", id, card->id);
+                    return false;
+                }
+                ++count;
+            }
+        }
+
+        if (count != cardIndex.size())
+        {
+            Logger::Error("Card index of board {} has {} entries for {} cards", id, cardIndex.size(), count);
+            return false;
+        }
+        for (const auto& [cardId, location] : cardIndex)
+        {
+            if (location.slot >= slotLocations.size() || slotLocations[location.slot] != &location)
+            {
+                Logger::Error("Filter slot of card {} on board {} is out of date", cardId, id);
+                return false;
+            }
+        }
+
+        CardCounts boardCounts;
+        for (const auto& column : columns)
+        {
+            CardCounts columnCounts;
+            for (const auto& card : column->cards)
+            {
+                columnCounts.Add(card->status, card->priority, card->IsOverdue(countedDay));
+            }
+            if (!column->countsValid || !(column->counts == columnCounts))
+            {
+                Logger::Error("Card counters of column {} on board {} are out of date", column->id, id);
+                return false;
+            }
+            boardCounts += columnCounts;
+        }
+        if (!(cardCounts == boardCounts))
+        {
+            Logger::Error("Card counters of board {} are out of date", id);
+            return false;
+        }
+        return true;
+    }
+
+    std::shared_ptr<Card> Board::FindCard(const std::string& cardId)
+    {
+        CardLocation* location = LocateCard(cardId);
+        return location ? location->column->cards[location->position] : nullptr;
+    }
+
+    Column* Board::FindCardColumn(const std::string& cardId)
+    {
+        CardLocation* location = LocateCard(cardId);
+        return location ? location->column : nullptr;
+    }
+
+    int Board::FindCardIndex(const std::string& cardId)
+    {
+        CardLocation* location = LocateCard(cardId);
+        return location ? static_cast<int>(location->position) : -1;
+    }
+
+    bool Board::AddCard(const std::string& columnId, std::shared_ptr<Card> card)
+    {
+        Column* column = FindColumn(columnId);
+        if (!column || !card) return false;
+
+        UpdateOverdue(); // A rebuild has to happen before the card is in the column
+        const size_t position = column->cards.size();
+        column->AddCard(card);
+        if (column->cards.size() == position)
+        {
+            return false; // Column is at its card limit
+        }
+
+        if (cardIndexValid)
+        {
+            CardLocation& location = cardIndex[card->id];
+            location = CardLocation{ column, card.get(), position };
+            column->countsValid = true; // Column::AddCard cannot tell what the board counts as overdue
+            CountCard(location, countedDay, 1);
+        }
+        modifiedAt = std::chrono::system_clock::now();
+
+#ifndef NDEBUG
+        ValidateCardIndex();
+#endif
+        return true;
+    }
+
+    bool Board::RemoveCard(const std::string& cardId)
+    {
+        UpdateOverdue(); // May rebuild the index, so before the lookup
+        CardLocation* location = LocateCard(cardId);
+        if (!location) return false;
+
+        CountCard(*location, countedDay, -1);
+
+        auto& cards = location->column->cards;
+        cards.erase(cards.begin() + location->position);
+        cardIndex.erase(cardId);
+        modifiedAt = std::chrono::system_clock::now();
+
+#ifndef NDEBUG
+        ValidateCardIndex();
+#endif
+        return true;
+    }
+
+    bool Board::MoveCard(const std::string& cardId, const std::string& targetColumnId, int targetIndex)
+    {
+        UpdateOverdue();
+        CardLocation* location = LocateCard(cardId);
+        if (!location) return false;
+
+        auto targetColumn = FindColumn(targetColumnId);
+        if (!targetColumn) return false;
+
+        CountCard(*location, countedDay, -1);
+
+        // Remove from source column
+        auto& source = location->column->cards;
+        std::shared_ptr<Card> card = source[location->position];
+        source.erase(source.begin() + location->position);
+
+        // Add to target column
+        auto& cards = targetColumn->cards;
+        if (targetIndex < 0 || targetIndex >= static_cast<int>(cards.size()))
         {
-            targetColumn->cards.insert(targetColumn->cards.begin() + targetIndex, card);
+            targetIndex = static_cast<int>(cards.size());
         }
+        cards.insert(cards.begin() + targetIndex, card);
+        location->column = targetColumn;
+        location->position = static_cast<size_t>(targetIndex);
+        CountCard(*location, countedDay, 1);
+
+        // Only the moved card gets a new rank; empty when its neighbours leave no room
+        card->rank = LexoRank::Between(
+            targetIndex > 0 ? cards[targetIndex - 1]->rank : std::string(),
+            targetIndex + 1 < static_cast<int>(cards.size()) ? cards[targetIndex + 1]->rank : std::string());
 
         card->modifiedAt = std::chrono::system_clock::now();
         modifiedAt = std::chrono::system_clock::now();
+
+#ifndef NDEBUG
+        ValidateCardIndex();
+#endif
         return true;
     }
 
-    int Board::GetTotalCardCount() const
+    bool Board::RefreshCardCounts(const std::string& cardId)
     {
-        int count = 0;
-        for (const auto& column : columns)
+        UpdateOverdue();
+        CardLocation* location = LocateCard(cardId);
+        if (!location) return false;
+
+        CountCard(*location, countedDay, -1);
+        CountCard(*location, countedDay, 1);
+
+#ifndef NDEBUG
+        ValidateCardIndex();
+#endif
+        return true;
+    }
+
+    CardCounts Board::GetCardCounts() const
+    {
+        if (!isLoaded)
+        {
+            CardCounts stored;
+            stored.total = storedCardCount;
+            stored.byStatus[static_cast<int>(CardStatus::Completed)] = storedCompletedCount;
+            stored.overdue = storedOverdueCount;
+            return stored;
+        }
+
+        if (!cardIndexValid)
+        {
+            BuildCardIndex();
+        }
+        else
         {
-            if (column) count += static_cast<int>(column->cards.size());
+            UpdateOverdue();
         }
-        return count;
+        return cardCounts;
+    }
+
+    int Board::GetTotalCardCount() const
+    {
+        return GetCardCounts().total;
     }
 
     int Board::GetCompletedCardCount() const
     {
-        int count = 0;
-        for (const auto& column : columns)
+        return GetCardCounts().byStatus[static_cast<int>(CardStatus::Completed)];
+    }
+
+    int Board::GetOverdueCardCount() const
+    {
+        return GetCardCounts().overdue;
+    }
+
+    void Board::SetFilter(const CardFilter& cardFilter)
+    {
+        if (cardFilter != filter)
         {
-            if (column) count += column->GetCompletedCardCount();
+            filter = cardFilter;
+            visibleValid = false;
         }
-        return count;
     }
 
-    int Board::GetOverdueCardCount() const
+    const std::vector<size_t>& Board::GetVisibleCards(const Column& column) const
     {
-        int count = 0;
-        for (const auto& column : columns)
+        static const std::vector<size_t> none;
+        if (!cardIndexValid)
+        {
+            BuildCardIndex();
+        }
+        else
+        {
+            UpdateOverdue();
+        }
+        if (!visibleValid)
+        {
+            BuildVisibleCards();
+        }
+
+        auto it = visibleCards.find(&column);
+        return it != visibleCards.end() ? it->second : none;
+    }
+
+    size_t Board::GetVisibleCardCount() const
+    {
+        if (columns.empty())
+        {
+            return 0;
+        }
+        GetVisibleCards(*columns.front()); // Brings the cache up to date
+        return visibleCount;
+    }
+
+    void Board::BuildVisibleCards() const
+    {
+        SlotBitset matches;
+        filterIndex.Match(filter, matches);
+
+        for (auto& [column, positions] : visibleCards)
         {
-            if (column)
+            positions.clear(); // Keeps the capacity for the next change
+        }
+        visibleCount = 0;
+        matches.ForEach([this](size_t slot) {
+            CardLocation& location = *slotLocations[slot];
+            const auto& cards = location.column->cards;
+            if (location.position >= cards.size() || cards[location.position].get() != location.card)
             {
-                for (const auto& card : column->cards)
+                // Moves and removals leave the hints behind them stale; one pass over the
+                // column refreshes all of them
+                for (size_t i = 0; i < cards.size(); ++i)
                 {
-                    if (card && card->IsOverdue()) count++;
+                    auto it = cardIndex.find(cards[i]->id);
+                    if (it != cardIndex.end())
+                        it->second.position = i;
                 }
             }
+            visibleCards[location.column].push_back(location.position);
+            ++visibleCount;
+        });
+
+        for (auto it = visibleCards.begin(); it != visibleCards.end();)
+        {
+            if (it->second.empty())
+            {
+                it = visibleCards.erase(it); // Also drops removed columns
+                continue;
+            }
+            std::sort(it->second.begin(), it->second.end());
+            ++it;
         }
-        return count;
+        visibleValid = true;
     }
 
     void Board::CreateDefaultColumns()
@@ -301,14 +789,12 @@ namespace Kanban
         AddColumn("In Progress");
         AddColumn("Review");
         AddColumn("Done");
-
-        // TODO: Set column order to 1, 2, 3, 4 (Utilize to column_order in DB, but we need to change the object proeprty too)
     }
 
     // Project Implementation
     Project::Project()
     {
-        id = "proj_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count());
+        id = IdGenerator::NextString();
         createdAt = std::chrono::system_clock::now();
         modifiedAt = createdAt;
     }
@@ -382,28 +868,33 @@ namespace Kanban
         return static_cast<int>(boards.size());
     }
 
-    int Project::GetTotalCardCount() const
+    CardCounts Project::GetCardCounts() const
     {
-        int count = 0;
+        CardCounts counts;
         for (const auto& board : boards)
         {
-            if (board) count += board->GetTotalCardCount();
+            if (board) counts += board->GetCardCounts();
         }
-        return count;
+        return counts;
     }
 
-    int Project::GetCompletedCardCount() const
+    int Project::GetTotalCardCount() const
     {
-        int count = 0;
-        for (const auto& board : boards)
-        {
-            if (board) count += board->GetCompletedCardCount();
-        }
-        return count;
+        return GetCardCounts().total;
     }
-}
 
-// KanbanManager Implementation
+    int Project::GetCompletedCardCount() const
+    {
+        return GetCardCounts().byStatus[static_cast<int>(CardStatus::Completed)];
+    }
+
+    int Project::GetOverdueCardCount() const
+    {
+        return GetCardCounts().overdue;
+    }
+}
+
+// KanbanManager Implementation
 KanbanManager::KanbanManager(KanbanDatabase& database)
     : m_database(database)
 {
@@ -430,17 +921,190 @@ bool KanbanManager::loadProjectsFromDB(KanbanDatabase* db)
     if (!db) return false;
 
     m_projects.clear();
-    m_projects = db->GetAllProjects();
+    ClearLoadedBoards();
+
+    // Old completed cards go to cold storage first, so they are never hydrated
+    if (m_archiveAfterDays > 0)
+    {
+        std::vector<std::string> archivedIds;
+        if (!db->ArchiveCards(GetArchiveCutoffMs(), archivedIds))
+        {
+            Logger::Warning("Card archive stopped: {}", db->GetLastError());
+        }
+    }
+
+    m_projects = m_lazyLoading ? db->GetProjectHeaders() : db->GetAllProjectsBulk();
+
+    m_journal.Clear();
+    if (m_persistJournal)
+    {
+        m_journal.Restore(db->LoadJournal(JOURNAL_LOAD_LIMIT));
+    }
+
+    // Settings saved before the integer ids still name the current project and board
+    // by their old string ids
+    uint64_t id = 0;
+    if (!m_currentProjectId.empty() && !IdGenerator::Parse(m_currentProjectId, id))
+    {
+        m_currentProjectId = db->ResolveLegacyId(m_currentProjectId);
+    }
+    if (!m_currentBoardId.empty() && !IdGenerator::Parse(m_currentBoardId, id))
+    {
+        m_currentBoardId = db->ResolveLegacyId(m_currentBoardId);
+    }
 
-    Logger::Info("Loaded {} projects from database " + static_cast<int>(m_projects.size()));
+    Logger::Info("Loaded {} projects from database{}", m_projects.size(), m_lazyLoading ? " (headers only)" : "");
     return true;
 }
 
+void KanbanManager::SetLazyLoading(bool enabled, size_t boardCacheBytes)
+{
+    m_lazyLoading = enabled;
+    m_boardCacheBytes = boardCacheBytes;
+    EvictBoards();
+}
+
+void KanbanManager::EnsureBoardLoaded(Kanban::Board& board)
+{
+    if (board.isLoaded && !m_lazyLoading)
+    {
+        return;
+    }
+
+    auto cached = m_loadedBoardIndex.find(board.id);
+    if (board.isLoaded)
+    {
+        if (cached == m_loadedBoardIndex.end())
+        {
+            // Created in memory - track it like a loaded board
+            m_loadedBoards.push_front({ board.id, EstimateBoardBytes(board) });
+            m_loadedBoardIndex[board.id] = m_loadedBoards.begin();
+            m_loadedBoardBytes += m_loadedBoards.front().bytes;
+            EvictBoards();
+        }
+        else if (cached != m_loadedBoardIndex.end() && cached->second != m_loadedBoards.begin())
+        {
+            m_loadedBoards.splice(m_loadedBoards.begin(), m_loadedBoards, cached->second);
+        }
+        return;
+    }
+
+    // Queued writes for this board have to reach the database before it is read back
+    if (m_persistenceWorker)
+    {
+        m_persistenceWorker->Flush();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (!m_database.LoadBoardContents(board))
+    {
+        Logger::Error("Failed to load board '{}': {}", board.name, m_database.GetLastError());
+    }
+
+    m_loadedBoards.push_front({ board.id, EstimateBoardBytes(board) });
+    m_loadedBoardIndex[board.id] = m_loadedBoards.begin();
+    m_loadedBoardBytes += m_loadedBoards.front().bytes;
+
+    Logger::Debug("Loaded board '{}' ({} cards, ~{} KiB) in {} ms", board.name, board.GetTotalCardCount(),
+                  m_loadedBoards.front().bytes / 1024,
+                  std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    EvictBoards();
+}
+
+void KanbanManager::EvictBoards()
+{
+    while (m_loadedBoardBytes > m_boardCacheBytes && m_loadedBoards.size() > 1)
+    {
+        LoadedBoard& victim = m_loadedBoards.back();
+        if (victim.boardId == m_currentBoardId)
+        {
+            break;
+        }
+
+        // Keep the counts the board list shows, then drop the contents
+        if (Kanban::Board* board = FindBoardInProjects(victim.boardId))
+        {
+            const Kanban::CardCounts counts = board->GetCardCounts();
+            board->storedCardCount = counts.total;
+            board->storedCompletedCount = counts.byStatus[static_cast<int>(Kanban::CardStatus::Completed)];
+            board->storedOverdueCount = counts.overdue;
+            board->columns.clear();
+            board->InvalidateCardIndex();
+            board->isLoaded = false;
+        }
+
+        Logger::Debug("Unloaded board {} (~{} KiB)", victim.boardId, victim.bytes / 1024);
+        m_loadedBoardBytes -= victim.bytes;
+        m_loadedBoardIndex.erase(victim.boardId);
+        m_loadedBoards.pop_back();
+    }
+}
+
+void KanbanManager::ForgetBoard(const std::string& boardId)
+{
+    auto cached = m_loadedBoardIndex.find(boardId);
+    if (cached != m_loadedBoardIndex.end())
+    {
+        m_loadedBoardBytes -= cached->second->bytes;
+        m_loadedBoards.erase(cached->second);
+        m_loadedBoardIndex.erase(cached);
+    }
+}
+
+void KanbanManager::ClearLoadedBoards()
+{
+    m_loadedBoards.clear();
+    m_loadedBoardIndex.clear();
+    m_loadedBoardBytes = 0;
+}
+
+Kanban::Board* KanbanManager::FindBoardInProjects(const std::string& boardId)
+{
+    for (const auto& project : m_projects)
+    {
+        if (Kanban::Board* board = project ? project->FindBoard(boardId) : nullptr)
+        {
+            return board;
+        }
+    }
+    return nullptr;
+}
+
+size_t KanbanManager::EstimateBoardBytes(const Kanban::Board& board)
+{
+    // Heap footprint of the contents: object sizes plus string and vector capacities
+    size_t bytes = 0;
+    for (const auto& column : board.columns)
+    {
+        if (!column) continue;
+
+        bytes += sizeof(Kanban::Column) + column->id.capacity() + column->name.capacity();
+        bytes += column->cards.capacity() * sizeof(std::shared_ptr<Kanban::Card>);
+
+        for (const auto& card : column->cards)
+        {
+            if (!card) continue;
+
+            // make_shared puts the control block next to the card
+            bytes += sizeof(Kanban::Card) + 2 * sizeof(void*);
+            bytes += card->id.capacity() + card->title.capacity() + card->description.capacity() +
+                     card->assignee.capacity() + card->dueDate.capacity();
+            bytes += card->tags.capacity() * sizeof(std::string);
+            for (const auto& tag : card->tags)
+            {
+                bytes += tag.capacity();
+            }
+        }
+    }
+    return bytes;
+}
+
 void KanbanManager::Shutdown()
 {
     SaveSettings();
     
     m_projects.clear();
+    ClearLoadedBoards();
     m_currentProjectId.clear();
     m_currentBoardId.clear();
     
@@ -459,37 +1123,24 @@ void KanbanManager::CreateProject(const std::string& name, const std::string& de
         m_currentBoardId = project->boards[0]->id;
     }
     
-    if (m_database.CreateProject(*project))
-    {
-        Logger::Debug("Project '{}' created in database with ID: {}", name, project->id);
-    }
-    else
-    {
-        Logger::Error("Failed to create project '{}' in database", name);
-    }
+    // Project, its first board and the board's columns are saved as one write
+    Persist("create project '" + name + "'", [&database = m_database, snapshot = Kanban::Project(*project)]() {
+        if (!database.CreateProject(snapshot))
+            return false;
 
-    if (m_database.CreateBoard(*project->boards[0], project->id))
-    {
-        // Save columns
-        auto& board = *project->boards[0];
-        for (const auto& column : board.columns)
+        for (const auto& board : snapshot.boards)
         {
-            if (m_database.CreateColumn(*column, board.id))
-            {
-                Logger::Debug("Column '{}' created in database with ID: {}", column->name, column->id);
-            }
-            else
+            if (!database.CreateBoard(*board, snapshot.id))
+                return false;
+
+            for (const auto& column : board->columns)
             {
-                Logger::Error("Failed to create column '{}' in database", column->name);
+                if (!database.CreateColumn(*column, board->id))
+                    return false;
             }
         }
-
-        Logger::Debug("Board '{}' created in database with ID: {}", project->boards[0]->name, project->boards[0]->id);    
-    }
-    else
-    {
-        Logger::Error("Failed to create board '{}' in database", project->boards[0]->name);
-    }
+        return true;
+    });
 
     m_projects.push_back(std::move(project)); // Move after DB is saved
 
@@ -518,6 +1169,10 @@ void KanbanManager::DeleteProject(const std::string& projectId)
     if (it != m_projects.end())
     {
         std::string name = (*it)->name;
+        for (const auto& board : (*it)->boards)
+        {
+            ForgetBoard(board->id);
+        }
         
         // Update current IDs if we're deleting the current project
         if (m_currentProjectId == projectId)
@@ -544,7 +1199,9 @@ void KanbanManager::DeleteProject(const std::string& projectId)
         }
         
         // Remove in DB
-        m_database.DeleteProject(projectId);
+        Persist("delete project '" + name + "'", [&database = m_database, projectId]() {
+            return database.DeleteProject(projectId);
+        });
 
         m_projects.erase(it);
         Logger::Info("Deleted project: {}", name);
@@ -598,16 +1255,21 @@ bool KanbanManager::UpdateProject(const Kanban::Project& project)
         existingProject->description = project.description;
         existingProject->modifiedAt = std::chrono::system_clock::now();
         
-        if (m_database.UpdateProject(*existingProject))
+        // The update only touches project fields, so leave the boards out of the copy
+        Kanban::Project snapshot;
+        snapshot.id = existingProject->id;
+        snapshot.name = existingProject->name;
+        snapshot.description = existingProject->description;
+        snapshot.isActive = existingProject->isActive;
+
+        if (Persist("update project '" + project.name + "'", [&database = m_database, snapshot]() {
+                return database.UpdateProject(snapshot);
+            }))
         {
-            Logger::Debug("Updated project '{}' in database", project.name);
+            Logger::Debug("Updated project '{}'", project.name);
             NotifyProjectChanged(existingProject);
             return true;
         }
-        else
-        {
-            Logger::Error("Failed to update project '{}' in database", project.name);
-        }
     }
     return false;
 }
@@ -623,28 +1285,19 @@ void KanbanManager::CreateBoard(const std::string& name, const std::string& desc
         
         m_currentBoardId = board->id;
 
-        // Save to DB first priot std::move()
-        if (m_database.CreateBoard(*board, project->id))
-        {
-            Logger::Debug("Board '{}' created in database with ID: {}", name, board->id);
-        }
-        else
-        {
-            Logger::Error("Failed to create board '{}' in database", name);
-        }
+        // Save board and columns to DB - snapshot taken before std::move()
+        Persist("create board '" + name + "'",
+            [&database = m_database, snapshot = Kanban::Board(*board), projectId = project->id]() {
+                if (!database.CreateBoard(snapshot, projectId))
+                    return false;
 
-        // Save columns to DB
-        for (const auto& column : board->columns)
-        {
-            if (m_database.CreateColumn(*column, board->id))
-            {
-                Logger::Debug("Column '{}' created in database with ID: {}", column->name, column->id);
-            }
-            else
-            {
-                Logger::Error("Failed to create column '{}' in database", column->name);
-            }
-        }
+                for (const auto& column : snapshot.columns)
+                {
+                    if (!database.CreateColumn(*column, snapshot.id))
+                        return false;
+                }
+                return true;
+            });
 
         project->boards.push_back(std::move(board));
         
@@ -662,16 +1315,12 @@ void KanbanManager::DeleteBoard(const std::string& boardId)
         std::string name = board ? board->name : "Unknown";
         
         project->RemoveBoard(boardId);
+        ForgetBoard(boardId);
 
         // Update to DB
-        if (m_database.DeleteBoard(boardId))
-        {
-            Logger::Debug("Board '{}' deleted from database", name);
-        }
-        else
-        {
-            Logger::Error("Failed to delete board '{}' from database", name);
-        }
+        Persist("delete board '" + name + "'", [&database = m_database, boardId]() {
+            return database.DeleteBoard(boardId);
+        });
         
         // Update current board if we deleted it
         if (m_currentBoardId == boardId)
@@ -691,7 +1340,12 @@ void KanbanManager::DeleteBoard(const std::string& boardId)
 Kanban::Board* KanbanManager::GetCurrentBoard()
 {
     auto project = GetCurrentProject();
-    return project ? project->FindBoard(m_currentBoardId) : nullptr;
+    auto board = project ? project->FindBoard(m_currentBoardId) : nullptr;
+    if (board)
+    {
+        EnsureBoardLoaded(*board);
+    }
+    return board;
 }
 
 void KanbanManager::SetCurrentBoard(const std::string& boardId)
@@ -714,16 +1368,21 @@ bool KanbanManager::UpdateBoard(const Kanban::Board& board)
         existingBoard->description = board.description;
         existingBoard->modifiedAt = std::chrono::system_clock::now();
         
-        if (m_database.UpdateBoard(*existingBoard))
+        // The update only touches board fields, so leave the columns out of the copy
+        Kanban::Board snapshot;
+        snapshot.id = existingBoard->id;
+        snapshot.name = existingBoard->name;
+        snapshot.description = existingBoard->description;
+        snapshot.isActive = existingBoard->isActive;
+
+        if (Persist("update board '" + board.name + "'", [&database = m_database, snapshot]() {
+                return database.UpdateBoard(snapshot);
+            }))
         {
-            Logger::Debug("Updated board '{}' in database", board.name);
+            Logger::Debug("Updated board '{}'", board.name);
             NotifyBoardChanged(existingBoard);
             return true;
         }
-        else
-        {
-            Logger::Error("Failed to update board '{}' in database", board.name);
-        }
     }
     return false;
 }
@@ -733,20 +1392,18 @@ void KanbanManager::CreateCard(const std::string& columnId, const std::string& t
     auto board = GetCurrentBoard();
     if (board)
     {
-        auto column = board->FindColumn(columnId);
-        if (column)
+        auto card = std::make_shared<Kanban::Card>(title);
+        if (board->AddCard(columnId, card))
         {
-            auto card = std::make_shared<Kanban::Card>(title);
-            column->AddCard(card);
-
-            if (m_database.CreateCard(*card, column->id))
-            {
-                Logger::Debug("Card '{}' created in database with ID: {}", title, card->id);
-            }
-            else
-            {
-                Logger::Error("Failed to create card '{}' in database", title);
-            }
+            Persist("create card '" + title + "'",
+                [&database = m_database, snapshot = Kanban::Card(*card), columnId]() {
+                    return database.CreateCard(snapshot, columnId);
+                });
+
+            auto entry = MakeJournalEntry(Kanban::JournalEntry::Type::CardCreated, board->id, card->id);
+            entry.columnAfter = columnId;
+            entry.after = Kanban::JournalEntry::EncodeCard(*card);
+            RecordChange(std::move(entry));
             
             Logger::Info("Created card: {}", title);
             NotifyCardUpdated(card);
@@ -761,23 +1418,25 @@ void KanbanManager::DeleteCard(const std::string& cardId)
     {
         auto card = board->FindCard(cardId);
         std::string title = card ? card->title : "Unknown";
-        
-        for (auto& column : board->columns)
+
+        Kanban::JournalEntry entry;
+        if (card)
         {
-            if (column)
-            {
-                column->RemoveCard(cardId);
+            entry = MakeJournalEntry(Kanban::JournalEntry::Type::CardDeleted, board->id, cardId);
+            entry.columnBefore = board->FindCardColumn(cardId)->id;
+            entry.before = Kanban::JournalEntry::EncodeCard(*card);
+        }
+        
+        board->RemoveCard(cardId);
 
-                // Remove from DB
-                if (m_database.DeleteCard(cardId))
-                {
-                    Logger::Debug("Card '{}' deleted from database", title);
-                }
-                else
-                {
-                    Logger::Error("Failed to delete card '{}' from database", title);
-                }
-            }
+        // Remove from DB
+        Persist("delete card '" + title + "'", [&database = m_database, cardId]() {
+            return database.DeleteCard(cardId);
+        });
+
+        if (card)
+        {
+            RecordChange(std::move(entry));
         }
         
         Logger::Info("Deleted card: {}", title);
@@ -790,19 +1449,76 @@ void KanbanManager::UpdateCard(std::shared_ptr<Kanban::Card> card)
     if (card)
     {
         card->modifiedAt = std::chrono::system_clock::now();
+        if (auto board = GetCurrentBoard())
+        {
+            board->RefreshCardCounts(card->id); // Status, priority or due date may have changed
+        }
         Logger::Debug("Updated card: {}", card->title);
         NotifyCardUpdated(card);
 
         // Save to DB
-        if (m_database.UpdateCard(*card))
-        {
-            Logger::Debug("Card '{}' updated in database", card->title);
-        }
-        else
+        Persist("update card '" + card->title + "'", [&database = m_database, snapshot = Kanban::Card(*card)]() {
+            return database.UpdateCard(snapshot);
+        });
+    }
+}
+
+bool KanbanManager::EditCard(const Kanban::Card& edited)
+{
+    auto board = GetCurrentBoard();
+    auto card = board ? board->FindCard(edited.id) : nullptr;
+    if (!card)
+    {
+        return false;
+    }
+
+    using Field = Kanban::JournalEntry::Field;
+    static const Field fields[] = { Field::Title, Field::Description, Field::Priority, Field::Status,
+                                    Field::Color, Field::Assignee, Field::DueDate, Field::Tags };
+
+    std::vector<Kanban::JournalEntry> journal;
+    bool fieldsChanged = false;
+    bool tagsChanged = false;
+    for (Field field : fields)
+    {
+        auto entry = MakeJournalEntry(Kanban::JournalEntry::Type::CardChanged, board->id, card->id);
+        entry.field = field;
+        entry.before = Kanban::JournalEntry::GetField(*card, field);
+        entry.after = Kanban::JournalEntry::GetField(edited, field);
+        if (entry.before == entry.after)
         {
-            Logger::Error("Failed to update card '{}' in database", card->title);
+            continue;
         }
+
+        Kanban::JournalEntry::SetField(*card, field, entry.after);
+        (field == Field::Tags ? tagsChanged : fieldsChanged) = true;
+        journal.push_back(std::move(entry));
+    }
+
+    if (journal.empty())
+    {
+        return true;
+    }
+
+    card->modifiedAt = std::chrono::system_clock::now();
+    board->RefreshCardCounts(card->id);
+    Logger::Debug("Edited card: {}", card->title);
+    NotifyCardUpdated(card);
+
+    Persist("edit card '" + card->title + "'",
+        [&database = m_database, snapshot = Kanban::Card(*card), fieldsChanged, tagsChanged]() {
+            if (fieldsChanged && !database.UpdateCard(snapshot))
+                return false;
+            return !tagsChanged || database.UpdateCardTags(snapshot.id, snapshot.tags);
+        });
+
+    BeginJournalGroup();
+    for (auto& entry : journal)
+    {
+        RecordChange(std::move(entry));
     }
+    EndJournalGroup();
+    return true;
 }
 
 std::shared_ptr<Kanban::Card> KanbanManager::FindCard(const std::string& cardId)
@@ -811,6 +1527,375 @@ std::shared_ptr<Kanban::Card> KanbanManager::FindCard(const std::string& cardId)
     return board ? board->FindCard(cardId) : nullptr;
 }
 
+size_t KanbanManager::ApplyCardChanges(const std::vector<Kanban::CardChange>& changes)
+{
+    auto board = GetCurrentBoard();
+    if (!board || changes.empty())
+    {
+        return 0;
+    }
+
+    std::vector<KanbanDatabase::CardWrite> writes;
+    writes.reserve(changes.size());
+    std::unordered_map<std::string, size_t> writeIndex; // Card id -> its entry in writes
+    std::vector<Kanban::Column*> crowdedColumns;
+    const auto now = std::chrono::system_clock::now();
+
+    // Recorded once the final ranks are known; moved cards are kept for their rank
+    std::vector<Kanban::JournalEntry> journal;
+    std::vector<std::shared_ptr<Kanban::Card>> journalCards;
+    auto journalField = [&](const Kanban::Card& card, Kanban::JournalEntry::Field field, const auto& change) {
+        if (!change)
+            return;
+        auto entry = MakeJournalEntry(Kanban::JournalEntry::Type::CardChanged, board->id, card.id);
+        entry.field = field;
+        entry.before = Kanban::JournalEntry::GetField(card, field);
+        journal.push_back(std::move(entry));
+        journalCards.push_back(nullptr);
+    };
+
+    for (const auto& change : changes)
+    {
+        auto card = board->FindCard(change.cardId);
+        if (!card)
+        {
+            Logger::Warning("Bulk change skipped unknown card {}", change.cardId);
+            continue;
+        }
+
+        const size_t journalStart = journal.size();
+        journalField(*card, Kanban::JournalEntry::Field::Priority, change.priority);
+        journalField(*card, Kanban::JournalEntry::Field::Status, change.status);
+        journalField(*card, Kanban::JournalEntry::Field::Assignee, change.assignee);
+        journalField(*card, Kanban::JournalEntry::Field::DueDate, change.dueDate);
+        journalField(*card, Kanban::JournalEntry::Field::Tags, change.tags);
+
+        const bool fieldsChanged = change.priority || change.status || change.assignee || change.dueDate;
+        if (change.priority) card->priority = *change.priority;
+        if (change.status) card->status = *change.status;
+        if (change.assignee) card->assignee = *change.assignee;
+        if (change.dueDate) card->dueDate = *change.dueDate;
+        if (change.tags) card->tags = *change.tags;
+        if (fieldsChanged)
+        {
+            card->modifiedAt = now;
+        }
+        if (fieldsChanged || change.tags)
+        {
+            board->RefreshCardCounts(card->id);
+        }
+        for (size_t i = journalStart; i < journal.size(); ++i)
+        {
+            journal[i].after = Kanban::JournalEntry::GetField(*card, journal[i].field);
+        }
+
+        // Moves append, so a run of moves into one column only ever extends its last rank
+        bool moved = false;
+        Kanban::Column* sourceColumn = board->FindCardColumn(card->id);
+        if (!change.targetColumnId.empty() && sourceColumn->id != change.targetColumnId)
+        {
+            auto entry = MakeJournalEntry(Kanban::JournalEntry::Type::CardMoved, board->id, card->id);
+            entry.columnBefore = sourceColumn->id;
+            entry.columnAfter = change.targetColumnId;
+            entry.before = card->rank;
+
+            moved = board->MoveCard(card->id, change.targetColumnId);
+            if (moved)
+            {
+                journal.push_back(std::move(entry));
+                journalCards.push_back(card);
+            }
+            if (moved && Kanban::LexoRank::NeedsRebalance(card->rank))
+            {
+                Kanban::Column* column = board->FindColumn(change.targetColumnId);
+                if (std::find(crowdedColumns.begin(), crowdedColumns.end(), column) == crowdedColumns.end())
+                {
+                    crowdedColumns.push_back(column);
+                }
+            }
+        }
+
+        if (!fieldsChanged && !change.tags && !moved)
+        {
+            continue;
+        }
+
+        // A card named twice is written once, with everything applied to it
+        auto [entry, added] = writeIndex.emplace(card->id, writes.size());
+        if (added)
+        {
+            writes.push_back({ *card, std::string(), false, false });
+        }
+        KanbanDatabase::CardWrite& write = writes[entry->second];
+        if (!added) write.card = *card;
+        write.updateFields = write.updateFields || fieldsChanged;
+        write.updateTags = write.updateTags || change.tags.has_value();
+        if (moved) write.columnId = change.targetColumnId;
+    }
+
+    // Columns whose ranks ran out of room are re-spread; every card in them gets its rank written
+    for (Kanban::Column* column : crowdedColumns)
+    {
+        column->RebalanceRanks();
+        for (const auto& card : column->cards)
+        {
+            auto [entry, added] = writeIndex.emplace(card->id, writes.size());
+            if (added)
+            {
+                writes.push_back({ *card, std::string(), false, false });
+            }
+            writes[entry->second].card.rank = card->rank;
+            writes[entry->second].columnId = column->id;
+        }
+        Logger::Debug("Rebalancing ranks of column {}", column->id);
+    }
+
+    if (writes.empty())
+    {
+        return 0;
+    }
+
+    const size_t changed = writes.size();
+    Persist("update " + std::to_string(changed) + " cards",
+        [&database = m_database, writes = std::move(writes)]() {
+            return database.UpdateCards(writes);
+        });
+
+    // One undo step for the whole operation
+    BeginJournalGroup();
+    for (size_t i = 0; i < journal.size(); ++i)
+    {
+        if (journalCards[i])
+        {
+            journal[i].after = journalCards[i]->rank;
+        }
+        RecordChange(std::move(journal[i]));
+    }
+    EndJournalGroup();
+
+    Logger::Info("Bulk updated {} cards", changed);
+    NotifyBoardChanged(board);
+    return changed;
+}
+
+size_t KanbanManager::MoveCards(const std::vector<std::string>& cardIds, const std::string& targetColumnId)
+{
+    std::vector<Kanban::CardChange> changes(cardIds.size());
+    for (size_t i = 0; i < cardIds.size(); ++i)
+    {
+        changes[i].cardId = cardIds[i];
+        changes[i].targetColumnId = targetColumnId;
+    }
+    return ApplyCardChanges(changes);
+}
+
+size_t KanbanManager::SetCardsPriority(const std::vector<std::string>& cardIds, Kanban::Priority priority)
+{
+    std::vector<Kanban::CardChange> changes(cardIds.size());
+    for (size_t i = 0; i < cardIds.size(); ++i)
+    {
+        changes[i].cardId = cardIds[i];
+        changes[i].priority = priority;
+    }
+    return ApplyCardChanges(changes);
+}
+
+size_t KanbanManager::SetCardsTags(const std::vector<std::string>& cardIds, const std::vector<std::string>& tags)
+{
+    std::vector<Kanban::CardChange> changes(cardIds.size());
+    for (size_t i = 0; i < cardIds.size(); ++i)
+    {
+        changes[i].cardId = cardIds[i];
+        changes[i].tags = tags;
+    }
+    return ApplyCardChanges(changes);
+}
+
+size_t KanbanManager::ArchiveColumn(const std::string& columnId)
+{
+    auto board = GetCurrentBoard();
+    auto column = board ? board->FindColumn(columnId) : nullptr;
+    if (!column)
+    {
+        return 0;
+    }
+
+    std::vector<Kanban::CardChange> changes;
+    for (const auto& card : column->cards)
+    {
+        if (card->status != Kanban::CardStatus::Archived)
+        {
+            changes.emplace_back();
+            changes.back().cardId = card->id;
+            changes.back().status = Kanban::CardStatus::Archived;
+        }
+    }
+    return ApplyCardChanges(changes);
+}
+
+bool KanbanManager::Undo()
+{
+    return Replay(m_journal.TakeUndo(), false);
+}
+
+bool KanbanManager::Redo()
+{
+    return Replay(m_journal.TakeRedo(), true);
+}
+
+std::vector<Kanban::SearchHit> KanbanManager::SearchCards(const std::string& query, size_t limit)
+{
+    auto board = GetCurrentBoard();
+    if (!board)
+    {
+        return {};
+    }
+
+    // The index is maintained by the database, so queued writes have to land first
+    if (m_persistenceWorker)
+    {
+        m_persistenceWorker->Flush();
+    }
+
+    auto hits = m_database.SearchCards(query, board->id, limit);
+    for (auto& hit : hits)
+    {
+        if (auto card = board->FindCard(hit.card->id))
+        {
+            hit.card = card;
+        }
+    }
+    return hits;
+}
+
+void KanbanManager::SetArchiveAfterDays(int days)
+{
+    m_archiveAfterDays = std::max(0, days);
+}
+
+int64_t KanbanManager::GetArchiveCutoffMs() const
+{
+    return Utils::ToEpochMs(std::chrono::system_clock::now()) - int64_t(m_archiveAfterDays) * 24 * 60 * 60 * 1000;
+}
+
+size_t KanbanManager::ArchiveStaleCards()
+{
+    if (m_archiveAfterDays <= 0)
+    {
+        return 0;
+    }
+    if (m_persistenceWorker)
+    {
+        m_persistenceWorker->Flush();
+    }
+
+    // Batches that were committed before a failure stay archived
+    std::vector<std::string> archivedIds;
+    if (!m_database.ArchiveCards(GetArchiveCutoffMs(), archivedIds))
+    {
+        Logger::Error("Card archive stopped: {}", m_database.GetLastError());
+    }
+    if (archivedIds.empty())
+    {
+        return 0;
+    }
+
+    const std::unordered_set<std::string> archived(archivedIds.begin(), archivedIds.end());
+    for (const auto& project : m_projects)
+    {
+        for (const auto& board : project->boards)
+        {
+            if (!board->isLoaded)
+            {
+                continue; // Headers count again when the board loads
+            }
+
+            std::vector<std::string> removed;
+            for (const auto& column : board->columns)
+            {
+                for (const auto& card : column->cards)
+                {
+                    if (archived.count(card->id))
+                        removed.push_back(card->id);
+                }
+            }
+            for (const std::string& cardId : removed)
+            {
+                board->RemoveCard(cardId);
+            }
+            if (!removed.empty())
+            {
+                NotifyBoardChanged(board.get());
+            }
+        }
+    }
+    return archivedIds.size();
+}
+
+std::vector<Kanban::ArchivedCard> KanbanManager::GetArchivedCards(size_t offset, size_t limit)
+{
+    auto board = GetCurrentBoard();
+    if (!board)
+    {
+        return {};
+    }
+    if (m_persistenceWorker)
+    {
+        m_persistenceWorker->Flush(); // Restores and deletes still in the queue
+    }
+    return m_database.GetArchivedCards(board->id, offset, limit);
+}
+
+int KanbanManager::GetArchivedCardCount()
+{
+    auto board = GetCurrentBoard();
+    if (!board)
+    {
+        return 0;
+    }
+    if (m_persistenceWorker)
+    {
+        m_persistenceWorker->Flush();
+    }
+    return m_database.GetArchivedCardCount(board->id);
+}
+
+bool KanbanManager::RestoreArchivedCard(const Kanban::ArchivedCard& archived)
+{
+    auto board = GetCurrentBoard();
+    Kanban::Column* column = board ? board->FindColumn(archived.columnId) : nullptr;
+    if (!column || board->FindCard(archived.card.id))
+    {
+        Logger::Warning("Archived card '{}' is not from the current board", archived.card.title);
+        return false;
+    }
+
+    auto card = std::make_shared<Kanban::Card>(archived.card);
+    card->rank.clear(); // Appended
+    card->modifiedAt = std::chrono::system_clock::now();
+    if (!board->AddCard(column->id, card))
+    {
+        Logger::Warning("Column '{}' has no room for archived card '{}'", column->name, card->title);
+        return false;
+    }
+
+    Persist("restore card '" + card->title + "'",
+        [&database = m_database, snapshot = Kanban::Card(*card), columnId = column->id]() {
+            return database.RestoreArchivedCard(snapshot, columnId);
+        });
+    Logger::Info("Restored card: {}", card->title);
+    NotifyBoardChanged(board);
+    return true;
+}
+
+bool KanbanManager::DeleteArchivedCard(const std::string& cardId)
+{
+    Persist("delete archived card", [&database = m_database, cardId]() {
+        return database.DeleteArchivedCard(cardId);
+    });
+    return true;
+}
+
 void KanbanManager::StartDrag(std::shared_ptr<Kanban::Card> card, const std::string& sourceColumnId)
 {
     m_dragDropState.isDragging = true;
@@ -840,8 +1925,14 @@ void KanbanManager::EndDrag()
     if (m_dragDropState.isDragging && m_dragDropState.draggedCard && m_dragDropState.isValidDrop)
     {
         auto board = GetCurrentBoard();
-        if (board)
+        Kanban::Column* sourceColumn = board ? board->FindCardColumn(m_dragDropState.draggedCard->id) : nullptr;
+        if (board && sourceColumn)
         {
+            auto entry = MakeJournalEntry(Kanban::JournalEntry::Type::CardMoved, board->id,
+                                          m_dragDropState.draggedCard->id);
+            entry.columnBefore = sourceColumn->id;
+            entry.before = m_dragDropState.draggedCard->rank;
+
             bool success = board->MoveCard(
                 m_dragDropState.draggedCard->id,
                 m_dragDropState.targetColumnId,
@@ -855,10 +1946,35 @@ void KanbanManager::EndDrag()
                            m_dragDropState.targetColumnId);
                 NotifyCardUpdated(m_dragDropState.draggedCard);
 
+                // The moved card's new rank is the only row written, unless its neighbours
+                // left no room and the whole column is re-spread with it
+                std::vector<std::string> rebalancedIds;
+                if (Kanban::LexoRank::NeedsRebalance(m_dragDropState.draggedCard->rank))
+                {
+                    auto column = board->FindColumn(m_dragDropState.targetColumnId);
+                    column->RebalanceRanks();
+                    for (const auto& card : column->cards)
+                    {
+                        rebalancedIds.push_back(card->id);
+                    }
+                    Logger::Debug("Rebalancing ranks of column {}", column->id);
+                }
+
                 // Save to DB
-                m_database.MoveCard(m_dragDropState.draggedCard->id,
-                    m_dragDropState.targetColumnId, 
-                    m_dragDropState.targetIndex);
+                Persist("move card '" + m_dragDropState.draggedCard->title + "'",
+                    [&database = m_database,
+                     cardId = m_dragDropState.draggedCard->id,
+                     targetColumnId = m_dragDropState.targetColumnId,
+                     rank = m_dragDropState.draggedCard->rank,
+                     rebalancedIds = std::move(rebalancedIds)]() {
+                        if (!database.MoveCard(cardId, targetColumnId, rank))
+                            return false;
+                        return rebalancedIds.empty() || database.UpdateCardOrder(targetColumnId, rebalancedIds);
+                    });
+
+                entry.columnAfter = m_dragDropState.targetColumnId;
+                entry.after = m_dragDropState.draggedCard->rank;
+                RecordChange(std::move(entry));
             }
         }
     }
@@ -866,6 +1982,40 @@ void KanbanManager::EndDrag()
     CancelDrag();
 }
 
+void KanbanManager::MoveColumn(int fromIndex, int toIndex)
+{
+    auto board = GetCurrentBoard();
+    if (!board || fromIndex == toIndex ||
+        fromIndex < 0 || fromIndex >= static_cast<int>(board->columns.size()) ||
+        toIndex < 0 || toIndex >= static_cast<int>(board->columns.size()))
+    {
+        return;
+    }
+
+    board->MoveColumn(fromIndex, toIndex);
+
+    const Kanban::Column& column = *board->columns[toIndex];
+    std::vector<std::string> rebalancedIds;
+    if (Kanban::LexoRank::NeedsRebalance(column.rank))
+    {
+        board->RebalanceColumnRanks();
+        for (const auto& other : board->columns)
+        {
+            rebalancedIds.push_back(other->id);
+        }
+    }
+
+    Persist("move column '" + column.name + "'",
+        [&database = m_database, columnId = column.id, rank = column.rank, boardId = board->id,
+         rebalancedIds = std::move(rebalancedIds)]() {
+            if (!database.MoveColumn(columnId, rank))
+                return false;
+            return rebalancedIds.empty() || database.UpdateColumnOrder(boardId, rebalancedIds);
+        });
+
+    NotifyBoardChanged(board);
+}
+
 void KanbanManager::CancelDrag()
 {
     if (m_dragDropState.draggedCard)
@@ -878,23 +2028,82 @@ void KanbanManager::CancelDrag()
 
 bool KanbanManager::SaveProject(const std::string& projectId, const std::string& filePath)
 {
-    // TODO: Implement XML/JSON export
     Logger::Info("Saving project {} to {}", projectId, filePath);
-    return true;
+    return ExportToFile(projectId, std::string(), filePath);
 }
 
 bool KanbanManager::LoadProject(const std::string& filePath)
 {
-    // TODO: Implement XML/JSON import
     Logger::Info("Loading project from {}", filePath);
+
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        Logger::Error("Cannot open {}", filePath);
+        return false;
+    }
+
+    Kanban::Importer importer(m_database);
+    importer.SetProjectName(std::filesystem::path(filePath).stem().string());
+    if (!importer.Import(file, Kanban::GetTransferFormat(filePath)))
+    {
+        return false;
+    }
+
+    // The import went straight to the database; bring in the new project the way the
+    // others were loaded, as headers only in lazy mode
+    const std::string projectId = importer.GetProjectId();
+    std::unique_ptr<Kanban::Project> project;
+    if (m_lazyLoading)
+    {
+        for (auto& header : m_database.GetProjectHeaders())
+        {
+            if (header->id == projectId)
+            {
+                project = std::move(header);
+                break;
+            }
+        }
+    }
+    else if (auto loaded = m_database.GetProject(projectId))
+    {
+        project = std::move(*loaded);
+    }
+
+    if (!project)
+    {
+        Logger::Error("Imported project {} could not be read back", projectId);
+        return false;
+    }
+
+    m_projects.push_back(std::move(project));
+    SetCurrentProject(projectId);
     return true;
 }
 
 bool KanbanManager::ExportBoard(const std::string& boardId, const std::string& filePath)
 {
-    // TODO: Implement board export
     Logger::Info("Exporting board {} to {}", boardId, filePath);
-    return true;
+    return ExportToFile(std::string(), boardId, filePath);
+}
+
+bool KanbanManager::ExportToFile(const std::string& projectId, const std::string& boardId, const std::string& filePath)
+{
+    // Exports read the database, so queued writes have to land first
+    if (m_persistenceWorker)
+    {
+        m_persistenceWorker->Flush();
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        Logger::Error("Cannot write {}", filePath);
+        return false;
+    }
+
+    Kanban::Exporter exporter(m_database);
+    return exporter.Export(projectId, boardId, file, Kanban::GetTransferFormat(filePath));
 }
 
 void KanbanManager::SaveSettings()
@@ -904,6 +2113,7 @@ void KanbanManager::SaveSettings()
     
     m_config->SetValue("kanban.current_project", m_currentProjectId);
     m_config->SetValue("kanban.current_board", m_currentBoardId);
+    m_config->SetValue("kanban.archiveAfterDays", m_archiveAfterDays);
     
     // Save project count for loading
     m_config->SetValue("kanban.project_count", static_cast<int>(m_projects.size()));
@@ -921,6 +2131,12 @@ void KanbanManager::LoadSettings()
     
     m_currentProjectId = m_config->GetValue("kanban.current_project", "");
     m_currentBoardId = m_config->GetValue("kanban.current_board", "");
+
+    SetLazyLoading(m_config->GetValue("kanban.lazyLoading", true),
+                   static_cast<size_t>(std::max(1, m_config->GetValue("kanban.boardCacheMiB", 64))) << 20);
+    SetJournalPersistence(m_config->GetValue("kanban.persistJournal", true));
+    m_journal.SetCapacity(static_cast<size_t>(std::max(1, m_config->GetValue("kanban.journalKiB", 1024))) << 10);
+    SetArchiveAfterDays(m_config->GetValue("kanban.archiveAfterDays", 0)); // Off until turned on in the Archive tab
     
     // TODO: Load project data from config
     
@@ -933,13 +2149,17 @@ KanbanManager::Statistics KanbanManager::GetStatistics() const
     
     stats.totalProjects = static_cast<int>(m_projects.size());
     
+    // One set of counters per board, each kept current as cards change
     for (const auto& project : m_projects)
     {
         if (project)
         {
+            const Kanban::CardCounts counts = project->GetCardCounts();
             stats.totalBoards += project->GetTotalBoardCount();
-            stats.totalCards += project->GetTotalCardCount();
-            stats.completedCards += project->GetCompletedCardCount();
+            stats.totalCards += counts.total;
+            stats.completedCards += counts.byStatus[static_cast<int>(Kanban::CardStatus::Completed)];
+            stats.overdueCards += counts.overdue;
+            stats.urgentCards += counts.byPriority[static_cast<int>(Kanban::Priority::Urgent)];
         }
     }
     
@@ -972,16 +2192,259 @@ void KanbanManager::CreateDefaultProject()
 
 std::string KanbanManager::GenerateId() const
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> dis(10000, 99999);
-    
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    
-    std::stringstream ss;
-    ss << time_t << "_" << dis(gen);
-    return ss.str();
+    return IdGenerator::NextString();
+}
+
+bool KanbanManager::Persist(const std::string& description, std::function<bool()> write)
+{
+    // Commands only capture copies and the KanbanDatabase, which outlives the worker
+    if (m_persistenceWorker)
+    {
+        m_persistenceWorker->Enqueue(std::move(write), description);
+        return true;
+    }
+
+    if (!write())
+    {
+        Logger::Error("Failed to {} in database", description);
+        return false;
+    }
+    return true;
+}
+
+void KanbanManager::RecordChange(Kanban::JournalEntry entry)
+{
+    entry.sequence = static_cast<int64_t>(IdGenerator::Next());
+    entry.group = m_journalGroup ? m_journalGroup : entry.sequence;
+
+    const int64_t oldest = m_journal.GetOldestSequence();
+    if (m_persistJournal)
+    {
+        m_pendingJournal.push_back(entry);
+    }
+    m_journalDiscardedRedo = m_journal.Record(std::move(entry)) || m_journalDiscardedRedo;
+    if (m_journal.GetOldestSequence() != oldest)
+    {
+        m_journalTrimSequence = m_journal.GetOldestSequence();
+    }
+
+    if (m_journalGroup == 0)
+    {
+        FlushJournal();
+    }
+}
+
+void KanbanManager::BeginJournalGroup()
+{
+    m_journalGroup = static_cast<int64_t>(IdGenerator::Next());
+}
+
+void KanbanManager::EndJournalGroup()
+{
+    m_journalGroup = 0;
+    FlushJournal();
+}
+
+void KanbanManager::FlushJournal()
+{
+    if (m_persistJournal && (!m_pendingJournal.empty() || m_journalTrimSequence != 0))
+    {
+        // Queued behind the change it describes, so a crash never leaves an entry without it
+        Persist("record " + std::to_string(m_pendingJournal.size()) + " journal entries",
+            [&database = m_database, entries = std::move(m_pendingJournal), discardRedo = m_journalDiscardedRedo,
+             trimSequence = m_journalTrimSequence]() {
+                if (!database.AppendJournalEntries(entries, discardRedo))
+                    return false;
+                return trimSequence == 0 || database.TrimJournal(trimSequence);
+            });
+    }
+
+    m_pendingJournal.clear();
+    m_journalDiscardedRedo = false;
+    m_journalTrimSequence = 0;
+}
+
+bool KanbanManager::Replay(const std::vector<Kanban::JournalEntry>& entries, bool forward)
+{
+    if (entries.empty())
+    {
+        return false;
+    }
+
+    Kanban::Board* changedBoard = nullptr;
+    for (const auto& entry : entries)
+    {
+        if (Kanban::Board* board = ApplyJournalEntry(entry, forward))
+        {
+            changedBoard = board;
+        }
+    }
+
+    if (m_persistJournal)
+    {
+        Persist(forward ? "redo" : "undo",
+            [&database = m_database, group = entries.front().group, undone = !forward]() {
+                return database.SetJournalGroupUndone(group, undone);
+            });
+    }
+
+    if (!changedBoard)
+    {
+        return false;
+    }
+
+    // Show the board the change was made on
+    for (const auto& project : m_projects)
+    {
+        if (project && project->FindBoard(changedBoard->id))
+        {
+            m_currentProjectId = project->id;
+            m_currentBoardId = changedBoard->id;
+            break;
+        }
+    }
+
+    Logger::Info("{} {} card changes", forward ? "Redid" : "Undid", entries.size());
+    NotifyBoardChanged(changedBoard);
+    return true;
+}
+
+Kanban::Board* KanbanManager::ApplyJournalEntry(const Kanban::JournalEntry& entry, bool forward)
+{
+    using Type = Kanban::JournalEntry::Type;
+
+    Kanban::Board* board = FindBoardInProjects(entry.boardId);
+    if (!board)
+    {
+        Logger::Warning("Journal entry {} refers to missing board {}", entry.sequence, entry.boardId);
+        return nullptr;
+    }
+    EnsureBoardLoaded(*board);
+
+    // A create undone is a delete, a delete undone is a create
+    const bool create = (entry.type == Type::CardCreated) == forward;
+    if (entry.type == Type::CardCreated || entry.type == Type::CardDeleted)
+    {
+        if (!create)
+        {
+            if (!board->RemoveCard(entry.cardId))
+            {
+                Logger::Warning("Journal entry {} refers to missing card {}", entry.sequence, entry.cardId);
+                return nullptr;
+            }
+            Persist("remove card", [&database = m_database, cardId = entry.cardId]() {
+                return database.DeleteCard(cardId);
+            });
+            return board;
+        }
+
+        auto card = std::make_shared<Kanban::Card>();
+        const std::string& columnId = entry.type == Type::CardCreated ? entry.columnAfter : entry.columnBefore;
+        if (!Kanban::JournalEntry::DecodeCard(entry.type == Type::CardCreated ? entry.after : entry.before, *card) ||
+            board->FindCard(card->id) || !board->FindColumn(columnId))
+        {
+            Logger::Warning("Journal entry {} cannot restore card {}", entry.sequence, entry.cardId);
+            return nullptr;
+        }
+
+        const std::string rank = card->rank;
+        card->rank.clear();
+        if (!board->AddCard(columnId, card))
+        {
+            return nullptr;
+        }
+        const bool rebalanced = PlaceCard(*board, card->id, columnId, rank);
+
+        Persist("restore card '" + card->title + "'",
+            [&database = m_database, snapshot = Kanban::Card(*card), columnId,
+             rankedIds = rebalanced ? CardIds(*board->FindColumn(columnId)) : std::vector<std::string>()]() {
+                if (!database.CreateCard(snapshot, columnId))
+                    return false;
+                if (!snapshot.tags.empty() && !database.UpdateCardTags(snapshot.id, snapshot.tags))
+                    return false;
+                return rankedIds.empty() || database.UpdateCardOrder(columnId, rankedIds);
+            });
+        return board;
+    }
+
+    auto card = board->FindCard(entry.cardId);
+    if (!card)
+    {
+        Logger::Warning("Journal entry {} refers to missing card {}", entry.sequence, entry.cardId);
+        return nullptr;
+    }
+
+    if (entry.type == Type::CardMoved)
+    {
+        const std::string& columnId = forward ? entry.columnAfter : entry.columnBefore;
+        if (!board->FindColumn(columnId))
+        {
+            Logger::Warning("Journal entry {} refers to missing column {}", entry.sequence, columnId);
+            return nullptr;
+        }
+
+        const bool rebalanced = PlaceCard(*board, card->id, columnId, forward ? entry.after : entry.before);
+        Persist("move card '" + card->title + "'",
+            [&database = m_database, cardId = card->id, columnId, rank = card->rank,
+             rankedIds = rebalanced ? CardIds(*board->FindColumn(columnId)) : std::vector<std::string>()]() {
+                if (!database.MoveCard(cardId, columnId, rank))
+                    return false;
+                return rankedIds.empty() || database.UpdateCardOrder(columnId, rankedIds);
+            });
+        return board;
+    }
+
+    if (!Kanban::JournalEntry::SetField(*card, entry.field, forward ? entry.after : entry.before))
+    {
+        Logger::Warning("Journal entry {} has an unreadable value", entry.sequence);
+        return nullptr;
+    }
+    card->modifiedAt = std::chrono::system_clock::now();
+    board->RefreshCardCounts(card->id);
+
+    Persist("update card '" + card->title + "'",
+        [&database = m_database, snapshot = Kanban::Card(*card), tags = entry.field == Kanban::JournalEntry::Field::Tags]() {
+            return tags ? database.UpdateCardTags(snapshot.id, snapshot.tags) : database.UpdateCard(snapshot);
+        });
+    return board;
+}
+
+bool KanbanManager::PlaceCard(Kanban::Board& board, const std::string& cardId, const std::string& columnId,
+                              const std::string& rank)
+{
+    // The recorded rank finds the position; the other cards may have moved since, so it
+    // is only reused while it still sorts between the new neighbours
+    Kanban::Column* column = board.FindColumn(columnId);
+    int index = 0;
+    for (const auto& other : column->cards)
+    {
+        if (other->id != cardId && other->rank < rank)
+        {
+            ++index;
+        }
+    }
+
+    if (!board.MoveCard(cardId, columnId, index))
+    {
+        return false;
+    }
+
+    auto& cards = column->cards;
+    std::shared_ptr<Kanban::Card> card = cards[index];
+    const bool fits = !rank.empty() && (index == 0 || cards[index - 1]->rank < rank) &&
+                      (index + 1 == static_cast<int>(cards.size()) || rank < cards[index + 1]->rank);
+    if (fits)
+    {
+        card->rank = rank;
+    }
+
+    if (Kanban::LexoRank::NeedsRebalance(card->rank))
+    {
+        column->RebalanceRanks();
+        Logger::Debug("Rebalancing ranks of column {}", column->id);
+        return true;
+    }
+    return false;
 }
 
 void KanbanManager::NotifyCardUpdated(std::shared_ptr<Kanban::Card> card)
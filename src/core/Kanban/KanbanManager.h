@@ -6,10 +6,16 @@
 #include <functional>
 #include <chrono>
 #include <unordered_map>
+#include <list>
+#include <queue>
+#include <optional>
+#include "core/Kanban/CardFilter.h"
+#include "core/Kanban/KanbanJournal.h"
 
 // Forward declarations
 class AppConfig;
 class KanbanDatabase;
+class PersistenceWorker;
 
 namespace Kanban
 {
@@ -37,6 +43,19 @@ namespace Kanban
             : r(red), g(green), b(blue), a(alpha) {}
     };
 
+    // Card counters of a column, board or project
+    struct CardCounts
+    {
+        int total = 0;
+        int byStatus[3] = {};   // Indexed by CardStatus
+        int byPriority[4] = {}; // Indexed by Priority
+        int overdue = 0;
+
+        void Add(CardStatus status, Priority priority, bool isOverdue, int sign = 1);
+        CardCounts& operator+=(const CardCounts& other);
+        bool operator==(const CardCounts& other) const;
+    };
+
     struct Card
     {
         std::string id;
@@ -50,6 +69,7 @@ namespace Kanban
         std::vector<std::string> tags;
         std::chrono::system_clock::time_point createdAt;
         std::chrono::system_clock::time_point modifiedAt;
+        std::string rank; // Position in the column, see LexoRank
         
         // For drag and drop state
         bool isDragging = false;
@@ -64,8 +84,10 @@ namespace Kanban
         // Get formatted due date
         std::string GetFormattedDueDate() const;
         
-        // Check if overdue
+        // Active with a due date before today (local calendar, day numbers as in Utils)
         bool IsOverdue() const;
+        bool IsOverdue(int64_t today) const;
+        bool GetDueDay(int64_t& dueDay) const; // False when dueDate is not a date
         
         // Generate unique ID
         static std::string GenerateId();
@@ -79,6 +101,7 @@ namespace Kanban
         std::vector<std::shared_ptr<Card>> cards;
         int cardLimit = -1; // -1 means no limit
         bool isCollapsed = false;
+        std::string rank; // Position on the board, see LexoRank
 
         Column();
         Column(const std::string& columnName);
@@ -87,7 +110,10 @@ namespace Kanban
             name(other.name),
             headerColor(other.headerColor),
             cardLimit(other.cardLimit),
-            isCollapsed(other.isCollapsed)
+            isCollapsed(other.isCollapsed),
+            rank(other.rank),
+            counts(other.counts),
+            countsValid(other.countsValid)
         {
             // std::shared_ptr<Card> is copyable → shallow copy (shared ownership)
             cards = other.cards;
@@ -100,11 +126,19 @@ namespace Kanban
         std::shared_ptr<Card> FindCard(const std::string& cardId);
         int FindCardIndex(const std::string& cardId);
         const std::vector<std::shared_ptr<Card>>& GetCards() const { return cards; }
+        void RebalanceRanks(); // Evenly spaced ranks for the current card order
         
-        // Get card count by status/priority
+        // Get card count by status/priority - counted on first use. While the owning Board's
+        // card index is built the Board keeps them current, overdue included (advanced by
+        // the board's own statistics reads); AddCard and RemoveCard alone force a recount.
+        const CardCounts& GetCardCounts() const;
         int GetActiveCardCount() const;
         int GetCompletedCardCount() const;
         int GetUrgentCardCount() const;
+        int GetOverdueCardCount() const;
+
+        mutable CardCounts counts;
+        mutable bool countsValid = false; // Cleared by code that fills cards directly
     };
 
     struct Board
@@ -117,6 +151,12 @@ namespace Kanban
         std::chrono::system_clock::time_point modifiedAt;
         bool isActive = true;
 
+        // Lazy loading: a board header has no columns yet and reports stored card counts
+        bool isLoaded = true;
+        int storedCardCount = 0;
+        int storedCompletedCount = 0;
+        int storedOverdueCount = 0;
+
         Board();
         Board(const std::string& boardName);
         Board(const Board& other)
@@ -125,7 +165,12 @@ namespace Kanban
             description(other.description),
             createdAt(other.createdAt),
             modifiedAt(other.modifiedAt),
-            isActive(other.isActive)
+            isActive(other.isActive),
+            isLoaded(other.isLoaded),
+            storedCardCount(other.storedCardCount),
+            storedCompletedCount(other.storedCompletedCount),
+            storedOverdueCount(other.storedOverdueCount),
+            filter(other.filter)
         {
             columns.reserve(other.columns.size());
             for (const auto& col : other.columns)
@@ -144,18 +189,80 @@ namespace Kanban
         Column* FindColumn(const std::string& columnId);
         int FindColumnIndex(const std::string& columnId);
         const std::vector<std::unique_ptr<Column>>& GetColumns() const { return columns; }
+        void RebalanceColumnRanks();
         
-        // Card operations
+        // Card operations - lookups go through an index from card id to column and position,
+        // built on first use and kept current by the calls below. Code that fills
+        // columns[]->cards directly (hydration) calls InvalidateCardIndex() afterwards.
+        // The card counters and filter bitsets are built and maintained with the index; after
+        // changing a card's status, priority, due date, assignee or tags call RefreshCardCounts().
         std::shared_ptr<Card> FindCard(const std::string& cardId);
+        Column* FindCardColumn(const std::string& cardId);
+        int FindCardIndex(const std::string& cardId); // Position within its column, -1 if absent
+        bool AddCard(const std::string& columnId, std::shared_ptr<Card> card);
+        bool RemoveCard(const std::string& cardId);
         bool MoveCard(const std::string& cardId, const std::string& targetColumnId, int targetIndex = -1);
+        bool RefreshCardCounts(const std::string& cardId);
+        void InvalidateCardIndex();
+        bool ValidateCardIndex() const; // Compares the index and counters with a full scan; run after every change in debug builds
         
-        // Statistics
+        // Statistics - O(1) reads. Cards turn overdue when the day passes their due date,
+        // found through a min-heap of due days instead of a scan.
+        CardCounts GetCardCounts() const; // Totals only for a board that is not loaded
         int GetTotalCardCount() const;
         int GetCompletedCardCount() const;
         int GetOverdueCardCount() const;
         
+        // Filter - the matching cards come from bitsets kept with the card index (see
+        // CardFilterIndex) and are cached per column until a card or the filter changes, so
+        // reading them every frame costs nothing.
+        void SetFilter(const CardFilter& cardFilter);
+        const CardFilter& GetFilter() const { return filter; }
+        bool HasFilter() const { return !filter.IsEmpty(); }
+        const std::vector<size_t>& GetVisibleCards(const Column& column) const; // Positions in column.cards, ascending
+        size_t GetVisibleCardCount() const;
+        
         // Default board setup
         void CreateDefaultColumns();
+
+    private:
+        struct CardLocation
+        {
+            Column* column = nullptr;
+            Card* card = nullptr;
+            size_t position = 0; // Hint - checked against column->cards and refreshed on a miss
+
+            // What the card was counted as, so a change can be taken back out of the counters
+            Priority priority = Priority::Medium;
+            CardStatus status = CardStatus::Active;
+            int64_t dueDay = 0;
+            bool hasDueDay = false;
+            bool overdue = false;
+            uint32_t slot = 0; // In filterIndex
+        };
+
+        using DueEntry = std::pair<int64_t, std::string>; // Due day, card id
+        using DueHeap = std::priority_queue<DueEntry, std::vector<DueEntry>, std::greater<DueEntry>>;
+
+        CardLocation* LocateCard(const std::string& cardId);
+        void BuildCardIndex() const;
+        void CountCard(CardLocation& location, int64_t today, int sign) const;
+        void UpdateOverdue() const; // Pops due days that have passed since the last call
+        void BuildVisibleCards() const;
+
+        // Not copied with the board: it points into this board's columns. Mutable as a
+        // cache behind the const statistics.
+        mutable std::unordered_map<std::string, CardLocation> cardIndex;
+        mutable bool cardIndexValid = false;
+        mutable CardCounts cardCounts;
+        mutable DueHeap dueHeap; // Cards not yet overdue; entries of changed or removed cards go stale
+        mutable int64_t countedDay = 0; // Day the overdue flags were last evaluated for
+        mutable CardFilterIndex filterIndex;
+        mutable std::vector<CardLocation*> slotLocations; // By filter slot
+        CardFilter filter;
+        mutable std::unordered_map<const Column*, std::vector<size_t>> visibleCards; // Columns with a match
+        mutable size_t visibleCount = 0;
+        mutable bool visibleValid = false;
     };
 
     struct Project
@@ -198,10 +305,12 @@ namespace Kanban
         // Get active board (first active board)
         Board* GetActiveBoard();
         
-        // Statistics
+        // Statistics - sums of the board counters
         int GetTotalBoardCount() const;
+        CardCounts GetCardCounts() const;
         int GetTotalCardCount() const;
         int GetCompletedCardCount() const;
+        int GetOverdueCardCount() const;
     };
 
     // Drag and drop state
@@ -215,6 +324,36 @@ namespace Kanban
         int targetIndex = -1;
         bool isValidDrop = false;
     };
+
+    // One card found by full-text search (KanbanDatabase::SearchCards)
+    struct SearchHit
+    {
+        std::shared_ptr<Card> card;
+        std::string columnId;
+        std::string snippet; // Best fragment, matches wrapped in KanbanDatabase::SEARCH_MATCH_BEGIN/END
+        double score = 0.0;  // BM25 - higher is better
+    };
+
+    // One card in cold storage (KanbanDatabase::ArchiveCards)
+    struct ArchivedCard
+    {
+        Card card;
+        std::string columnId;
+        std::chrono::system_clock::time_point archivedAt;
+    };
+
+    // One card of a bulk operation (KanbanManager::ApplyCardChanges). Fields left unset
+    // keep the card's value.
+    struct CardChange
+    {
+        std::string cardId;
+        std::optional<Priority> priority;
+        std::optional<CardStatus> status;
+        std::optional<std::string> assignee;
+        std::optional<std::string> dueDate;
+        std::optional<std::vector<std::string>> tags;
+        std::string targetColumnId; // Appends the card to this column; empty keeps it in place
+    };
 }
 
 class KanbanManager
@@ -250,17 +389,73 @@ public:
     // Card operations
     void CreateCard(const std::string& columnId, const std::string& title);
     void DeleteCard(const std::string& cardId);
-    void UpdateCard(std::shared_ptr<Kanban::Card> card);
+    void UpdateCard(std::shared_ptr<Kanban::Card> card); // Saves a card changed in place; not undoable
+    bool EditCard(const Kanban::Card& edited);            // Applies the fields that differ, with undo
     std::shared_ptr<Kanban::Card> FindCard(const std::string& cardId);
 
+    // Bulk card operations on the current board. All changes are applied in memory, then
+    // written in one transaction and announced with one board-changed notification instead
+    // of one card update each. Cards that are not on the board are skipped; returns how
+    // many were changed.
+    size_t ApplyCardChanges(const std::vector<Kanban::CardChange>& changes);
+    size_t MoveCards(const std::vector<std::string>& cardIds, const std::string& targetColumnId);
+    size_t SetCardsPriority(const std::vector<std::string>& cardIds, Kanban::Priority priority);
+    size_t SetCardsTags(const std::vector<std::string>& cardIds, const std::vector<std::string>& tags);
+    size_t ArchiveColumn(const std::string& columnId);
+
+    // Undo/redo of card changes - creates, deletes, moves, EditCard and bulk operations,
+    // one user action at a time. The journal keeps deltas, capped by "kanban.journalKiB";
+    // with "kanban.persistJournal" they are also written to kanban_journal after the
+    // changes they describe, and read back by loadProjectsFromDB.
+    bool Undo();
+    bool Redo();
+    bool CanUndo() const { return m_journal.CanUndo(); }
+    bool CanRedo() const { return m_journal.CanRedo(); }
+    void SetJournalPersistence(bool enabled) { m_persistJournal = enabled; }
+    const Kanban::Journal& GetJournal() const { return m_journal; }
+
+    // Full-text search on the current board; hits on a loaded board point at its cards
+    std::vector<Kanban::SearchHit> SearchCards(const std::string& query, size_t limit = 50);
+
+    // Cold storage - off by default. Once "kanban.archiveAfterDays" is set (0 keeps every
+    // card), completed and archived cards left unchanged that long move to the archive when
+    // loadProjectsFromDB runs, before anything is hydrated, or when ArchiveStaleCards is
+    // called, which also drops them from the loaded boards. The archive of the current board is read a page at a time; a restored card
+    // goes to the end of its column and starts its archive age over.
+    size_t ArchiveStaleCards();
+    void SetArchiveAfterDays(int days);
+    int GetArchiveAfterDays() const { return m_archiveAfterDays; }
+    std::vector<Kanban::ArchivedCard> GetArchivedCards(size_t offset, size_t limit);
+    int GetArchivedCardCount();
+    bool RestoreArchivedCard(const Kanban::ArchivedCard& archived);
+    bool DeleteArchivedCard(const std::string& cardId);
+
     // Drag and drop
     void StartDrag(std::shared_ptr<Kanban::Card> card, const std::string& sourceColumnId);
     void UpdateDrag(const std::string& targetColumnId, int targetIndex);
-    void EndDrag();
+    void EndDrag();     // Persists the move as one UPDATE of the card's rank
     void CancelDrag();
+
+    // Column order on the current board
+    void MoveColumn(int fromIndex, int toIndex);
     const Kanban::DragDropState& GetDragDropState() const { return m_dragDropState; }
 
-    // File operations
+    // Persistence - with a worker attached, database writes are queued instead of running
+    // on the calling (UI) thread. The in-memory model stays the source of truth.
+    void SetPersistenceWorker(PersistenceWorker* worker) { m_persistenceWorker = worker; }
+
+    // Lazy loading - loadProjectsFromDB only reads project and board headers, and a board's
+    // columns and cards are fetched when it becomes the current board. Loaded boards stay in
+    // an LRU until their estimated size exceeds the cap; the current board is never dropped.
+    // Read from "kanban.lazyLoading" and "kanban.boardCacheMiB" by LoadSettings().
+    void SetLazyLoading(bool enabled, size_t boardCacheBytes = 64u << 20);
+    bool IsLazyLoading() const { return m_lazyLoading; }
+    size_t GetLoadedBoardCount() const { return m_loadedBoards.size(); }
+    size_t GetLoadedBoardBytes() const { return m_loadedBoardBytes; }
+
+    // File operations - JSON, or CSV for a .csv path (see KanbanTransfer.h). Files are
+    // written from database cursors and read back in batches, so neither side holds the
+    // whole project; LoadProject adds the file as a new project and selects it.
     bool SaveProject(const std::string& projectId, const std::string& filePath);
     bool LoadProject(const std::string& filePath);
     bool ExportBoard(const std::string& boardId, const std::string& filePath);
@@ -277,6 +472,7 @@ public:
         int totalCards = 0;
         int completedCards = 0;
         int overdueCards = 0;
+        int urgentCards = 0;
         float completionRate = 0.0f;
     };
     Statistics GetStatistics() const;
@@ -298,6 +494,30 @@ private:
     // Configuration
     AppConfig* m_config = nullptr;
     KanbanDatabase& m_database;
+    PersistenceWorker* m_persistenceWorker = nullptr;
+
+    // Boards with loaded contents, most recently used first
+    struct LoadedBoard
+    {
+        std::string boardId;
+        size_t bytes = 0;
+    };
+    bool m_lazyLoading = false;
+    size_t m_boardCacheBytes = 64u << 20;
+    std::list<LoadedBoard> m_loadedBoards;
+    std::unordered_map<std::string, std::list<LoadedBoard>::iterator> m_loadedBoardIndex;
+    size_t m_loadedBoardBytes = 0;
+
+    int m_archiveAfterDays = 0;
+    int64_t GetArchiveCutoffMs() const;
+
+    // Undo journal; entries recorded since the last write wait in m_pendingJournal
+    Kanban::Journal m_journal;
+    bool m_persistJournal = false;
+    int64_t m_journalGroup = 0; // Set while one action records several entries
+    std::vector<Kanban::JournalEntry> m_pendingJournal;
+    bool m_journalDiscardedRedo = false;
+    int64_t m_journalTrimSequence = 0;
     
     // Callbacks
     std::function<void(std::shared_ptr<Kanban::Card>)> m_onCardUpdated;
@@ -310,7 +530,27 @@ private:
     void NotifyBoardChanged(Kanban::Board* board);
     void NotifyProjectChanged(Kanban::Project* project);
     
+    // Lazy loading helpers
+    void EnsureBoardLoaded(Kanban::Board& board);
+    void EvictBoards();
+    void ForgetBoard(const std::string& boardId);
+    void ClearLoadedBoards();
+    Kanban::Board* FindBoardInProjects(const std::string& boardId);
+    static size_t EstimateBoardBytes(const Kanban::Board& board);
+
+    // Journal helpers
+    void RecordChange(Kanban::JournalEntry entry);
+    void BeginJournalGroup();
+    void EndJournalGroup();
+    void FlushJournal();
+    bool Replay(const std::vector<Kanban::JournalEntry>& entries, bool forward);
+    Kanban::Board* ApplyJournalEntry(const Kanban::JournalEntry& entry, bool forward);
+    bool PlaceCard(Kanban::Board& board, const std::string& cardId, const std::string& columnId,
+                   const std::string& rank);
+
     // Persistence helpers
+    bool ExportToFile(const std::string& projectId, const std::string& boardId, const std::string& filePath);
+    bool Persist(const std::string& description, std::function<bool()> write);
     void LoadDefaultConfiguration();
     void SaveProjectToConfig(const Kanban::Project& project);
     void LoadProjectFromConfig(const std::string& projectId);
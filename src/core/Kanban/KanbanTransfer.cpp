@@ -0,0 +1,1231 @@
+#include "core/Kanban/KanbanTransfer.h"
+#include "core/Kanban/KanbanManager.h"
+#include "core/Kanban/LexoRank.h"
+#include "core/Database/KanbanDatabase.h"
+#include "core/Logger.h"
+#include "core/Utils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace Kanban
+{
+    namespace
+    {
+        constexpr const char* FORMAT_NAME = "potensio-kanban";
+        constexpr int FORMAT_VERSION = 1;
+        constexpr size_t BUFFER_BYTES = 64 * 1024;
+
+        const char* const PRIORITY_NAMES[] = { "Low", "Medium", "High", "Urgent" };
+        const char* const STATUS_NAMES[] = { "Active", "Completed", "Archived" };
+
+        // CSV columns, in the order they are written
+        const char* const CSV_HEADER[] = { "board", "column", "title", "description", "priority", "status",
+                                           "color", "assignee", "due_date", "tags", "created_ms", "modified_ms" };
+        constexpr size_t CSV_COLUMNS = sizeof(CSV_HEADER) / sizeof(CSV_HEADER[0]);
+        constexpr char TAG_SEPARATOR = ';';
+        constexpr char TAG_ESCAPE = '\\'; // Before a separator or escape inside a tag name
+
+        double SecondsSince(std::chrono::steady_clock::time_point start)
+        {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        std::string FormatColor(const Color& color)
+        {
+            auto channel = [](float value) {
+                return static_cast<unsigned>(std::lround(std::min(1.0f, std::max(0.0f, value)) * 255.0f));
+            };
+            char buffer[16];
+            std::snprintf(buffer, sizeof(buffer), "#%02x%02x%02x%02x", channel(color.r), channel(color.g),
+                          channel(color.b), channel(color.a));
+            return buffer;
+        }
+
+        bool ParseColor(const std::string& text, Color& color)
+        {
+            if ((text.size() != 7 && text.size() != 9) || text[0] != '#')
+                return false;
+
+            char* end = nullptr;
+            const unsigned long value = std::strtoul(text.c_str() + 1, &end, 16);
+            if (*end != '\0')
+                return false;
+
+            const unsigned long rgba = text.size() == 7 ? (value << 8) | 0xff : value;
+            color.r = ((rgba >> 24) & 0xff) / 255.0f;
+            color.g = ((rgba >> 16) & 0xff) / 255.0f;
+            color.b = ((rgba >> 8) & 0xff) / 255.0f;
+            color.a = (rgba & 0xff) / 255.0f;
+            return true;
+        }
+
+        // Names as written, or the numeric value
+        template<typename Enum, size_t Count>
+        bool ParseEnum(const std::string& text, const char* const (&names)[Count], Enum& value)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                if (text == names[i])
+                {
+                    value = static_cast<Enum>(i);
+                    return true;
+                }
+            }
+            char* end = nullptr;
+            const long number = std::strtol(text.c_str(), &end, 10);
+            if (text.empty() || *end != '\0' || number < 0 || number >= static_cast<long>(Count))
+                return false;
+            value = static_cast<Enum>(number);
+            return true;
+        }
+
+        bool ParseInt(const std::string& text, int64_t& value)
+        {
+            char* end = nullptr;
+            value = std::strtoll(text.c_str(), &end, 10);
+            return !text.empty() && *end == '\0';
+        }
+
+        // Buffered writer over the output stream; counts what it writes
+        class Sink
+        {
+        public:
+            explicit Sink(std::ostream& out) : m_out(out) { m_buffer.reserve(BUFFER_BYTES + 4096); }
+
+            Sink& operator<<(const std::string& text) { m_buffer += text; return Spill(); }
+            Sink& operator<<(const char* text) { m_buffer += text; return Spill(); }
+            Sink& operator<<(char c) { m_buffer += c; return Spill(); }
+            Sink& operator<<(int64_t value) { m_buffer += std::to_string(value); return Spill(); }
+
+            void JsonString(const std::string& text)
+            {
+                m_buffer += '"';
+                for (char c : text)
+                {
+                    switch (c)
+                    {
+                        case '"':  m_buffer += "\\\""; break;
+                        case '\\': m_buffer += "\\\\"; break;
+                        case '\n': m_buffer += "\\n"; break;
+                        case '\r': m_buffer += "\\r"; break;
+                        case '\t': m_buffer += "\\t"; break;
+                        default:
+                            if (static_cast<unsigned char>(c) < 0x20)
+                            {
+                                char escaped[8];
+                                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+                                m_buffer += escaped;
+                            }
+                            else
+                            {
+                                m_buffer += c;
+                            }
+                    }
+                }
+                m_buffer += '"';
+                Spill();
+            }
+
+            void CsvField(const std::string& text)
+            {
+                if (text.find_first_of(",\"\r\n") == std::string::npos)
+                {
+                    m_buffer += text;
+                }
+                else
+                {
+                    m_buffer += '"';
+                    for (char c : text)
+                    {
+                        if (c == '"') m_buffer += '"';
+                        m_buffer += c;
+                    }
+                    m_buffer += '"';
+                }
+                Spill();
+            }
+
+            bool Flush()
+            {
+                m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+                m_bytes += m_buffer.size();
+                m_buffer.clear();
+                m_out.flush();
+                return static_cast<bool>(m_out);
+            }
+
+            bool IsGood() const { return static_cast<bool>(m_out); }
+            uint64_t GetBytes() const { return m_bytes + m_buffer.size(); }
+
+        private:
+            Sink& Spill()
+            {
+                if (m_buffer.size() >= BUFFER_BYTES)
+                {
+                    m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+                    m_bytes += m_buffer.size();
+                    m_buffer.clear();
+                }
+                return *this;
+            }
+
+            std::ostream& m_out;
+            std::string m_buffer;
+            uint64_t m_bytes = 0;
+        };
+
+        // Buffered reader over the input stream
+        class Source
+        {
+        public:
+            explicit Source(std::istream& in) : m_in(in), m_buffer(BUFFER_BYTES) {}
+
+            int Peek()
+            {
+                if (m_pos == m_length && !Fill()) return EOF;
+                return static_cast<unsigned char>(m_buffer[m_pos]);
+            }
+
+            int Get()
+            {
+                const int c = Peek();
+                if (c != EOF)
+                {
+                    ++m_pos;
+                    if (c == '\n') ++m_line;
+                }
+                return c;
+            }
+
+            size_t GetLine() const { return m_line; }
+            uint64_t GetBytes() const { return m_bytes; }
+
+        private:
+            bool Fill()
+            {
+                m_in.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+                m_length = static_cast<size_t>(m_in.gcount());
+                m_bytes += m_length;
+                m_pos = 0;
+                return m_length > 0;
+            }
+
+            std::istream& m_in;
+            std::vector<char> m_buffer;
+            size_t m_pos = 0;
+            size_t m_length = 0;
+            size_t m_line = 1;
+            uint64_t m_bytes = 0;
+        };
+
+        // Pull parser: hands out one token at a time and keeps only the nesting stack
+        class JsonReader
+        {
+        public:
+            enum class Token
+            {
+                ObjectBegin,
+                ObjectEnd,
+                ArrayBegin,
+                ArrayEnd,
+                Key,
+                String,
+                Number,
+                True,
+                False,
+                Null,
+                End,
+                Error
+            };
+
+            explicit JsonReader(std::istream& in) : m_source(in) {}
+
+            Token Next()
+            {
+                SkipSpace();
+                int c = m_source.Peek();
+
+                if (m_afterValue)
+                {
+                    if (c == ',' && !m_stack.empty())
+                    {
+                        m_source.Get();
+                        m_afterValue = false;
+                        m_afterComma = true;
+                        SkipSpace();
+                        c = m_source.Peek();
+                    }
+                    else if (m_stack.empty())
+                    {
+                        return c == EOF ? Token::End : Fail("trailing data");
+                    }
+                    else if (c != (m_stack.back() == '{' ? '}' : ']'))
+                    {
+                        return Fail("expected ',' or a closing bracket");
+                    }
+                }
+                else if (m_started && m_stack.empty())
+                {
+                    return Fail("unexpected end of input");
+                }
+
+                const bool inObject = !m_stack.empty() && m_stack.back() == '{';
+                const bool wantKey = inObject && !m_afterKey;
+                const bool afterComma = m_afterComma;
+                m_afterComma = false;
+                m_started = true;
+
+                switch (c)
+                {
+                    case '{':
+                    case '[':
+                        if (wantKey) return Fail("expected a key");
+                        m_source.Get();
+                        m_stack.push_back(static_cast<char>(c));
+                        m_afterKey = false;
+                        m_afterValue = false;
+                        return c == '{' ? Token::ObjectBegin : Token::ArrayBegin;
+
+                    case '}':
+                    case ']':
+                        if (m_stack.empty() || m_stack.back() != (c == '}' ? '{' : '[') || afterComma || m_afterKey)
+                            return Fail("unexpected closing bracket");
+                        m_source.Get();
+                        m_stack.pop_back();
+                        m_afterValue = true;
+                        return c == '}' ? Token::ObjectEnd : Token::ArrayEnd;
+
+                    case '"':
+                        if (!ReadString()) return Fail("bad string");
+                        if (wantKey)
+                        {
+                            SkipSpace();
+                            if (m_source.Get() != ':') return Fail("expected ':'");
+                            m_afterKey = true;
+                            return Token::Key;
+                        }
+                        return Value(Token::String);
+
+                    case EOF:
+                        return Fail("unexpected end of input");
+
+                    default:
+                        break;
+                }
+
+                if (wantKey) return Fail("expected a key");
+                if (c == '-' || (c >= '0' && c <= '9'))
+                {
+                    m_text.clear();
+                    while ((c = m_source.Peek()) != EOF && (std::strchr("+-.eE", c) || (c >= '0' && c <= '9')))
+                    {
+                        m_text += static_cast<char>(m_source.Get());
+                    }
+                    return Value(Token::Number);
+                }
+                if (ReadLiteral("true")) return Value(Token::True);
+                if (ReadLiteral("false")) return Value(Token::False);
+                if (ReadLiteral("null")) return Value(Token::Null);
+                return Fail("unexpected character");
+            }
+
+            // Skips the value whose first token was just read
+            bool Skip(Token token)
+            {
+                int depth = 0;
+                for (;;)
+                {
+                    if (token == Token::ObjectBegin || token == Token::ArrayBegin) ++depth;
+                    if (token == Token::ObjectEnd || token == Token::ArrayEnd) --depth;
+                    if (token == Token::Error || token == Token::End) return false;
+                    if (depth == 0) return true;
+                    token = Next();
+                }
+            }
+
+            const std::string& GetText() const { return m_text; }
+            const std::string& GetError() const { return m_error; }
+            uint64_t GetBytes() const { return m_source.GetBytes(); }
+
+        private:
+            Token Value(Token token)
+            {
+                m_afterKey = false;
+                m_afterValue = true;
+                return token;
+            }
+
+            Token Fail(const char* what)
+            {
+                if (m_error.empty())
+                {
+                    m_error = std::string(what) + " on line " + std::to_string(m_source.GetLine());
+                }
+                return Token::Error;
+            }
+
+            void SkipSpace()
+            {
+                int c;
+                while ((c = m_source.Peek()) == ' ' || c == '\n' || c == '\r' || c == '\t')
+                {
+                    m_source.Get();
+                }
+            }
+
+            bool ReadLiteral(const char* literal)
+            {
+                if (m_source.Peek() != literal[0]) return false;
+                for (const char* p = literal; *p; ++p)
+                {
+                    if (m_source.Get() != *p) return false;
+                }
+                return true;
+            }
+
+            bool ReadHex(unsigned& value)
+            {
+                value = 0;
+                for (int i = 0; i < 4; ++i)
+                {
+                    const int c = m_source.Get();
+                    const char* digits = "0123456789abcdef";
+                    const char* found = c == EOF ? nullptr : std::strchr(digits, std::tolower(c));
+                    if (!found || !*found) return false;
+                    value = value * 16 + static_cast<unsigned>(found - digits);
+                }
+                return true;
+            }
+
+            void AppendUtf8(unsigned code)
+            {
+                if (code < 0x80)
+                {
+                    m_text += static_cast<char>(code);
+                }
+                else if (code < 0x800)
+                {
+                    m_text += static_cast<char>(0xc0 | (code >> 6));
+                    m_text += static_cast<char>(0x80 | (code & 0x3f));
+                }
+                else if (code < 0x10000)
+                {
+                    m_text += static_cast<char>(0xe0 | (code >> 12));
+                    m_text += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                    m_text += static_cast<char>(0x80 | (code & 0x3f));
+                }
+                else
+                {
+                    m_text += static_cast<char>(0xf0 | (code >> 18));
+                    m_text += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+                    m_text += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                    m_text += static_cast<char>(0x80 | (code & 0x3f));
+                }
+            }
+
+            bool ReadString()
+            {
+                m_source.Get(); // Opening quote
+                m_text.clear();
+                for (;;)
+                {
+                    int c = m_source.Get();
+                    if (c == EOF) return false;
+                    if (c == '"') return true;
+                    if (c != '\\')
+                    {
+                        m_text += static_cast<char>(c);
+                        continue;
+                    }
+
+                    unsigned code = 0;
+                    switch (c = m_source.Get())
+                    {
+                        case '"':  m_text += '"'; break;
+                        case '\\': m_text += '\\'; break;
+                        case '/':  m_text += '/'; break;
+                        case 'b':  m_text += '\b'; break;
+                        case 'f':  m_text += '\f'; break;
+                        case 'n':  m_text += '\n'; break;
+                        case 'r':  m_text += '\r'; break;
+                        case 't':  m_text += '\t'; break;
+                        case 'u':
+                            if (!ReadHex(code)) return false;
+                            if (code >= 0xd800 && code < 0xdc00)
+                            {
+                                unsigned low = 0;
+                                if (m_source.Get() != '\\' || m_source.Get() != 'u' || !ReadHex(low) ||
+                                    low < 0xdc00 || low >= 0xe000)
+                                    return false;
+                                code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                            }
+                            AppendUtf8(code);
+                            break;
+                        default:
+                            return false;
+                    }
+                }
+            }
+
+            Source m_source;
+            std::vector<char> m_stack;
+            std::string m_text;
+            std::string m_error;
+            bool m_started = false;
+            bool m_afterKey = false;   // Inside an object, between a key and its value
+            bool m_afterValue = false; // A complete value was just read
+            bool m_afterComma = false;
+        };
+
+        // RFC 4180 records, quoted fields may span lines
+        class CsvReader
+        {
+        public:
+            explicit CsvReader(std::istream& in) : m_source(in) {}
+
+            // False at the end of the input
+            bool ReadRecord(std::vector<std::string>& fields)
+            {
+                fields.clear();
+                if (m_source.Peek() == EOF) return false;
+
+                std::string field;
+                bool quoted = false;
+                for (;;)
+                {
+                    const int c = m_source.Get();
+                    if (quoted)
+                    {
+                        if (c == EOF) { m_error = true; break; }
+                        if (c == '"')
+                        {
+                            if (m_source.Peek() == '"') field += static_cast<char>(m_source.Get());
+                            else quoted = false;
+                        }
+                        else
+                        {
+                            field += static_cast<char>(c);
+                        }
+                        continue;
+                    }
+
+                    if (c == '"' && field.empty()) { quoted = true; continue; }
+                    if (c == ',') { fields.push_back(std::move(field)); field.clear(); continue; }
+                    if (c == '\r' && m_source.Peek() == '\n') continue;
+                    if (c == '\n' || c == EOF) break;
+                    field += static_cast<char>(c);
+                }
+                fields.push_back(std::move(field));
+                return true;
+            }
+
+            bool HasError() const { return m_error; }
+            size_t GetLine() const { return m_source.GetLine(); }
+            uint64_t GetBytes() const { return m_source.GetBytes(); }
+
+        private:
+            Source m_source;
+            bool m_error = false;
+        };
+
+        // Writes the ExportProject events as JSON, one card object per line
+        class JsonExport
+        {
+        public:
+            explicit JsonExport(Sink& sink) : m_sink(sink) {}
+
+            bool Project(const Kanban::Project& project)
+            {
+                m_sink << "{\n  \"format\": \"" << FORMAT_NAME << "\",\n  \"version\": "
+                       << static_cast<int64_t>(FORMAT_VERSION) << ",\n  \"project\": {\"id\": ";
+                m_sink.JsonString(project.id);
+                m_sink << ", \"name\": ";
+                m_sink.JsonString(project.name);
+                m_sink << ", \"description\": ";
+                m_sink.JsonString(project.description);
+                m_sink << ", \"active\": " << (project.isActive ? "true" : "false")
+                       << ", \"createdMs\": " << Utils::ToEpochMs(project.createdAt)
+                       << ", \"modifiedMs\": " << Utils::ToEpochMs(project.modifiedAt) << "},\n  \"boards\": [";
+                return m_sink.IsGood();
+            }
+
+            bool Board(const Kanban::Board& board)
+            {
+                CloseBoard();
+                m_sink << (m_boards++ ? ",\n    {\"id\": " : "\n    {\"id\": ");
+                m_sink.JsonString(board.id);
+                m_sink << ", \"name\": ";
+                m_sink.JsonString(board.name);
+                m_sink << ", \"description\": ";
+                m_sink.JsonString(board.description);
+                m_sink << ", \"createdMs\": " << Utils::ToEpochMs(board.createdAt)
+                       << ", \"modifiedMs\": " << Utils::ToEpochMs(board.modifiedAt) << ", \"columns\": [";
+                m_boardOpen = true;
+                m_columns = 0;
+                return m_sink.IsGood();
+            }
+
+            bool Column(const Kanban::Column& column)
+            {
+                CloseColumn();
+                m_sink << (m_columns++ ? ",\n      {\"id\": " : "\n      {\"id\": ");
+                m_sink.JsonString(column.id);
+                m_sink << ", \"name\": ";
+                m_sink.JsonString(column.name);
+                m_sink << ", \"color\": \"" << FormatColor(column.headerColor) << "\", \"cardLimit\": "
+                       << static_cast<int64_t>(column.cardLimit) << ", \"collapsed\": "
+                       << (column.isCollapsed ? "true" : "false") << ", \"rank\": ";
+                m_sink.JsonString(column.rank);
+                m_sink << ", \"cards\": [";
+                m_columnOpen = true;
+                m_cards = 0;
+                return m_sink.IsGood();
+            }
+
+            bool Card(const Kanban::Card& card)
+            {
+                m_sink << (m_cards++ ? ",\n        {\"id\": " : "\n        {\"id\": ");
+                m_sink.JsonString(card.id);
+                m_sink << ", \"title\": ";
+                m_sink.JsonString(card.title);
+                m_sink << ", \"description\": ";
+                m_sink.JsonString(card.description);
+                m_sink << ", \"priority\": \"" << PRIORITY_NAMES[static_cast<int>(card.priority) & 3]
+                       << "\", \"status\": \"" << STATUS_NAMES[std::min(static_cast<int>(card.status), 2)]
+                       << "\", \"color\": \"" << FormatColor(card.color) << "\", \"assignee\": ";
+                m_sink.JsonString(card.assignee);
+                m_sink << ", \"dueDate\": ";
+                m_sink.JsonString(card.dueDate);
+                m_sink << ", \"tags\": [";
+                for (size_t i = 0; i < card.tags.size(); ++i)
+                {
+                    if (i) m_sink << ", ";
+                    m_sink.JsonString(card.tags[i]);
+                }
+                m_sink << "], \"rank\": ";
+                m_sink.JsonString(card.rank);
+                m_sink << ", \"createdMs\": " << Utils::ToEpochMs(card.createdAt)
+                       << ", \"modifiedMs\": " << Utils::ToEpochMs(card.modifiedAt) << "}";
+                return m_sink.IsGood();
+            }
+
+            void Finish()
+            {
+                CloseBoard();
+                m_sink << (m_boards ? "\n  ]\n}\n" : "]\n}\n");
+            }
+
+        private:
+            void CloseColumn()
+            {
+                if (m_columnOpen)
+                {
+                    m_sink << (m_cards ? "\n      ]}" : "]}");
+                    m_columnOpen = false;
+                }
+            }
+
+            void CloseBoard()
+            {
+                CloseColumn();
+                if (m_boardOpen)
+                {
+                    m_sink << (m_columns ? "\n    ]}" : "]}");
+                    m_boardOpen = false;
+                }
+            }
+
+            Sink& m_sink;
+            size_t m_boards = 0;
+            size_t m_columns = 0;
+            size_t m_cards = 0;
+            bool m_boardOpen = false;
+            bool m_columnOpen = false;
+        };
+    }
+
+    TransferFormat GetTransferFormat(const std::string& filePath)
+    {
+        const size_t dot = filePath.find_last_of('.');
+        std::string extension = dot == std::string::npos ? std::string() : filePath.substr(dot + 1);
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension == "csv" ? TransferFormat::Csv : TransferFormat::Json;
+    }
+
+    bool Exporter::Export(const std::string& projectId, const std::string& boardId, std::ostream& out,
+                          TransferFormat format)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        m_stats = TransferStats();
+
+        Sink sink(out);
+        JsonExport json(sink);
+        std::string boardName;
+        std::string columnName;
+        bool columnHasCards = true;
+
+        // CSV has no row for a column header, so an empty column is written as a row
+        // without a title when the next column (or the end) shows it had no cards
+        auto csvEmptyColumn = [&]() {
+            if (!columnHasCards)
+            {
+                sink.CsvField(boardName);
+                sink << ',';
+                sink.CsvField(columnName);
+                sink << ",,,,,,,,,,\n";
+            }
+        };
+
+        KanbanDatabase::ExportVisitor visitor;
+        visitor.project = [&](const Project& project) {
+            if (format == TransferFormat::Json) return json.Project(project);
+            for (size_t i = 0; i < CSV_COLUMNS; ++i)
+            {
+                sink << (i ? "," : "") << CSV_HEADER[i];
+            }
+            sink << '\n';
+            return sink.IsGood();
+        };
+        visitor.board = [&](const Board& board) {
+            ++m_stats.boards;
+            if (format == TransferFormat::Json) return json.Board(board);
+            csvEmptyColumn();
+            columnHasCards = true;
+            boardName = board.name;
+            return true;
+        };
+        visitor.column = [&](const Column& column) {
+            ++m_stats.columns;
+            if (format == TransferFormat::Json) return json.Column(column);
+            csvEmptyColumn();
+            columnHasCards = false;
+            columnName = column.name;
+            return true;
+        };
+        visitor.card = [&](const Card& card) {
+            ++m_stats.cards;
+            if (format == TransferFormat::Json) return json.Card(card);
+
+            std::string tags;
+            for (const auto& tag : card.tags)
+            {
+                if (!tags.empty()) tags += TAG_SEPARATOR;
+                for (char c : tag)
+                {
+                    if (c == TAG_SEPARATOR || c == TAG_ESCAPE) tags += TAG_ESCAPE;
+                    tags += c;
+                }
+            }
+            columnHasCards = true;
+            sink.CsvField(boardName);
+            sink << ',';
+            sink.CsvField(columnName);
+            sink << ',';
+            sink.CsvField(card.title);
+            sink << ',';
+            sink.CsvField(card.description);
+            sink << ',' << PRIORITY_NAMES[static_cast<int>(card.priority) & 3] << ','
+                 << STATUS_NAMES[std::min(static_cast<int>(card.status), 2)] << ',' << FormatColor(card.color) << ',';
+            sink.CsvField(card.assignee);
+            sink << ',';
+            sink.CsvField(card.dueDate);
+            sink << ',';
+            sink.CsvField(tags);
+            sink << ',' << Utils::ToEpochMs(card.createdAt) << ',' << Utils::ToEpochMs(card.modifiedAt) << '\n';
+            return sink.IsGood();
+        };
+
+        if (!m_database.ExportProject(projectId, boardId, visitor))
+        {
+            Logger::Error("Export failed: {}", sink.IsGood() ? m_database.GetLastError() : "write error");
+            return false;
+        }
+
+        if (format == TransferFormat::Json)
+        {
+            json.Finish();
+        }
+        else
+        {
+            csvEmptyColumn();
+        }
+        if (!sink.Flush())
+        {
+            Logger::Error("Export failed: write error");
+            return false;
+        }
+
+        m_stats.bytes = sink.GetBytes();
+        m_stats.seconds = SecondsSince(start);
+        Logger::Info("Exported {} boards, {} cards ({} KiB) in {} ms, {} cards/s", m_stats.boards, m_stats.cards,
+                     m_stats.bytes / 1024, static_cast<int64_t>(m_stats.seconds * 1000.0),
+                     static_cast<int64_t>(m_stats.GetCardsPerSecond()));
+        return true;
+    }
+
+    namespace
+    {
+        // Inserts for one import. Boards and columns are written as they are met; cards are
+        // collected into batches. Ranks from the input are kept while they ascend, otherwise
+        // the card or column goes after the previous one.
+        class ImportSession
+        {
+        public:
+            ImportSession(KanbanDatabase& database, size_t batchSize, const std::string& projectName,
+                          std::string& projectId, std::string& error, TransferStats& stats)
+                : m_database(database), m_batchSize(batchSize), m_projectName(projectName),
+                  m_projectId(projectId), m_error(error), m_stats(stats)
+            {
+                m_batch.reserve(batchSize);
+            }
+
+            bool CreateProject(Project& project)
+            {
+                if (!m_projectId.empty()) return true; // Boards came first, or already created
+                if (project.name.empty()) project.name = m_projectName;
+                if (!m_database.CreateProject(project)) return Fail("cannot create project");
+                m_projectId = project.id;
+                return true;
+            }
+
+            bool CreateBoard(Board& board)
+            {
+                Project project;
+                if (!CreateProject(project)) return false;
+                if (!m_database.CreateBoard(board, m_projectId)) return Fail("cannot create board");
+                SelectBoard(board.id);
+                ++m_stats.boards;
+                return true;
+            }
+
+            bool CreateColumn(Column& column)
+            {
+                if (m_boardId.empty())
+                {
+                    Board board("Imported Board");
+                    if (!CreateBoard(board)) return false;
+                }
+                column.rank = NextRank(m_boardId, column.rank);
+                if (!m_database.CreateColumn(column, m_boardId)) return Fail("cannot create column");
+                m_columnId = column.id;
+                ++m_stats.columns;
+                return true;
+            }
+
+            bool AddCard(Card& card)
+            {
+                if (m_columnId.empty())
+                {
+                    Column column("Imported");
+                    if (!CreateColumn(column)) return false;
+                }
+                card.rank = NextRank(m_columnId, card.rank);
+                m_batch.push_back({ std::move(card), m_columnId });
+                ++m_stats.cards;
+                return m_batch.size() < m_batchSize || Flush();
+            }
+
+            // Back to a board or column created earlier (CSV rows need not be grouped)
+            void SelectBoard(const std::string& boardId)
+            {
+                m_boardId = boardId;
+                m_columnId.clear();
+            }
+            void SelectColumn(const std::string& columnId) { m_columnId = columnId; }
+
+            bool Flush()
+            {
+                if (!m_batch.empty() && !m_database.CreateCards(m_batch)) return Fail(m_database.GetLastError());
+                m_batch.clear();
+                return true;
+            }
+
+            bool Fail(const std::string& error)
+            {
+                if (m_error.empty()) m_error = error;
+                return false;
+            }
+
+        private:
+            std::string NextRank(const std::string& parentId, const std::string& rank)
+            {
+                std::string& last = m_lastRanks[parentId];
+                if (rank.empty() || rank <= last || LexoRank::NeedsRebalance(rank))
+                {
+                    last = LexoRank::Between(last, std::string());
+                }
+                else
+                {
+                    last = rank;
+                }
+                return last;
+            }
+
+            KanbanDatabase& m_database;
+            size_t m_batchSize;
+            const std::string& m_projectName;
+            std::string& m_projectId;
+            std::string& m_error;
+            TransferStats& m_stats;
+
+            std::vector<KanbanDatabase::CardInsert> m_batch;
+            std::unordered_map<std::string, std::string> m_lastRanks; // Board or column id -> last child rank
+            std::string m_boardId;
+            std::string m_columnId;
+        };
+
+        using Token = JsonReader::Token;
+
+        bool ReadString(JsonReader& reader, std::string& value)
+        {
+            const Token token = reader.Next();
+            if (token == Token::String)
+            {
+                value = reader.GetText();
+                return true;
+            }
+            return token == Token::Null;
+        }
+
+        bool ReadInt(JsonReader& reader, int64_t& value)
+        {
+            const Token token = reader.Next();
+            if (token == Token::Number)
+            {
+                value = static_cast<int64_t>(std::strtod(reader.GetText().c_str(), nullptr));
+                return true;
+            }
+            return token == Token::Null;
+        }
+
+        bool ReadBool(JsonReader& reader, bool& value)
+        {
+            const Token token = reader.Next();
+            value = token == Token::True;
+            return token == Token::True || token == Token::False || token == Token::Null;
+        }
+
+        bool ReadTime(JsonReader& reader, std::chrono::system_clock::time_point& value)
+        {
+            int64_t ms = 0;
+            if (!ReadInt(reader, ms)) return false;
+            if (ms > 0) value = Utils::FromEpochMs(ms);
+            return true;
+        }
+
+        bool ReadColor(JsonReader& reader, Color& color)
+        {
+            std::string text;
+            return ReadString(reader, text) && (text.empty() || ParseColor(text, color));
+        }
+
+        // Reads the members of an object whose '{' was just read; field handles a key and
+        // returns false on error, anything it does not know is skipped by returning true
+        // without reading (signalled through handled = false)
+        template<typename Field>
+        bool ReadObject(JsonReader& reader, Field field)
+        {
+            for (;;)
+            {
+                const Token token = reader.Next();
+                if (token == Token::ObjectEnd) return true;
+                if (token != Token::Key) return false;
+
+                const std::string key = reader.GetText();
+                bool handled = true;
+                if (!field(key, handled)) return false;
+                if (!handled && !reader.Skip(reader.Next())) return false;
+            }
+        }
+
+        // Calls item for each element of an array of objects
+        template<typename Item>
+        bool ReadArray(JsonReader& reader, Item item)
+        {
+            if (reader.Next() != Token::ArrayBegin) return false;
+            for (;;)
+            {
+                const Token token = reader.Next();
+                if (token == Token::ArrayEnd) return true;
+                if (token != Token::ObjectBegin || !item()) return false;
+            }
+        }
+
+        bool ReadCard(JsonReader& reader, Card& card)
+        {
+            return ReadObject(reader, [&](const std::string& key, bool& handled) {
+                std::string text;
+                if (key == "title") return ReadString(reader, card.title);
+                if (key == "description") return ReadString(reader, card.description);
+                if (key == "assignee") return ReadString(reader, card.assignee);
+                if (key == "dueDate") return ReadString(reader, card.dueDate);
+                if (key == "rank") return ReadString(reader, card.rank);
+                if (key == "color") return ReadColor(reader, card.color);
+                if (key == "createdMs") return ReadTime(reader, card.createdAt);
+                if (key == "modifiedMs") return ReadTime(reader, card.modifiedAt);
+                if (key == "priority") return ReadString(reader, text) && ParseEnum(text, PRIORITY_NAMES, card.priority);
+                if (key == "status") return ReadString(reader, text) && ParseEnum(text, STATUS_NAMES, card.status);
+                if (key == "tags")
+                {
+                    if (reader.Next() != Token::ArrayBegin) return false;
+                    for (Token token; (token = reader.Next()) != Token::ArrayEnd;)
+                    {
+                        if (token != Token::String) return false;
+                        card.tags.push_back(reader.GetText());
+                    }
+                    return true;
+                }
+                handled = false;
+                return true;
+            });
+        }
+
+        bool ReadColumn(JsonReader& reader, ImportSession& session)
+        {
+            Column column;
+            bool created = false;
+            auto create = [&]() { return created || (created = session.CreateColumn(column)); };
+
+            return ReadObject(reader, [&](const std::string& key, bool& handled) {
+                if (key == "name") return ReadString(reader, column.name);
+                if (key == "rank") return ReadString(reader, column.rank);
+                if (key == "color") return ReadColor(reader, column.headerColor);
+                if (key == "collapsed") return ReadBool(reader, column.isCollapsed);
+                if (key == "cardLimit")
+                {
+                    int64_t limit = -1;
+                    if (!ReadInt(reader, limit)) return false;
+                    column.cardLimit = static_cast<int>(limit);
+                    return true;
+                }
+                if (key == "cards")
+                {
+                    return create() && ReadArray(reader, [&]() {
+                        Card card;
+                        return ReadCard(reader, card) && session.AddCard(card);
+                    });
+                }
+                handled = false;
+                return true;
+            }) && create();
+        }
+
+        bool ReadBoard(JsonReader& reader, ImportSession& session)
+        {
+            Board board;
+            bool created = false;
+            auto create = [&]() { return created || (created = session.CreateBoard(board)); };
+
+            return ReadObject(reader, [&](const std::string& key, bool& handled) {
+                if (key == "name") return ReadString(reader, board.name);
+                if (key == "description") return ReadString(reader, board.description);
+                if (key == "createdMs") return ReadTime(reader, board.createdAt);
+                if (key == "modifiedMs") return ReadTime(reader, board.modifiedAt);
+                if (key == "columns")
+                {
+                    return create() && ReadArray(reader, [&]() { return ReadColumn(reader, session); });
+                }
+                handled = false;
+                return true;
+            }) && create();
+        }
+
+        bool ReadJson(JsonReader& reader, ImportSession& session)
+        {
+            Project project;
+            if (reader.Next() != Token::ObjectBegin) return false;
+
+            return ReadObject(reader, [&](const std::string& key, bool& handled) {
+                std::string text;
+                int64_t version = 0;
+                if (key == "format")
+                {
+                    return ReadString(reader, text) && (text == FORMAT_NAME || session.Fail("not a Kanban export"));
+                }
+                if (key == "version")
+                {
+                    return ReadInt(reader, version) &&
+                           (version <= FORMAT_VERSION || session.Fail("unsupported version " + std::to_string(version)));
+                }
+                if (key == "project")
+                {
+                    if (reader.Next() != Token::ObjectBegin) return false;
+                    return ReadObject(reader, [&](const std::string& field, bool& known) {
+                        if (field == "name") return ReadString(reader, project.name);
+                        if (field == "description") return ReadString(reader, project.description);
+                        if (field == "active") return ReadBool(reader, project.isActive);
+                        if (field == "createdMs") return ReadTime(reader, project.createdAt);
+                        if (field == "modifiedMs") return ReadTime(reader, project.modifiedAt);
+                        known = false;
+                        return true;
+                    }) && session.CreateProject(project);
+                }
+                if (key == "boards")
+                {
+                    return session.CreateProject(project) &&
+                           ReadArray(reader, [&]() { return ReadBoard(reader, session); });
+                }
+                handled = false;
+                return true;
+            }) && session.CreateProject(project) && reader.Next() == Token::End;
+        }
+
+        bool ReadCsv(CsvReader& reader, ImportSession& session)
+        {
+            std::vector<std::string> fields;
+            if (!reader.ReadRecord(fields)) return session.Fail("empty file");
+
+            // Header names in any order; unknown ones are ignored
+            int index[CSV_COLUMNS];
+            for (size_t i = 0; i < CSV_COLUMNS; ++i)
+            {
+                auto it = std::find(fields.begin(), fields.end(), CSV_HEADER[i]);
+                index[i] = it == fields.end() ? -1 : static_cast<int>(it - fields.begin());
+            }
+            if (index[1] < 0 || index[2] < 0) return session.Fail("CSV needs 'column' and 'title' columns");
+
+            Project project;
+            if (!session.CreateProject(project)) return false;
+
+            // Boards by name, columns by board id and name - a few entries, not one per card
+            std::unordered_map<std::string, std::string> boardIds;
+            std::unordered_map<std::string, std::string> columnIds;
+            std::string boardId;
+            std::string columnId;
+
+            while (reader.ReadRecord(fields))
+            {
+                if (fields.size() == 1 && fields[0].empty()) continue; // Blank line
+
+                auto field = [&](size_t column) -> const std::string& {
+                    static const std::string empty;
+                    return index[column] >= 0 && index[column] < static_cast<int>(fields.size()) ? fields[index[column]] : empty;
+                };
+                const std::string boardName = field(0).empty() ? std::string("Imported Board") : field(0);
+
+                auto board = boardIds.find(boardName);
+                if (board == boardIds.end())
+                {
+                    // Boards list newest first; stepping back a millisecond per board keeps
+                    // them in file order
+                    Board newBoard(boardName);
+                    newBoard.createdAt = project.createdAt - std::chrono::milliseconds(boardIds.size());
+                    if (!session.CreateBoard(newBoard)) return false;
+                    board = boardIds.emplace(boardName, newBoard.id).first;
+                    boardId = newBoard.id;
+                    columnId.clear();
+                }
+                else if (board->second != boardId)
+                {
+                    session.SelectBoard(board->second);
+                    boardId = board->second;
+                    columnId.clear();
+                }
+
+                const std::string columnKey = boardId + '\n' + field(1);
+                auto column = columnIds.find(columnKey);
+                if (column == columnIds.end())
+                {
+                    Column newColumn(field(1));
+                    if (!session.CreateColumn(newColumn)) return false;
+                    column = columnIds.emplace(columnKey, newColumn.id).first;
+                    columnId = newColumn.id;
+                }
+                else if (column->second != columnId)
+                {
+                    session.SelectColumn(column->second);
+                    columnId = column->second;
+                }
+
+                if (field(2).empty()) continue; // Column without cards
+
+                Card card(field(2));
+                card.description = field(3);
+                card.assignee = field(7);
+                card.dueDate = field(8);
+                int64_t ms = 0;
+                if ((!field(4).empty() && !ParseEnum(field(4), PRIORITY_NAMES, card.priority)) ||
+                    (!field(5).empty() && !ParseEnum(field(5), STATUS_NAMES, card.status)) ||
+                    (!field(6).empty() && !ParseColor(field(6), card.color)))
+                {
+                    return session.Fail("bad priority, status or color on line " + std::to_string(reader.GetLine()));
+                }
+                if (ParseInt(field(10), ms) && ms > 0) card.createdAt = Utils::FromEpochMs(ms);
+                if (ParseInt(field(11), ms) && ms > 0) card.modifiedAt = Utils::FromEpochMs(ms);
+
+                const std::string& tags = field(9);
+                std::string tag;
+                for (size_t i = 0; i <= tags.size(); ++i)
+                {
+                    if (i == tags.size() || tags[i] == TAG_SEPARATOR)
+                    {
+                        if (!tag.empty()) card.tags.push_back(std::move(tag));
+                        tag.clear();
+                        continue;
+                    }
+                    if (tags[i] == TAG_ESCAPE && i + 1 < tags.size()) ++i;
+                    tag += tags[i];
+                }
+
+                if (!session.AddCard(card)) return false;
+            }
+
+            return !reader.HasError() || session.Fail("unterminated quoted field");
+        }
+    }
+
+    bool Importer::Import(std::istream& in, TransferFormat format)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        m_stats = TransferStats();
+        m_projectId.clear();
+        m_error.clear();
+
+        ImportSession session(m_database, m_batchSize, m_projectName, m_projectId, m_error, m_stats);
+        bool success = false;
+        if (format == TransferFormat::Json)
+        {
+            JsonReader reader(in);
+            success = ReadJson(reader, session);
+            if (!success && m_error.empty())
+            {
+                m_error = reader.GetError().empty() ? "unexpected JSON structure" : reader.GetError();
+            }
+            m_stats.bytes = reader.GetBytes();
+        }
+        else
+        {
+            CsvReader reader(in);
+            success = ReadCsv(reader, session);
+            m_stats.bytes = reader.GetBytes();
+        }
+        success = success && session.Flush();
+
+        if (!success)
+        {
+            Logger::Error("Import failed: {}", m_error);
+            if (!m_projectId.empty())
+            {
+                m_database.DeleteProject(m_projectId);
+                m_projectId.clear();
+            }
+            return false;
+        }
+
+        m_stats.seconds = SecondsSince(start);
+        Logger::Info("Imported {} boards, {} cards in {} ms, {} cards/s", m_stats.boards, m_stats.cards,
+                     static_cast<int64_t>(m_stats.seconds * 1000.0), static_cast<int64_t>(m_stats.GetCardsPerSecond()));
+        return true;
+    }
+}
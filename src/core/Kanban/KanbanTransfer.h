@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+class KanbanDatabase;
+
+namespace Kanban
+{
+    // File formats for project and board exchange, picked by extension (.csv, else JSON).
+    //
+    // JSON - {"format": "potensio-kanban", "version": 1, "project": {...}, "boards": [{...,
+    //   "columns": [{..., "cards": [{...}]}]}]}. Header fields come before the nested arrays.
+    // CSV - one row per card in board, column and rank order under a header row; a column
+    //   without cards is one row with an empty title. Tags are joined with ';'; a ';' or
+    //   '\' inside a tag name is escaped with '\'.
+    enum class TransferFormat
+    {
+        Json = 0,
+        Csv
+    };
+
+    TransferFormat GetTransferFormat(const std::string& filePath);
+
+    struct TransferStats
+    {
+        size_t boards = 0;
+        size_t columns = 0;
+        size_t cards = 0;
+        uint64_t bytes = 0;
+        double seconds = 0.0;
+
+        double GetCardsPerSecond() const { return seconds > 0.0 ? cards / seconds : 0.0; }
+    };
+
+    // Writes straight from the database cursors: one card is held at a time, whatever the
+    // size of the project.
+    class Exporter
+    {
+    public:
+        explicit Exporter(KanbanDatabase& database) : m_database(database) {}
+
+        // An empty boardId exports every board of the project
+        bool Export(const std::string& projectId, const std::string& boardId, std::ostream& out,
+                    TransferFormat format);
+        const TransferStats& GetStats() const { return m_stats; }
+
+    private:
+        KanbanDatabase& m_database;
+        TransferStats m_stats;
+    };
+
+    // Reads a file written by the Exporter (CSV written by hand works too) into a new project
+    // with fresh ids. Input is parsed as it is read and cards are inserted in batches of
+    // batchSize, one transaction each, so memory stays at one batch. A failed import deletes
+    // what it inserted.
+    class Importer
+    {
+    public:
+        explicit Importer(KanbanDatabase& database, size_t batchSize = 1000)
+            : m_database(database), m_batchSize(batchSize ? batchSize : 1) {}
+
+        // Name for a project the input does not name (CSV)
+        void SetProjectName(const std::string& name) { m_projectName = name; }
+
+        bool Import(std::istream& in, TransferFormat format);
+        const std::string& GetProjectId() const { return m_projectId; }
+        const TransferStats& GetStats() const { return m_stats; }
+        const std::string& GetError() const { return m_error; }
+
+    private:
+        KanbanDatabase& m_database;
+        size_t m_batchSize;
+        std::string m_projectName = "Imported Project";
+        std::string m_projectId;
+        std::string m_error;
+        TransferStats m_stats;
+    };
+}
@@ -0,0 +1,162 @@
+#include "LexoRank.h"
+
+#include <cstdint>
+
+namespace Kanban
+{
+    namespace
+    {
+        constexpr int BASE = 36;
+
+        int Digit(char c)
+        {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'z') return c - 'a' + 10;
+            return -1;
+        }
+
+        char Char(int digit)
+        {
+            return static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        }
+
+        bool IsValid(const std::string& rank)
+        {
+            for (char c : rank)
+            {
+                if (Digit(c) < 0) return false;
+            }
+            return rank.empty() || rank.back() != '0';
+        }
+
+        void TrimZeros(std::string& rank)
+        {
+            while (!rank.empty() && rank.back() == '0')
+            {
+                rank.pop_back();
+            }
+        }
+
+        // Adds delta (+1/-1) at digit STEP_DIGITS of key, so repeated appends to the end
+        // of a list keep the key length fixed. Empty when the step over/underflows.
+        std::string Step(const std::string& key, int delta)
+        {
+            std::string result = key.substr(0, LexoRank::STEP_DIGITS);
+            result.resize(LexoRank::STEP_DIGITS, '0');
+
+            for (size_t i = result.size(); i-- > 0;)
+            {
+                int digit = Digit(result[i]) + delta;
+                if (digit >= 0 && digit < BASE)
+                {
+                    result[i] = Char(digit);
+                    TrimZeros(result);
+                    return result;
+                }
+                result[i] = Char(delta > 0 ? 0 : BASE - 1); // Carry/borrow into the next digit
+            }
+            return std::string();
+        }
+
+        // Digit-wise midpoint. Past its end before reads as 0s and an open after as BASE.
+        std::string Midpoint(const std::string& before, const std::string& after)
+        {
+            std::string result;
+            size_t i = 0;
+            for (;; ++i)
+            {
+                const int low = i < before.size() ? Digit(before[i]) : 0;
+                const int high = after.empty() ? BASE : (i < after.size() ? Digit(after[i]) : 0);
+
+                if (low == high)
+                {
+                    result += Char(low);
+                    continue;
+                }
+                if (high - low > 1)
+                {
+                    result += Char((low + high) / 2);
+                    return result;
+                }
+
+                // Adjacent digits: keep before's digit, anything larger after it fits
+                result += Char(low);
+                ++i;
+                break;
+            }
+
+            for (;; ++i)
+            {
+                const int low = i < before.size() ? Digit(before[i]) : 0;
+                if (low < BASE - 1)
+                {
+                    result += Char((low + BASE) / 2);
+                    return result;
+                }
+                result += Char(low);
+            }
+        }
+    }
+
+    std::string LexoRank::Between(const std::string& before, const std::string& after)
+    {
+        if (!IsValid(before) || !IsValid(after) || (!before.empty() && !after.empty() && before >= after))
+        {
+            return std::string();
+        }
+
+        std::string result;
+        if (!before.empty() && after.empty())
+        {
+            result = Step(before, 1);
+        }
+        else if (before.empty() && !after.empty())
+        {
+            result = Step(after, -1);
+        }
+
+        if (result.empty())
+        {
+            result = Midpoint(before, after);
+        }
+
+        const bool ordered = (before.empty() || result > before) && (after.empty() || result < after);
+        return ordered ? result : std::string();
+    }
+
+    std::vector<std::string> LexoRank::Spread(size_t count)
+    {
+        std::vector<std::string> ranks;
+        if (count == 0) return ranks;
+
+        // Smallest width leaving at least BASE free keys between neighbours
+        size_t width = 1;
+        uint64_t space = BASE;
+        while (space / (count + 1) < BASE && width < 12)
+        {
+            space *= BASE;
+            ++width;
+        }
+
+        const uint64_t step = space / (count + 1);
+        ranks.reserve(count);
+        for (size_t i = 1; i <= count; ++i)
+        {
+            uint64_t value = step * i;
+            std::string rank(width, '0');
+            for (size_t d = width; d-- > 0;)
+            {
+                rank[d] = Char(static_cast<int>(value % BASE));
+                value /= BASE;
+            }
+            TrimZeros(rank);
+            ranks.push_back(std::move(rank));
+        }
+        return ranks;
+    }
+
+    bool LexoRank::NeedsRebalance(const std::string& rank)
+    {
+        return rank.empty() || rank.size() > REBALANCE_LENGTH;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Kanban
+{
+    // Ordering keys for cards and columns. A rank is a base-36 fraction written with the
+    // digits 0-9a-z and compared as a plain string, so a key can always be made between
+    // two neighbours and a move writes only the moved row. Keys never end in '0'.
+    class LexoRank
+    {
+    public:
+        // Key strictly between before and after; an empty bound is open. Returns an
+        // empty string when no key fits (equal or unordered neighbours).
+        static std::string Between(const std::string& before, const std::string& after);
+
+        // count evenly spaced keys in ascending order, for rebalancing a whole list
+        static std::vector<std::string> Spread(size_t count);
+
+        // True for keys that could not be made or have grown long enough to rebalance
+        static bool NeedsRebalance(const std::string& rank);
+
+        static constexpr size_t STEP_DIGITS = 6;       // Appends step at this digit
+        static constexpr size_t REBALANCE_LENGTH = 24;
+    };
+}
@@ -5,7 +5,9 @@
 #include <chrono>
 #include <iomanip>
 #include <sstream>
-#include <windows.h>
+#include <filesystem>
+#include <mutex>
+#include "platform/Platform.h"
 
 bool Logger::s_initialized = false;
 Logger::Level Logger::s_minLevel = Logger::Level::Debug;
@@ -18,7 +20,8 @@ void Logger::Initialize()
     s_initialized = true;
     
     // Create logs directory if it doesn't exist
-    CreateDirectoryA("logs", nullptr);
+    std::error_code ec;
+    std::filesystem::create_directories("logs", ec);
     
     Info("Logger initialized");
 }
@@ -63,11 +66,15 @@ void Logger::Log(Level level, const std::string& message)
     // Format: [TIMESTAMP] [LEVEL] MESSAGE
     std::string logLine = "[" + timestamp + "] [" + levelStr + "] " + message;
     
+    // The persistence worker logs from its own thread
+    static std::mutex s_logMutex;
+    std::lock_guard<std::mutex> lock(s_logMutex);
+
     // Output to console
     std::cout << logLine << std::endl;
     
     // Also output to debug console in Visual Studio
-    OutputDebugStringA((logLine + "\n").c_str());
+    Platform::WriteDebugOutput(logLine);
     
     // Could also log to file here if needed
     
@@ -101,7 +108,7 @@ std::string Logger::GetTimestamp()
     
     // Use safe version of localtime
     struct tm timeinfo;
-    if (localtime_s(&timeinfo, &time_t) == 0)
+    if (Platform::LocalTime(time_t, timeinfo))
     {
         std::stringstream ss;
         ss << std::put_time(&timeinfo, "%H:%M:%S");
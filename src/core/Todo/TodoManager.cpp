@@ -1,11 +1,15 @@
 #include "core/Todo/TodoManager.h"
+#include "core/Database/TodoDatabase.h"
+#include "core/Database/PersistenceWorker.h"
 #include "app/AppConfig.h"
 #include "core/Logger.h"
 #include "core/Utils.h"
 #include <algorithm>
+#include <unordered_set>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
+#include <cstdlib>
 #include <random>
 
 namespace Todo {
@@ -83,26 +87,156 @@ std::string Task::GetFormattedDueDate() const {
     return std::string(formatted);
 }
 
-ImVec4 Task::GetPriorityColor() const {
+Color Task::GetPriorityColor() const {
     switch (priority) {
-        case Priority::Low:    return ImVec4(0.5f, 0.8f, 0.5f, 1.0f); // Green (x=r, y=g, z=b, w=a)
-        case Priority::Medium: return ImVec4(0.8f, 0.8f, 0.5f, 1.0f); // Yellow
-        case Priority::High:   return ImVec4(0.9f, 0.6f, 0.3f, 1.0f); // Orange
-        case Priority::Urgent: return ImVec4(0.9f, 0.3f, 0.3f, 1.0f); // Red
-        default:               return ImVec4(0.7f, 0.7f, 0.7f, 1.0f); // Gray
+        case Priority::Low:    return Color(0.5f, 0.8f, 0.5f, 1.0f); // Green
+        case Priority::Medium: return Color(0.8f, 0.8f, 0.5f, 1.0f); // Yellow
+        case Priority::High:   return Color(0.9f, 0.6f, 0.3f, 1.0f); // Orange
+        case Priority::Urgent: return Color(0.9f, 0.3f, 0.3f, 1.0f); // Red
+        default:               return Color(0.7f, 0.7f, 0.7f, 1.0f); // Gray
     }
 }
 
-ImVec4 Task::GetStatusColor() const {
+Color Task::GetStatusColor() const {
     switch (status) {
-        case Status::Pending:    return ImVec4(0.7f, 0.7f, 0.7f, 1.0f); // Gray
-        case Status::InProgress: return ImVec4(0.3f, 0.6f, 0.9f, 1.0f); // Blue
-        case Status::Completed:  return ImVec4(0.4f, 0.8f, 0.4f, 1.0f); // Green
-        case Status::Cancelled:  return ImVec4(0.8f, 0.4f, 0.4f, 1.0f); // Red
-        default:                 return ImVec4(0.7f, 0.7f, 0.7f, 1.0f); // Gray
+        case Status::Pending:    return Color(0.7f, 0.7f, 0.7f, 1.0f); // Gray
+        case Status::InProgress: return Color(0.3f, 0.6f, 0.9f, 1.0f); // Blue
+        case Status::Completed:  return Color(0.4f, 0.8f, 0.4f, 1.0f); // Green
+        case Status::Cancelled:  return Color(0.8f, 0.4f, 0.4f, 1.0f); // Red
+        default:                 return Color(0.7f, 0.7f, 0.7f, 1.0f); // Gray
     }
 }
 
+// Recurrence Implementation
+namespace {
+    const char* const WEEKDAY_CODES[] = { "MO", "TU", "WE", "TH", "FR", "SA", "SU" };
+    
+    int DaysInMonth(int year, int month) {
+        return static_cast<int>(Utils::DaysFromCivil(month == 12 ? year + 1 : year, month == 12 ? 1 : month + 1, 1) -
+                                Utils::DaysFromCivil(year, month, 1));
+    }
+}
+
+bool Recurrence::operator==(const Recurrence& other) const {
+    return frequency == other.frequency && interval == other.interval && weekdays == other.weekdays &&
+           monthDay == other.monthDay && untilDay == other.untilDay;
+}
+
+std::vector<int64_t> Recurrence::GetOccurrences(int64_t startDay, int64_t firstDay, int64_t lastDay) const {
+    std::vector<int64_t> days;
+    const int step = std::max(1, interval);
+    firstDay = std::max(firstDay, startDay);
+    if (untilDay) {
+        lastDay = std::min(lastDay, *untilDay);
+    }
+    if (firstDay > lastDay) return days;
+    
+    switch (frequency) {
+        case Repeat::Daily: {
+            // Jump straight to the first step inside the window
+            for (int64_t day = startDay + (firstDay - startDay + step - 1) / step * step; day <= lastDay; day += step) {
+                days.push_back(day);
+            }
+            break;
+        }
+        case Repeat::Weekly: {
+            // Weeks run Monday to Sunday; every step-th one from the start's week counts
+            const int64_t firstMonday = startDay - Utils::GetWeekday(startDay);
+            const unsigned mask = weekdays ? weekdays : 1u << Utils::GetWeekday(startDay);
+            for (int64_t day = firstDay; day <= lastDay; ++day) {
+                if ((day - firstMonday) / 7 % step == 0 && (mask >> Utils::GetWeekday(day)) & 1) {
+                    days.push_back(day);
+                }
+            }
+            break;
+        }
+        case Repeat::Monthly: {
+            int startYear, startMonth, startDate;
+            Utils::CivilFromDays(startDay, startYear, startMonth, startDate);
+            const int dayOfMonth = monthDay > 0 ? monthDay : startDate;
+            const int64_t startIndex = startYear * 12LL + startMonth - 1;
+            
+            int year, month, unused;
+            Utils::CivilFromDays(firstDay, year, month, unused);
+            for (int64_t index = year * 12LL + month - 1; ; ++index) {
+                year = static_cast<int>(index / 12);
+                month = static_cast<int>(index % 12) + 1;
+                const int64_t monthStart = Utils::DaysFromCivil(year, month, 1);
+                if (monthStart > lastDay) break;
+                if ((index - startIndex) % step != 0) continue;
+                
+                const int64_t day = monthStart + std::min(dayOfMonth, DaysInMonth(year, month)) - 1;
+                if (day >= firstDay && day <= lastDay) {
+                    days.push_back(day);
+                }
+            }
+            break;
+        }
+        case Repeat::None:
+            break;
+    }
+    return days;
+}
+
+std::string Recurrence::ToString() const {
+    static const char* const FREQUENCIES[] = { "", "DAILY", "WEEKLY", "MONTHLY" };
+    if (!IsRepeating()) return "";
+    
+    std::string rule = std::string("FREQ=") + FREQUENCIES[static_cast<int>(frequency)];
+    if (interval > 1) {
+        rule += ";INTERVAL=" + std::to_string(interval);
+    }
+    if (frequency == Repeat::Weekly && weekdays) {
+        rule += ";BYDAY=";
+        for (int weekday = 0, count = 0; weekday < 7; ++weekday) {
+            if ((weekdays >> weekday) & 1) {
+                rule += (count++ ? "," : "") + std::string(WEEKDAY_CODES[weekday]);
+            }
+        }
+    }
+    if (frequency == Repeat::Monthly && monthDay > 0) {
+        rule += ";BYMONTHDAY=" + std::to_string(monthDay);
+    }
+    if (untilDay) {
+        std::string until = Utils::FormatDayNumber(*untilDay); // YYYY-MM-DD to YYYYMMDD
+        until.erase(std::remove(until.begin(), until.end(), '-'), until.end());
+        rule += ";UNTIL=" + until;
+    }
+    return rule;
+}
+
+bool Recurrence::Parse(const std::string& rule, Recurrence& recurrence) {
+    recurrence = Recurrence();
+    for (const std::string& part : Utils::Split(rule, ';')) {
+        const size_t equals = part.find('=');
+        if (equals == std::string::npos) continue;
+        const std::string key = part.substr(0, equals);
+        const std::string value = part.substr(equals + 1);
+        
+        if (key == "FREQ") {
+            if (value == "DAILY") recurrence.frequency = Repeat::Daily;
+            else if (value == "WEEKLY") recurrence.frequency = Repeat::Weekly;
+            else if (value == "MONTHLY") recurrence.frequency = Repeat::Monthly;
+        } else if (key == "INTERVAL") {
+            recurrence.interval = std::max(1, std::atoi(value.c_str()));
+        } else if (key == "BYDAY") {
+            for (const std::string& code : Utils::Split(value, ',')) {
+                for (int weekday = 0; weekday < 7; ++weekday) {
+                    if (code == WEEKDAY_CODES[weekday]) recurrence.weekdays |= static_cast<uint8_t>(1u << weekday);
+                }
+            }
+        } else if (key == "BYMONTHDAY") {
+            recurrence.monthDay = std::clamp(std::atoi(value.c_str()), 0, 31);
+        } else if (key == "UNTIL" && value.size() >= 8) {
+            int64_t day = 0;
+            if (Utils::ParseDayNumber(value.substr(0, 4) + "-" + value.substr(4, 2) + "-" + value.substr(6, 2), day)) {
+                recurrence.untilDay = day;
+            }
+        }
+    }
+    return recurrence.IsRepeating();
+}
+
 // DayTasks Implementation
 void DayTasks::AddTask(std::shared_ptr<Task> task) {
     if (task) {
@@ -195,8 +329,13 @@ TodoManager::~TodoManager() {
 bool TodoManager::Initialize(AppConfig* config) {
     m_config = config;
     
+    if (m_config) {
+        m_saveDelay = std::chrono::milliseconds(std::max(0, m_config->GetValue("todo.saveDelayMs", 500)));
+        m_maxSaveDelay = std::chrono::milliseconds(std::max(0, m_config->GetValue("todo.maxSaveDelayMs", 5000)));
+    }
+    
     // Load existing tasks
-    LoadFromFile();
+    LoadTasks();
     
     Logger::Info("TodoManager initialized successfully");
     return true;
@@ -204,15 +343,30 @@ bool TodoManager::Initialize(AppConfig* config) {
 
 void TodoManager::Shutdown() {
     // Save tasks before shutdown
-    SaveToFile();
+    SaveChanges();
     
     // Clear data
-    m_dayTasks.clear();
+    m_taskIndex.clear();
+    m_days.clear();
+    m_series.clear();
+    m_occurrences.clear();
+    m_visibleOccurrences.clear();
+    m_occurrencesStale = true;
+    m_monthGrids.clear();
     m_dragDropState = Todo::DragDropState();
     
     Logger::Debug("TodoManager shutdown complete");
 }
 
+void TodoManager::Update() {
+    if (!HasUnsavedChanges()) return;
+    
+    auto now = std::chrono::steady_clock::now();
+    if (now - m_lastChangeAt >= m_saveDelay || now - m_firstChangeAt >= m_maxSaveDelay) {
+        SaveChanges();
+    }
+}
+
 std::shared_ptr<Todo::Task> TodoManager::CreateTask(const std::string& title, const std::string& dueDate) {
     auto task = std::make_shared<Todo::Task>(title);
     
@@ -223,11 +377,12 @@ std::shared_ptr<Todo::Task> TodoManager::CreateTask(const std::string& title, co
     }
     
     // Add to appropriate day
-    EnsureDayExists(task->dueDate);
-    m_dayTasks[task->dueDate]->AddTask(task);
+    Todo::DayTasks& dayTasks = GetOrCreateDay(task->dueDate);
+    dayTasks.AddTask(task);
+    IndexDay(dayTasks);
     
     NotifyTaskUpdated(task);
-    SaveToFile();
+    MarkDayDirty(dayTasks.day);
     
     Logger::Debug("Created task: {}", title);
     return task;
@@ -236,76 +391,127 @@ std::shared_ptr<Todo::Task> TodoManager::CreateTask(const std::string& title, co
 bool TodoManager::UpdateTask(std::shared_ptr<Todo::Task> task) {
     if (!task) return false;
     
+    int64_t day = NO_DUE_DAY;
+    if (Series* series = LocateTask(task->id) ? nullptr : FindSeries(task->id, day)) {
+        const Todo::Task& rule = *series->task;
+        if (day == NO_DUE_DAY) {
+            MarkSeriesDirty(task->id); // Every occurrence follows the series
+        } else if (task->title == rule.title && task->description == rule.description &&
+                   task->priority == rule.priority && task->dueTime == rule.dueTime &&
+                   task->isAllDay == rule.isAllDay && task->category == rule.category && task->tags == rule.tags) {
+            SetOccurrenceStatus(*series, day, task->status);
+        } else {
+            task = DetachOccurrence(*series, day, *task, task->dueDate);
+        }
+        
+        NotifyTaskUpdated(task);
+        Logger::Debug("Updated task: {}", task->title);
+        return true;
+    }
+    
     NotifyTaskUpdated(task);
-    SaveToFile();
+    MarkDayDirty(ToDayNumber(task->dueDate));
     
     Logger::Debug("Updated task: {}", task->title);
     return true;
 }
 
 bool TodoManager::DeleteTask(const std::string& taskId) {
-    for (auto& [date, dayTasks] : m_dayTasks) {
-        if (dayTasks) {
-            auto& tasks = dayTasks->tasks;
-            auto it = std::find_if(tasks.begin(), tasks.end(),
-                [&taskId](const std::shared_ptr<Todo::Task>& task) {
-                    return task && task->id == taskId;
-                });
-            
-            if (it != tasks.end()) {
-                tasks.erase(it);
-                SaveToFile();
-                Logger::Debug("Deleted task: {}", taskId);
-                return true;
-            }
+    const TaskSlot* location = LocateTask(taskId);
+    if (!location) {
+        int64_t day = NO_DUE_DAY;
+        Series* series = FindSeries(taskId, day);
+        if (!series) return false;
+        
+        if (day == NO_DUE_DAY) {
+            m_series.erase(taskId);
+            m_occurrencesStale = true;
+            InvalidateGridDay(NO_DUE_DAY);
+            MarkTaskDeleted(taskId);
+        } else {
+            series->exceptions[day].skipped = true;
+            MarkSeriesDirty(series->task->id, day);
         }
+        Logger::Debug("Deleted task: {}", taskId);
+        return true;
+    }
+    
+    Todo::DayTasks& dayTasks = *location->dayTasks;
+    const size_t slot = location->slot;
+    m_taskIndex.erase(taskId);
+    dayTasks.tasks.erase(dayTasks.tasks.begin() + slot);
+    IndexDay(dayTasks, slot);
+    if (dayTasks.day != NO_DUE_DAY) {
+        InvalidateGridDay(dayTasks.day);
     }
     
-    return false;
+    MarkTaskDeleted(taskId);
+    Logger::Debug("Deleted task: {}", taskId);
+    return true;
 }
 
 std::shared_ptr<Todo::Task> TodoManager::FindTask(const std::string& taskId) {
-    for (auto& [date, dayTasks] : m_dayTasks) {
-        if (dayTasks) {
-            for (auto& task : dayTasks->tasks) {
-                if (task && task->id == taskId) {
-                    return task;
-                }
-            }
-        }
+    if (const TaskSlot* location = LocateTask(taskId)) {
+        return location->dayTasks->tasks[location->slot];
     }
-    return nullptr;
+    
+    auto series = m_series.find(taskId);
+    if (series != m_series.end()) return series->second.task;
+    
+    auto occurrence = m_occurrences.find(taskId);
+    return occurrence != m_occurrences.end() ? occurrence->second : nullptr;
 }
 
 bool TodoManager::CompleteTask(const std::string& taskId) {
-    auto task = FindTask(taskId);
-    if (!task) return false;
+    const TaskSlot* location = LocateTask(taskId);
+    if (!location) {
+        int64_t day = NO_DUE_DAY;
+        Series* series = FindSeries(taskId, day);
+        if (!series || day == NO_DUE_DAY) return false;
+        
+        SetOccurrenceStatus(*series, day, Todo::Status::Completed);
+        if (auto occurrence = FindTask(taskId)) {
+            NotifyTaskCompleted(occurrence);
+        }
+        return true;
+    }
+    
+    Todo::DayTasks& dayTasks = *location->dayTasks;
+    auto task = dayTasks.tasks[location->slot];
     
     task->status = Todo::Status::Completed;
     task->completedAt = std::chrono::system_clock::now();
     
     // Resort the day's tasks
-    for (auto& [date, dayTasks] : m_dayTasks) {
-        if (dayTasks) {
-            for (auto& dayTask : dayTasks->tasks) {
-                if (dayTask && dayTask->id == taskId) {
-                    dayTasks->SortTasksByPriority();
-                    break;
-                }
-            }
-        }
-    }
+    dayTasks.SortTasksByPriority();
+    IndexDay(dayTasks);
     
     NotifyTaskCompleted(task);
-    SaveToFile();
+    MarkDayDirty(dayTasks.day);
     
     Logger::Debug("Completed task: {}", task->title);
     return true;
 }
 
 bool TodoManager::ToggleTaskStatus(const std::string& taskId) {
-    auto task = FindTask(taskId);
-    if (!task) return false;
+    const TaskSlot* location = LocateTask(taskId);
+    if (!location) {
+        int64_t day = NO_DUE_DAY;
+        Series* series = FindSeries(taskId, day);
+        if (!series || day == NO_DUE_DAY) return false;
+        
+        auto exception = series->exceptions.find(day);
+        const bool completed = exception != series->exceptions.end() && exception->second.status == Todo::Status::Completed;
+        SetOccurrenceStatus(*series, day, completed ? Todo::Status::Pending : Todo::Status::Completed);
+        if (auto occurrence = FindTask(taskId)) {
+            if (!completed) NotifyTaskCompleted(occurrence);
+            NotifyTaskUpdated(occurrence);
+        }
+        return true;
+    }
+    
+    Todo::DayTasks& dayTasks = *location->dayTasks;
+    auto task = dayTasks.tasks[location->slot];
     
     if (task->status == Todo::Status::Completed) {
         task->status = Todo::Status::Pending;
@@ -316,19 +522,11 @@ bool TodoManager::ToggleTaskStatus(const std::string& taskId) {
     }
     
     // Resort the day's tasks
-    for (auto& [date, dayTasks] : m_dayTasks) {
-        if (dayTasks) {
-            for (auto& dayTask : dayTasks->tasks) {
-                if (dayTask && dayTask->id == taskId) {
-                    dayTasks->SortTasksByPriority();
-                    break;
-                }
-            }
-        }
-    }
+    dayTasks.SortTasksByPriority();
+    IndexDay(dayTasks);
     
     NotifyTaskUpdated(task);
-    SaveToFile();
+    MarkDayDirty(dayTasks.day);
     
     Logger::Debug("Toggled task status: {}", task->title);
     return true;
@@ -337,89 +535,257 @@ bool TodoManager::ToggleTaskStatus(const std::string& taskId) {
 bool TodoManager::MoveTask(const std::string& taskId, const std::string& newDate) {
     if (!IsValidDate(newDate)) return false;
     
-    // Find and remove task from current location
-    std::shared_ptr<Todo::Task> task;
-    for (auto& [date, dayTasks] : m_dayTasks) {
-        if (dayTasks) {
-            auto& tasks = dayTasks->tasks;
-            auto it = std::find_if(tasks.begin(), tasks.end(),
-                [&taskId](const std::shared_ptr<Todo::Task>& t) {
-                    return t && t->id == taskId;
-                });
-            
-            if (it != tasks.end()) {
-                task = *it;
-                tasks.erase(it);
-                break;
-            }
+    // Remove task from current location - the index knows it even if its dueDate was already changed
+    const TaskSlot* location = LocateTask(taskId);
+    if (!location) {
+        int64_t day = NO_DUE_DAY;
+        Series* series = FindSeries(taskId, day);
+        if (!series) return false;
+        
+        if (day == NO_DUE_DAY) {
+            // A series moves its start; occurrences already skipped or done keep their days
+            series->task->dueDate = newDate;
+            MarkSeriesDirty(taskId);
+            NotifyTaskUpdated(series->task);
+        } else {
+            auto occurrence = FindTask(taskId);
+            Todo::Task fields;
+            FillOccurrence(fields, *series, day);
+            NotifyTaskUpdated(DetachOccurrence(*series, day, occurrence ? *occurrence : fields, newDate));
         }
+        return true;
     }
     
-    if (!task) return false;
+    Todo::DayTasks& oldDay = *location->dayTasks;
+    const size_t slot = location->slot;
+    auto task = oldDay.tasks[slot];
+    oldDay.tasks.erase(oldDay.tasks.begin() + slot);
+    IndexDay(oldDay, slot);
+    MarkDayDirty(oldDay.day);
     
     // Update task due date and add to new location
     task->dueDate = newDate;
-    EnsureDayExists(newDate);
-    m_dayTasks[newDate]->AddTask(task);
+    Todo::DayTasks& dayTasks = GetOrCreateDay(newDate);
+    dayTasks.AddTask(task);
+    IndexDay(dayTasks);
     
     NotifyTaskUpdated(task);
-    SaveToFile();
+    MarkDayDirty(dayTasks.day);
     
     Logger::Debug("Moved task {} to {}", task->title, newDate);
     return true;
 }
 
 bool TodoManager::ReorderTask(const std::string& taskId, const std::string& date, int newIndex) {
-    auto dayTasks = GetTasksForDate(date);
-    if (!dayTasks) return false;
+    const TaskSlot* location = LocateTask(taskId);
+    if (!location || location->dayTasks->day != ToDayNumber(date)) return false;
     
+    Todo::DayTasks* dayTasks = location->dayTasks;
     auto& tasks = dayTasks->tasks;
-    auto it = std::find_if(tasks.begin(), tasks.end(),
-        [&taskId](const std::shared_ptr<Todo::Task>& task) {
-            return task && task->id == taskId;
-        });
-    
-    if (it == tasks.end()) return false;
-    
-    auto task = *it;
-    tasks.erase(it);
+    const size_t slot = location->slot;
+    auto task = tasks[slot];
+    tasks.erase(tasks.begin() + slot);
     
     // Insert at new position
+    size_t firstMoved = slot;
     if (newIndex >= 0 && newIndex <= static_cast<int>(tasks.size())) {
         tasks.insert(tasks.begin() + newIndex, task);
+        firstMoved = std::min(slot, static_cast<size_t>(newIndex));
     } else {
         tasks.push_back(task);
     }
+    IndexDay(*dayTasks, firstMoved);
     
-    SaveToFile();
+    MarkDayDirty(dayTasks->day);
     return true;
 }
 
-Todo::DayTasks* TodoManager::GetTasksForDate(const std::string& date) {
-    auto it = m_dayTasks.find(date);
-    if (it != m_dayTasks.end()) {
-        return it->second.get();
+std::shared_ptr<Todo::Task> TodoManager::CreateRepeatingTask(const std::string& title, const std::string& startDate, const Todo::Recurrence& recurrence) {
+    auto task = CreateTask(title, startDate);
+    if (recurrence.IsRepeating()) {
+        SetRecurrence(task->id, recurrence);
     }
-    return nullptr;
+    return task;
 }
 
-const Todo::DayTasks* TodoManager::GetTasksForDate(const std::string& date) const {
-    auto it = m_dayTasks.find(date);
-    if (it != m_dayTasks.end()) {
-        return it->second.get();
+bool TodoManager::SetRecurrence(const std::string& taskId, const Todo::Recurrence& recurrence) {
+    auto series = m_series.find(taskId);
+    if (series != m_series.end()) {
+        auto task = series->second.task;
+        if (recurrence.IsRepeating()) {
+            task->recurrence = recurrence;
+            MarkSeriesDirty(taskId);
+            return true;
+        }
+        
+        // Back to a single task on the series' start date; its exceptions go with the rule
+        m_series.erase(series);
+        m_occurrencesStale = true;
+        InvalidateGridDay(NO_DUE_DAY);
+        task->recurrence = Todo::Recurrence();
+        Todo::DayTasks& dayTasks = GetOrCreateDay(task->dueDate);
+        dayTasks.AddTask(task);
+        IndexDay(dayTasks);
+        MarkDayDirty(dayTasks.day);
+        return true;
     }
-    return nullptr;
+    
+    const TaskSlot* location = LocateTask(taskId);
+    if (!location) return false;
+    if (!recurrence.IsRepeating()) return true;
+    
+    // The task becomes the series, starting on its due date, and leaves the day lists
+    Todo::DayTasks& dayTasks = *location->dayTasks;
+    const size_t slot = location->slot;
+    auto task = dayTasks.tasks[slot];
+    m_taskIndex.erase(taskId);
+    dayTasks.tasks.erase(dayTasks.tasks.begin() + slot);
+    IndexDay(dayTasks, slot);
+    MarkDayDirty(dayTasks.day);
+    
+    if (dayTasks.day == NO_DUE_DAY) {
+        task->dueDate = GetTodayDate();
+    }
+    task->recurrence = recurrence;
+    task->status = Todo::Status::Pending; // Each occurrence has its own
+    m_series[taskId].task = task;
+    MarkSeriesDirty(taskId);
+    
+    Logger::Debug("Task {} repeats {}", task->title, recurrence.ToString());
+    return true;
+}
+
+void TodoManager::SetVisibleDays(int64_t firstDay, int64_t lastDay) {
+    if (!m_occurrencesStale && firstDay == m_visibleFirst && lastDay == m_visibleLast) return;
+    
+    m_visibleFirst = firstDay;
+    m_visibleLast = lastDay;
+    m_occurrencesStale = false;
+    m_visibleOccurrences.assign(static_cast<size_t>(std::max<int64_t>(0, lastDay - firstDay + 1)), Todo::DayTasks());
+    
+    // Each rule is asked for the visible days only; objects still visible are refilled in place
+    std::unordered_map<std::string, std::shared_ptr<Todo::Task>> occurrences;
+    for (const auto& [seriesId, series] : m_series) {
+        int64_t startDay = 0;
+        if (!Utils::ParseDayNumber(series.task->dueDate, startDay)) continue;
+        
+        for (int64_t day : series.task->recurrence.GetOccurrences(startDay, firstDay, lastDay)) {
+            auto exception = series.exceptions.find(day);
+            if (exception != series.exceptions.end() && exception->second.skipped) continue;
+            
+            std::string occurrenceId = seriesId + "@" + Utils::FormatDayNumber(day);
+            auto existing = m_occurrences.find(occurrenceId);
+            auto occurrence = existing != m_occurrences.end() ? existing->second : std::make_shared<Todo::Task>(*series.task);
+            FillOccurrence(*occurrence, series, day);
+            m_visibleOccurrences[static_cast<size_t>(day - firstDay)].tasks.push_back(occurrence);
+            occurrences.emplace(std::move(occurrenceId), std::move(occurrence));
+        }
+    }
+    
+    for (size_t i = 0; i < m_visibleOccurrences.size(); ++i) {
+        Todo::DayTasks& dayTasks = m_visibleOccurrences[i];
+        dayTasks.day = firstDay + static_cast<int64_t>(i);
+        dayTasks.SortTasksByPriority();
+    }
+    m_occurrences.swap(occurrences);
+}
+
+std::vector<std::shared_ptr<Todo::Task>> TodoManager::GetAgendaForDay(int64_t day) const {
+    std::vector<std::shared_ptr<Todo::Task>> tasks;
+    if (const auto* dayTasks = FindDay(day)) {
+        tasks = dayTasks->tasks;
+    }
+    
+    if (day >= m_visibleFirst && day <= m_visibleLast && !m_visibleOccurrences.empty()) {
+        const auto& occurrences = m_visibleOccurrences[static_cast<size_t>(day - m_visibleFirst)].tasks;
+        tasks.insert(tasks.end(), occurrences.begin(), occurrences.end());
+    }
+    return tasks;
+}
+
+const Todo::MonthGrid& TodoManager::GetMonthGrid(int year, int month) {
+    // Overdue flags and the today mark move at midnight
+    const int64_t today = Utils::GetTodayDayNumber();
+    if (today != m_gridsToday) {
+        m_monthGrids.clear();
+        m_gridsToday = today;
+    }
+    
+    auto it = std::find_if(m_monthGrids.begin(), m_monthGrids.end(), [year, month](const std::unique_ptr<CachedGrid>& cached) {
+        return cached->grid.year == year && cached->grid.month == month;
+    });
+    
+    if (it == m_monthGrids.end()) {
+        auto cached = std::make_unique<CachedGrid>();
+        cached->grid.year = year;
+        cached->grid.month = month;
+        
+        const int64_t monthStart = Utils::DaysFromCivil(year, month, 1);
+        const int64_t firstDay = monthStart - Utils::GetWeekday(monthStart);
+        for (int i = 0; i < Todo::MonthGrid::CELLS; ++i) {
+            Todo::DaySummary& summary = cached->grid.days[i];
+            summary.day = firstDay + i;
+            int cellYear, cellMonth;
+            Utils::CivilFromDays(summary.day, cellYear, cellMonth, summary.dayOfMonth);
+            summary.inMonth = cellMonth == month;
+            summary.isToday = summary.day == today;
+        }
+        cached->stale.set();
+        
+        if (m_monthGrids.size() >= MAX_CACHED_GRIDS) {
+            m_monthGrids.pop_back();
+        }
+        it = m_monthGrids.insert(m_monthGrids.begin(), std::move(cached));
+    } else if (it != m_monthGrids.begin()) {
+        std::rotate(m_monthGrids.begin(), it, it + 1);
+        it = m_monthGrids.begin();
+    }
+    
+    // Only the cells a mutation touched since the last call are summed again
+    CachedGrid& cached = **it;
+    if (cached.stale.any()) {
+        for (size_t i = 0; i < cached.stale.size(); ++i) {
+            if (cached.stale.test(i)) {
+                SummarizeDay(cached.grid.days[i], today);
+            }
+        }
+        cached.stale.reset();
+    }
+    return cached.grid;
+}
+
+Todo::DayTasks* TodoManager::GetTasksForDate(const std::string& date) {
+    return FindDay(ToDayNumber(date));
+}
+
+const Todo::DayTasks* TodoManager::GetTasksForDate(const std::string& date) const {
+    return FindDay(ToDayNumber(date));
+}
+
+Todo::DayTasks* TodoManager::GetTasksForDay(int64_t day) {
+    return FindDay(day);
+}
+
+const Todo::DayTasks* TodoManager::GetTasksForDay(int64_t day) const {
+    return FindDay(day);
 }
 
 std::vector<std::shared_ptr<Todo::Task>> TodoManager::GetTasksInDateRange(const std::string& startDate, const std::string& endDate) const {
+    int64_t firstDay = 0;
+    int64_t lastDay = 0;
+    if (!Utils::ParseDayNumber(startDate, firstDay) || !Utils::ParseDayNumber(endDate, lastDay)) {
+        return {};
+    }
+    return GetTasksInDayRange(firstDay, lastDay);
+}
+
+std::vector<std::shared_ptr<Todo::Task>> TodoManager::GetTasksInDayRange(int64_t firstDay, int64_t lastDay) const {
     std::vector<std::shared_ptr<Todo::Task>> result;
     
-    for (const auto& [date, dayTasks] : m_dayTasks) {
-        if (date >= startDate && date <= endDate && dayTasks) {
-            for (const auto& task : dayTasks->tasks) {
-                if (task) {
-                    result.push_back(task);
-                }
+    for (auto it = LowerBoundDay(firstDay); it != m_days.end() && (*it)->day <= lastDay; ++it) {
+        for (const auto& task : (*it)->tasks) {
+            if (task) {
+                result.push_back(task);
             }
         }
     }
@@ -430,12 +796,12 @@ std::vector<std::shared_ptr<Todo::Task>> TodoManager::GetTasksInDateRange(const
 std::vector<std::shared_ptr<Todo::Task>> TodoManager::GetOverdueTasks() const {
     std::vector<std::shared_ptr<Todo::Task>> result;
     
-    for (const auto& [date, dayTasks] : m_dayTasks) {
-        if (dayTasks) {
-            for (const auto& task : dayTasks->tasks) {
-                if (task && task->IsOverdue()) {
-                    result.push_back(task);
-                }
+    // Every day before today, minus the undated bucket; a task there is overdue unless done
+    const int64_t today = Utils::GetTodayDayNumber();
+    for (auto it = LowerBoundDay(NO_DUE_DAY + 1); it != m_days.end() && (*it)->day < today; ++it) {
+        for (const auto& task : (*it)->tasks) {
+            if (task && !task->IsCompleted()) {
+                result.push_back(task);
             }
         }
     }
@@ -444,8 +810,7 @@ std::vector<std::shared_ptr<Todo::Task>> TodoManager::GetOverdueTasks() const {
 }
 
 std::vector<std::shared_ptr<Todo::Task>> TodoManager::GetTodayTasks() const {
-    std::string today = GetTodayDate();
-    const auto* dayTasks = GetTasksForDate(today);
+    const auto* dayTasks = FindDay(Utils::GetTodayDayNumber());
     if (dayTasks) {
         return dayTasks->tasks;
     }
@@ -453,69 +818,41 @@ std::vector<std::shared_ptr<Todo::Task>> TodoManager::GetTodayTasks() const {
 }
 
 std::vector<std::shared_ptr<Todo::Task>> TodoManager::GetUpcomingTasks(int days) const {
-    std::string today = GetTodayDate();
-    std::string endDate = today;
-    
-    // Calculate end date (today + days)
-    auto now = std::chrono::system_clock::now();
-    auto futureTime = now + std::chrono::hours(24 * days);
-    auto futureTimeT = std::chrono::system_clock::to_time_t(futureTime);
-    std::tm* tm_future = std::localtime(&futureTimeT);
-    
-    char futureStr[32];
-    std::strftime(futureStr, sizeof(futureStr), "%Y-%m-%d", tm_future);
-    endDate = std::string(futureStr);
-    
-    return GetTasksInDateRange(today, endDate);
+    const int64_t today = Utils::GetTodayDayNumber();
+    return GetTasksInDayRange(today, today + days);
 }
 
 void TodoManager::SetCurrentDate(const std::string& date) {
     if (IsValidDate(date)) {
         m_currentDate = date;
+        
+        int64_t day = 0;
+        if (Utils::ParseDayNumber(date, day)) {
+            EnsureDaysLoaded(day - LOAD_WINDOW_DAYS, day + LOAD_WINDOW_DAYS);
+        }
         NotifyDayChanged(date);
     }
 }
 
 std::string TodoManager::GetTodayDate() const {
-    auto now = std::chrono::system_clock::now();
-    auto today = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm_today = std::localtime(&today);
-    
-    char todayStr[32];
-    std::strftime(todayStr, sizeof(todayStr), "%Y-%m-%d", tm_today);
-    
-    return std::string(todayStr);
+    return Utils::FormatDayNumber(Utils::GetTodayDayNumber());
 }
 
 std::string TodoManager::GetPreviousDay(const std::string& date) {
-    auto tm = ParseDate(date);
-    auto timeT = std::mktime(&tm);
-    auto prevTime = timeT - 24 * 60 * 60; // Subtract one day
-    auto* prevTm = std::localtime(&prevTime);
-    
-    return FormatDate(*prevTm);
+    int64_t day = 0;
+    return Utils::ParseDayNumber(date, day) ? Utils::FormatDayNumber(day - 1) : date;
 }
 
 std::string TodoManager::GetNextDay(const std::string& date) {
-    auto tm = ParseDate(date);
-    auto timeT = std::mktime(&tm);
-    auto nextTime = timeT + 24 * 60 * 60; // Add one day
-    auto* nextTm = std::localtime(&nextTime);
-    
-    return FormatDate(*nextTm);
+    int64_t day = 0;
+    return Utils::ParseDayNumber(date, day) ? Utils::FormatDayNumber(day + 1) : date;
 }
 
 std::string TodoManager::GetWeekStart(const std::string& date) {
-    auto tm = ParseDate(date);
-    auto timeT = std::mktime(&tm);
-    auto* dateTm = std::localtime(&timeT);
-    
-    // Calculate days to subtract to get to Monday (assuming Sunday = 0)
-    int daysToSubtract = (dateTm->tm_wday == 0) ? 6 : dateTm->tm_wday - 1;
-    auto weekStartTime = timeT - (daysToSubtract * 24 * 60 * 60);
-    auto* weekStartTm = std::localtime(&weekStartTime);
+    int64_t day = 0;
+    if (!Utils::ParseDayNumber(date, day)) return date;
     
-    return FormatDate(*weekStartTm);
+    return Utils::FormatDayNumber(day - Utils::GetWeekday(day));
 }
 
 void TodoManager::StartDrag(std::shared_ptr<Todo::Task> task, const std::string& sourceDate) {
@@ -547,21 +884,17 @@ void TodoManager::EndDrag() {
 }
 
 int TodoManager::GetTotalTaskCount() const {
-    int count = 0;
-    for (const auto& [date, dayTasks] : m_dayTasks) {
-        if (dayTasks) {
-            count += static_cast<int>(dayTasks->tasks.size());
-        }
+    int count = m_unloadedTaskCount;
+    for (const auto& dayTasks : m_days) {
+        count += static_cast<int>(dayTasks->tasks.size());
     }
     return count;
 }
 
 int TodoManager::GetCompletedTaskCount() const {
-    int count = 0;
-    for (const auto& [date, dayTasks] : m_dayTasks) {
-        if (dayTasks) {
-            count += dayTasks->GetCompletedCount();
-        }
+    int count = m_unloadedCompletedCount;
+    for (const auto& dayTasks : m_days) {
+        count += dayTasks->GetCompletedCount();
     }
     return count;
 }
@@ -582,52 +915,387 @@ float TodoManager::GetCompletionRate() const {
     return static_cast<float>(completed) / static_cast<float>(total);
 }
 
-bool TodoManager::SaveToFile() {
-    // TODO: Implement JSON/SQLite persistence
-    // For now, just return true
+bool TodoManager::SaveChanges() {
+    if (!HasUnsavedChanges()) return true;
+    
+    // Positions are relative within a day, so a dirty day is written whole
+    std::vector<TodoDatabase::StoredTask> tasks;
+    for (int64_t day : m_dirtyDays) {
+        const auto* dayTasks = FindDay(day);
+        if (!dayTasks) continue;
+        
+        for (size_t i = 0; i < dayTasks->tasks.size(); ++i) {
+            if (dayTasks->tasks[i]) {
+                tasks.push_back({ *dayTasks->tasks[i], static_cast<int>(i), {} });
+            }
+        }
+    }
+    for (const std::string& seriesId : m_dirtySeries) {
+        auto series = m_series.find(seriesId);
+        if (series != m_series.end()) {
+            tasks.push_back({ *series->second.task, 0, series->second.exceptions });
+        }
+    }
+    std::vector<std::string> deletedTaskIds;
+    deletedTaskIds.swap(m_deletedTaskIds);
+    m_dirtyDays.clear();
+    m_dirtySeries.clear();
+    
+    if (!m_database) return true;
+    
+    // The command owns copies of the rows; the TodoDatabase outlives the worker
+    auto write = [database = m_database, tasks = std::move(tasks), deletedTaskIds = std::move(deletedTaskIds)]() {
+        return database->DeleteTasks(deletedTaskIds) && database->SaveTasks(tasks);
+    };
+    
+    if (m_persistenceWorker) {
+        m_persistenceWorker->Enqueue(std::move(write), "save todo tasks");
+        return true;
+    }
+    
+    if (!write()) {
+        Logger::Error("Failed to save todo tasks in database");
+        return false;
+    }
     return true;
 }
 
-bool TodoManager::LoadFromFile() {
-    // TODO: Implement JSON/SQLite persistence
-    // For now, create some sample data
+bool TodoManager::LoadTasks() {
+    m_taskIndex.clear();
+    m_days.clear();
+    m_series.clear();
+    m_occurrences.clear();
+    m_visibleOccurrences.clear();
+    m_occurrencesStale = true;
+    m_monthGrids.clear();
+    m_loadedDays.clear();
+    m_openTasksLoaded = false;
+    m_unloadedTaskCount = 0;
+    m_unloadedCompletedCount = 0;
+    
+    if (!m_database) return true;
+    
+    // Every stored task counts toward the statistics from the start; each one loaded
+    // later moves from these counts to its day
+    if (m_persistenceWorker) {
+        m_persistenceWorker->Flush();
+    }
+    m_database->GetTaskCounts(m_unloadedTaskCount, m_unloadedCompletedCount);
     
-    // Create sample tasks for today
-    std::string today = GetTodayDate();
-    auto task1 = std::make_shared<Todo::Task>("Review project proposal");
-    task1->priority = Todo::Priority::High;
-    task1->dueDate = today;
-    task1->dueTime = "09:00";
-    task1->isAllDay = false;
+    int64_t day = 0;
+    if (!Utils::ParseDayNumber(m_currentDate, day)) {
+        day = Utils::GetTodayDayNumber();
+    }
     
-    auto task2 = std::make_shared<Todo::Task>("Team standup meeting");
-    task2->priority = Todo::Priority::Medium;
-    task2->dueDate = today;
-    task2->dueTime = "10:30";
-    task2->isAllDay = false;
+    size_t before = m_taskIndex.size();
+    bool success = EnsureDaysLoaded(day - LOAD_WINDOW_DAYS, day + LOAD_WINDOW_DAYS);
     
-    auto task3 = std::make_shared<Todo::Task>("Complete documentation");
-    task3->priority = Todo::Priority::Medium;
-    task3->dueDate = today;
+    // Repeating tasks are few and can show on any day, so all of them load up front
+    for (auto& row : m_database->GetRepeatingTasks()) {
+        auto task = std::make_shared<Todo::Task>(std::move(row.task));
+        m_series[task->id] = { task, std::move(row.exceptions) };
+    }
     
-    EnsureDayExists(today);
-    m_dayTasks[today]->AddTask(task1);
-    m_dayTasks[today]->AddTask(task2);
-    m_dayTasks[today]->AddTask(task3);
+    Logger::Info("Loaded {} todo tasks around {} and {} repeating tasks",
+                 m_taskIndex.size() - before, m_currentDate, m_series.size());
+    return success;
+}
+
+bool TodoManager::EnsureDaysLoaded(int64_t firstDay, int64_t lastDay) {
+    if (!m_database || firstDay > lastDay) return true;
+    
+    // Parts of the range no earlier call has loaded
+    std::vector<std::pair<int64_t, int64_t>> gaps;
+    int64_t next = firstDay;
+    auto range = m_loadedDays.upper_bound(firstDay);
+    if (range != m_loadedDays.begin() && std::prev(range)->second >= firstDay) {
+        next = std::prev(range)->second + 1;
+    }
+    for (; range != m_loadedDays.end() && range->first <= lastDay; ++range) {
+        if (range->first > next) {
+            gaps.emplace_back(next, range->first - 1);
+        }
+        next = std::max(next, range->second + 1);
+    }
+    if (next <= lastDay) {
+        gaps.emplace_back(next, lastDay);
+    }
+    if (gaps.empty() && m_openTasksLoaded) return true;
     
+    // Queued writes land first. Tasks already in memory are newer than their rows, and
+    // deleted ones not yet written must not come back.
+    if (m_persistenceWorker) {
+        m_persistenceWorker->Flush();
+    }
+    const std::unordered_set<std::string> deletedIds(m_deletedTaskIds.begin(), m_deletedTaskIds.end());
+    
+    auto merge = [this, &deletedIds](std::vector<TodoDatabase::StoredTask>&& stored) {
+        // Rows come in day and position order, one run per day
+        for (size_t first = 0, last = 0; first < stored.size(); first = last) {
+            Todo::DayTasks& dayTasks = GetOrCreateDay(stored[first].task.dueDate);
+            while (last < stored.size() && ToDayNumber(stored[last].task.dueDate) == dayTasks.day) ++last;
+            
+            // A day already holding the open tasks loaded earlier puts them in the places
+            // of their rows, in the order they have now, and keeps the tasks added to it
+            // since at its end - the day stays in stored position order
+            std::unordered_set<std::string> rowIds;
+            if (!dayTasks.tasks.empty()) {
+                for (size_t i = first; i < last; ++i) {
+                    rowIds.insert(stored[i].task.id);
+                }
+            }
+            std::vector<std::shared_ptr<Todo::Task>> loaded;
+            std::vector<std::shared_ptr<Todo::Task>> added;
+            for (auto& task : dayTasks.tasks) {
+                (rowIds.count(task->id) ? loaded : added).push_back(std::move(task));
+            }
+            
+            dayTasks.tasks.clear();
+            size_t nextLoaded = 0;
+            for (size_t i = first; i < last; ++i) {
+                Todo::Task& row = stored[i].task;
+                const auto location = m_taskIndex.find(row.id);
+                if (location != m_taskIndex.end()) {
+                    if (location->second.dayTasks == &dayTasks) {
+                        dayTasks.tasks.push_back(std::move(loaded[nextLoaded++]));
+                    }
+                    continue;
+                }
+                if (deletedIds.count(row.id)) continue;
+                
+                // The row leaves the counts taken at load time for its day
+                --m_unloadedTaskCount;
+                if (row.IsCompleted()) --m_unloadedCompletedCount;
+                dayTasks.tasks.push_back(std::make_shared<Todo::Task>(std::move(row)));
+            }
+            dayTasks.tasks.insert(dayTasks.tasks.end(), added.begin(), added.end());
+            IndexDay(dayTasks);
+            
+            if (dayTasks.day != NO_DUE_DAY) {
+                InvalidateGridDay(dayTasks.day);
+            }
+        }
+    };
+    
+    // Overdue tasks count from any date, so the open ones before the first window come along
+    if (!m_openTasksLoaded) {
+        merge(m_database->GetOpenTasksBefore(firstDay));
+        m_openTasksLoaded = true;
+    }
+    for (const auto& [first, last] : gaps) {
+        merge(m_database->GetTasksInDayRange(first, last));
+    }
+    
+    // Record the range, joined with the ones it overlaps or touches
+    int64_t mergedFirst = firstDay;
+    int64_t mergedLast = lastDay;
+    range = m_loadedDays.lower_bound(firstDay);
+    if (range != m_loadedDays.begin() && std::prev(range)->second + 1 >= firstDay) {
+        --range;
+    }
+    while (range != m_loadedDays.end() && range->first <= lastDay + 1) {
+        mergedFirst = std::min(mergedFirst, range->first);
+        mergedLast = std::max(mergedLast, range->second);
+        range = m_loadedDays.erase(range);
+    }
+    m_loadedDays.emplace(mergedFirst, mergedLast);
     return true;
 }
 
-void TodoManager::EnsureDayExists(const std::string& date) {
-    if (m_dayTasks.find(date) == m_dayTasks.end()) {
-        m_dayTasks[date] = std::make_unique<Todo::DayTasks>();
-        m_dayTasks[date]->date = date;
+int64_t TodoManager::ToDayNumber(const std::string& date) {
+    int64_t day = 0;
+    return Utils::ParseDayNumber(date, day) ? day : NO_DUE_DAY;
+}
+
+std::vector<std::unique_ptr<Todo::DayTasks>>::const_iterator TodoManager::LowerBoundDay(int64_t day) const {
+    return std::lower_bound(m_days.begin(), m_days.end(), day,
+        [](const std::unique_ptr<Todo::DayTasks>& dayTasks, int64_t value) {
+            return dayTasks->day < value;
+        });
+}
+
+Todo::DayTasks* TodoManager::FindDay(int64_t day) const {
+    auto it = LowerBoundDay(day);
+    return it != m_days.end() && (*it)->day == day ? it->get() : nullptr;
+}
+
+Todo::DayTasks& TodoManager::GetOrCreateDay(const std::string& date) {
+    const int64_t day = ToDayNumber(date);
+    auto it = LowerBoundDay(day);
+    if (it != m_days.end() && (*it)->day == day) {
+        return **it;
+    }
+    
+    auto dayTasks = std::make_unique<Todo::DayTasks>();
+    dayTasks->day = day;
+    dayTasks->date = day != NO_DUE_DAY ? Utils::FormatDayNumber(day) : std::string();
+    return **m_days.insert(m_days.begin() + (it - m_days.begin()), std::move(dayTasks));
+}
+
+const TodoManager::TaskSlot* TodoManager::LocateTask(const std::string& taskId) const {
+    auto it = m_taskIndex.find(taskId);
+    return it != m_taskIndex.end() ? &it->second : nullptr;
+}
+
+void TodoManager::IndexDay(Todo::DayTasks& dayTasks, size_t firstSlot) {
+    for (size_t slot = firstSlot; slot < dayTasks.tasks.size(); ++slot) {
+        if (dayTasks.tasks[slot]) {
+            m_taskIndex[dayTasks.tasks[slot]->id] = { &dayTasks, slot };
+        }
+    }
+}
+
+TodoManager::Series* TodoManager::FindSeries(const std::string& taskId, int64_t& occurrenceDay) {
+    occurrenceDay = NO_DUE_DAY;
+    auto series = m_series.find(taskId);
+    if (series != m_series.end()) return &series->second;
+    
+    // "<series id>@<YYYY-MM-DD>"
+    const size_t at = taskId.rfind('@');
+    int64_t day = 0;
+    if (at == std::string::npos || !Utils::ParseDayNumber(taskId.substr(at + 1), day)) return nullptr;
+    
+    series = m_series.find(taskId.substr(0, at));
+    if (series == m_series.end()) return nullptr;
+    occurrenceDay = day;
+    return &series->second;
+}
+
+void TodoManager::FillOccurrence(Todo::Task& occurrence, const Series& series, int64_t day) const {
+    occurrence = *series.task;
+    occurrence.dueDate = Utils::FormatDayNumber(day);
+    occurrence.id = series.task->id + "@" + occurrence.dueDate;
+    occurrence.seriesId = series.task->id;
+    occurrence.recurrence = Todo::Recurrence();
+    occurrence.status = Todo::Status::Pending;
+    occurrence.completedAt = {};
+    
+    auto exception = series.exceptions.find(day);
+    if (exception != series.exceptions.end()) {
+        occurrence.status = exception->second.status;
+        occurrence.completedAt = exception->second.completedAt;
+    }
+}
+
+void TodoManager::SetOccurrenceStatus(Series& series, int64_t day, Todo::Status status) {
+    const auto completedAt = status == Todo::Status::Completed ? std::chrono::system_clock::now()
+                                                               : std::chrono::system_clock::time_point();
+    Todo::OccurrenceException& exception = series.exceptions[day];
+    exception.status = status;
+    exception.completedAt = completedAt;
+    if (!exception.skipped && status == Todo::Status::Pending) {
+        series.exceptions.erase(day); // Back to what the rule says
+    }
+    
+    auto occurrence = m_occurrences.find(series.task->id + "@" + Utils::FormatDayNumber(day));
+    if (occurrence != m_occurrences.end()) {
+        occurrence->second->status = status;
+        occurrence->second->completedAt = completedAt;
+    }
+    MarkSeriesDirty(series.task->id, day);
+}
+
+std::shared_ptr<Todo::Task> TodoManager::DetachOccurrence(Series& series, int64_t day, const Todo::Task& fields, const std::string& date) {
+    // A task of its own with the occurrence's fields; the rule skips that day from now on
+    auto task = std::make_shared<Todo::Task>();
+    const std::string taskId = task->id;
+    *task = fields;
+    task->id = taskId;
+    task->seriesId.clear();
+    task->recurrence = Todo::Recurrence();
+    task->dueDate = IsValidDate(date) ? date : Utils::FormatDayNumber(day);
+    
+    Todo::OccurrenceException& exception = series.exceptions[day];
+    exception = Todo::OccurrenceException();
+    exception.skipped = true;
+    MarkSeriesDirty(series.task->id, day);
+    
+    Todo::DayTasks& dayTasks = GetOrCreateDay(task->dueDate);
+    dayTasks.AddTask(task);
+    IndexDay(dayTasks);
+    MarkDayDirty(dayTasks.day);
+    
+    Logger::Debug("Detached {} on {} from its series", task->title, Utils::FormatDayNumber(day));
+    return task;
+}
+
+void TodoManager::NoteUnsavedChange() {
+    auto now = std::chrono::steady_clock::now();
+    if (!HasUnsavedChanges()) {
+        m_firstChangeAt = now;
     }
+    m_lastChangeAt = now;
 }
 
-std::string TodoManager::GetDataFilePath() const {
-    // TODO: Get from config or use default location
-    return "todos.json";
+void TodoManager::MarkDayDirty(int64_t day) {
+    NoteUnsavedChange();
+    m_dirtyDays.insert(day);
+    if (day != NO_DUE_DAY) {
+        InvalidateGridDay(day);
+    }
+}
+
+void TodoManager::MarkSeriesDirty(const std::string& seriesId, int64_t day) {
+    NoteUnsavedChange();
+    m_dirtySeries.insert(seriesId);
+    m_occurrencesStale = true;
+    InvalidateGridDay(day);
+}
+
+void TodoManager::InvalidateGridDay(int64_t day) {
+    for (auto& cached : m_monthGrids) {
+        if (day == NO_DUE_DAY) {
+            cached->stale.set();
+            continue;
+        }
+        const int64_t cell = day - cached->grid.days[0].day;
+        if (cell >= 0 && cell < Todo::MonthGrid::CELLS) {
+            cached->stale.set(static_cast<size_t>(cell));
+        }
+    }
+}
+
+void TodoManager::SummarizeDay(Todo::DaySummary& summary, int64_t today) const {
+    summary.total = 0;
+    summary.completed = 0;
+    summary.overdue = false;
+    summary.highestPriority = -1;
+    
+    auto count = [&summary](Todo::Status status, Todo::Priority priority) {
+        summary.total++;
+        if (status == Todo::Status::Completed) {
+            summary.completed++;
+        } else {
+            summary.highestPriority = std::max(summary.highestPriority, static_cast<int>(priority));
+        }
+    };
+    
+    if (const auto* dayTasks = FindDay(summary.day)) {
+        for (const auto& task : dayTasks->tasks) {
+            if (!task) continue;
+            count(task->status, task->priority);
+            summary.overdue |= !task->IsCompleted() && summary.day < today;
+        }
+    }
+    
+    // Each rule is asked about this one day
+    for (const auto& [seriesId, series] : m_series) {
+        int64_t startDay = 0;
+        if (!Utils::ParseDayNumber(series.task->dueDate, startDay) ||
+            series.task->recurrence.GetOccurrences(startDay, summary.day, summary.day).empty()) continue;
+        
+        auto exception = series.exceptions.find(summary.day);
+        if (exception == series.exceptions.end()) {
+            count(Todo::Status::Pending, series.task->priority);
+        } else if (!exception->second.skipped) {
+            count(exception->second.status, series.task->priority);
+        }
+    }
+}
+
+void TodoManager::MarkTaskDeleted(const std::string& taskId) {
+    NoteUnsavedChange();
+    m_deletedTaskIds.push_back(taskId);
 }
 
 void TodoManager::NotifyTaskUpdated(std::shared_ptr<Todo::Task> task) {
@@ -660,16 +1328,3 @@ bool TodoManager::IsValidDate(const std::string& date) const {
     
     return !ss.fail();
 }
-
-std::tm TodoManager::ParseDate(const std::string& date) const {
-    std::istringstream ss(date);
-    std::tm tm = {};
-    ss >> std::get_time(&tm, "%Y-%m-%d");
-    return tm;
-}
-
-std::string TodoManager::FormatDate(const std::tm& date) const {
-    char buffer[32];
-    std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", &date);
-    return std::string(buffer);
-}
\ No newline at end of file
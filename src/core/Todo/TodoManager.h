@@ -1,18 +1,33 @@
 #pragma once
 
 #include <vector>
+#include <array>
+#include <bitset>
 #include <memory>
 #include <string>
 #include <functional>
 #include <chrono>
+#include <map>
+#include <set>
 #include <unordered_map>
-#include "imgui.h"
+#include <optional>
+#include <cstdint>
 
 // Forward declarations
 class AppConfig;
+class TodoDatabase;
+class PersistenceWorker;
 
 namespace Todo {
 
+struct Color {
+    float r, g, b, a = 1.0f;
+
+    Color() : r(0.7f), g(0.7f), b(0.7f), a(1.0f) {}
+    Color(float red, float green, float blue, float alpha = 1.0f)
+        : r(red), g(green), b(blue), a(alpha) {}
+};
+
 enum class Priority {
     Low = 0,
     Medium = 1,
@@ -27,6 +42,42 @@ enum class Status {
     Cancelled = 3
 };
 
+enum class Repeat {
+    None = 0,
+    Daily = 1,
+    Weekly = 2,
+    Monthly = 3
+};
+
+// How a task repeats, after an iCalendar RRULE: every `interval` days, weeks or months
+// counted from the task's due date, up to an optional last day
+struct Recurrence {
+    Repeat frequency = Repeat::None;
+    int interval = 1;
+    uint8_t weekdays = 0;            // Weekly: bit 0 = Monday .. bit 6 = Sunday; 0 = the start's weekday
+    int monthDay = 0;                // Monthly: 1-31, the last day in shorter months; 0 = the start's day
+    std::optional<int64_t> untilDay; // Inclusive, as a Utils day number
+    
+    bool IsRepeating() const { return frequency != Repeat::None; }
+    bool operator==(const Recurrence& other) const;
+    bool operator!=(const Recurrence& other) const { return !(*this == other); }
+    
+    // Days in [firstDay, lastDay] the rule falls on for a task starting on startDay. The
+    // work follows the window asked for, not how long the rule has been running.
+    std::vector<int64_t> GetOccurrences(int64_t startDay, int64_t firstDay, int64_t lastDay) const;
+    
+    // "FREQ=WEEKLY;INTERVAL=2;BYDAY=MO,TH;UNTIL=20271231"; empty when not repeating
+    std::string ToString() const;
+    static bool Parse(const std::string& rule, Recurrence& recurrence);
+};
+
+// One occurrence of a repeating task that differs from its rule. Only these are stored.
+struct OccurrenceException {
+    bool skipped = false; // Deleted, or detached into a task of its own
+    Status status = Status::Pending;
+    std::chrono::system_clock::time_point completedAt;
+};
+
 struct Task {
     std::string id;
     std::string title;
@@ -40,6 +91,8 @@ struct Task {
     bool isAllDay = true;
     std::string category;
     std::vector<std::string> tags;
+    Recurrence recurrence; // Set on a repeating task; views show its occurrences instead
+    std::string seriesId;  // Set on an occurrence: the id of the repeating task it belongs to
     
     Task() {
         createdAt = std::chrono::system_clock::now();
@@ -51,12 +104,13 @@ struct Task {
     }
     
     bool IsCompleted() const { return status == Status::Completed; }
+    bool IsOccurrence() const { return !seriesId.empty(); }
     bool IsOverdue() const;
     bool IsDueToday() const;
     bool IsDueTomorrow() const;
     std::string GetFormattedDueDate() const;
-    ImVec4 GetPriorityColor() const;
-    ImVec4 GetStatusColor() const;
+    Color GetPriorityColor() const;
+    Color GetStatusColor() const;
     
 private:
     static std::string GenerateTaskId();
@@ -64,6 +118,7 @@ private:
 
 struct DayTasks {
     std::string date; // YYYY-MM-DD
+    int64_t day = 0;  // Days since 1970-01-01 of date (Utils day numbers)
     std::vector<std::shared_ptr<Task>> tasks;
     
     void AddTask(std::shared_ptr<Task> task);
@@ -74,6 +129,26 @@ struct DayTasks {
     int GetPendingCount() const;
 };
 
+// One cell of a calendar month: the day and what its tasks add up to
+struct DaySummary {
+    int64_t day = 0;          // Utils day number
+    int dayOfMonth = 0;
+    bool inMonth = false;     // False for the leading and trailing days of the grid
+    bool isToday = false;
+    int total = 0;            // Tasks and repeating-task occurrences
+    int completed = 0;
+    bool overdue = false;     // Before today with an unfinished task (occurrences don't count)
+    int highestPriority = -1; // Of the unfinished tasks, as a Priority; -1 when none
+};
+
+// Six Monday-first weeks covering a month, as drawn by the calendar and date picker
+struct MonthGrid {
+    static constexpr int CELLS = 42;
+    int year = 0;
+    int month = 0;            // 1-12
+    std::array<DaySummary, CELLS> days;
+};
+
 struct DragDropState {
     bool isDragging = false;
     std::shared_ptr<Task> draggedTask;
@@ -92,6 +167,11 @@ public:
     // Initialization
     bool Initialize(AppConfig* config);
     void Shutdown();
+    void Update(); // Once per frame - saves changes whose debounce delay has passed
+    
+    // Storage - without a database tasks only live in memory. Set both before Initialize.
+    void SetDatabase(TodoDatabase* database) { m_database = database; }
+    void SetPersistenceWorker(PersistenceWorker* worker) { m_persistenceWorker = worker; }
     
     // Task operations
     std::shared_ptr<Todo::Task> CreateTask(const std::string& title, const std::string& dueDate = "");
@@ -105,14 +185,34 @@ public:
     bool MoveTask(const std::string& taskId, const std::string& newDate);
     bool ReorderTask(const std::string& taskId, const std::string& date, int newIndex);
     
-    // Data access
+    // Repeating tasks - the rule is stored once, outside the day lists, with only the
+    // occurrences that differ from it. Views name the days they show and get occurrences
+    // made for those days alone. An occurrence's id is "<series id>@<YYYY-MM-DD>" and the
+    // task operations above take it: completing one is recorded against the series,
+    // deleting one skips it, and moving or editing one detaches it into a task of its own.
+    std::shared_ptr<Todo::Task> CreateRepeatingTask(const std::string& title, const std::string& startDate, const Todo::Recurrence& recurrence);
+    bool SetRecurrence(const std::string& taskId, const Todo::Recurrence& recurrence); // Repeat::None ends the series
+    void SetVisibleDays(int64_t firstDay, int64_t lastDay); // Call before reading the days each frame
+    std::vector<std::shared_ptr<Todo::Task>> GetAgendaForDay(int64_t day) const; // Day's tasks, then its visible occurrences
+    size_t GetRepeatingTaskCount() const { return m_series.size(); }
+    
+    // Data access - days are kept in day-number order, so a date range is one contiguous
+    // walk; the string overloads parse their dates once and use the day-number ones
     Todo::DayTasks* GetTasksForDate(const std::string& date);
     const Todo::DayTasks* GetTasksForDate(const std::string& date) const;
+    Todo::DayTasks* GetTasksForDay(int64_t day);
+    const Todo::DayTasks* GetTasksForDay(int64_t day) const;
     std::vector<std::shared_ptr<Todo::Task>> GetTasksInDateRange(const std::string& startDate, const std::string& endDate) const;
+    std::vector<std::shared_ptr<Todo::Task>> GetTasksInDayRange(int64_t firstDay, int64_t lastDay) const; // Inclusive
     std::vector<std::shared_ptr<Todo::Task>> GetOverdueTasks() const;
     std::vector<std::shared_ptr<Todo::Task>> GetTodayTasks() const;
     std::vector<std::shared_ptr<Todo::Task>> GetUpcomingTasks(int days = 7) const;
     
+    // Calendar grids - cached per month; a mutation invalidates only the cells of the
+    // days it touches (a rule change, all of them), so drawing a month is 42 reads. The
+    // reference stays valid while the month is cached, at least until the next call.
+    const Todo::MonthGrid& GetMonthGrid(int year, int month);
+    
     // Calendar navigation
     void SetCurrentDate(const std::string& date);
     std::string GetCurrentDate() const { return m_currentDate; }
@@ -145,38 +245,102 @@ public:
     void SetOnTaskCompleted(TaskCallback callback) { m_onTaskCompleted = callback; }
     void SetOnDayChanged(DayCallback callback) { m_onDayChanged = callback; }
     
-    // Statistics
+    // Statistics - over every stored task, loaded or not; repeating tasks are left out
     int GetTotalTaskCount() const;
     int GetCompletedTaskCount() const;
     int GetPendingTaskCount() const;
     int GetOverdueTaskCount() const;
     float GetCompletionRate() const;
     
-    // Persistence
-    bool SaveToFile();
-    bool LoadFromFile();
+    // Persistence - a mutation marks its day dirty. Dirty days are written once edits
+    // have paused for "todo.saveDelayMs" (or have kept coming for "todo.maxSaveDelayMs"),
+    // through the persistence worker when there is one. Tasks are loaded a window of days
+    // around the current date at a time, plus every open task due before it.
+    bool SaveChanges(); // Writes the dirty days now
+    bool LoadTasks();
+    bool EnsureDaysLoaded(int64_t firstDay, int64_t lastDay);
+    bool HasUnsavedChanges() const { return !m_dirtyDays.empty() || !m_dirtySeries.empty() || !m_deletedTaskIds.empty(); }
     
 private:
     AppConfig* m_config = nullptr;
     std::string m_currentDate;
     ViewMode m_viewMode = ViewMode::Daily;
-    std::unordered_map<std::string, std::unique_ptr<Todo::DayTasks>> m_dayTasks; // date -> tasks
+    std::vector<std::unique_ptr<Todo::DayTasks>> m_days; // Days with tasks, ascending by day
+    static constexpr int64_t NO_DUE_DAY = INT64_MIN;       // Bucket of tasks without a valid date
     Todo::DragDropState m_dragDropState;
     
+    // Where each task sits, kept in step with every change to a day's list so a task
+    // operation never walks the days. Days are only freed all at once, with the index.
+    struct TaskSlot {
+        Todo::DayTasks* dayTasks = nullptr;
+        size_t slot = 0;
+    };
+    std::unordered_map<std::string, TaskSlot> m_taskIndex;
+    
+    // Repeating tasks by id, and the occurrences made for the visible days. Occurrence
+    // objects are reused while they stay visible, so a dragged or edited one stays valid.
+    struct Series {
+        std::shared_ptr<Todo::Task> task;
+        std::map<int64_t, Todo::OccurrenceException> exceptions; // By day, sparse
+    };
+    std::unordered_map<std::string, Series> m_series;
+    std::set<std::string> m_dirtySeries;
+    int64_t m_visibleFirst = 0;
+    int64_t m_visibleLast = -1;
+    std::vector<Todo::DayTasks> m_visibleOccurrences; // One per visible day
+    std::unordered_map<std::string, std::shared_ptr<Todo::Task>> m_occurrences; // By occurrence id
+    bool m_occurrencesStale = true;
+    
+    // Month grids, most recently used first
+    struct CachedGrid {
+        Todo::MonthGrid grid;
+        std::bitset<Todo::MonthGrid::CELLS> stale;
+    };
+    std::vector<std::unique_ptr<CachedGrid>> m_monthGrids;
+    int64_t m_gridsToday = 0;
+    static constexpr size_t MAX_CACHED_GRIDS = 4;
+    
+    // Storage
+    TodoDatabase* m_database = nullptr;
+    PersistenceWorker* m_persistenceWorker = nullptr;
+    std::set<int64_t> m_dirtyDays;
+    std::vector<std::string> m_deletedTaskIds;
+    std::chrono::steady_clock::time_point m_firstChangeAt;
+    std::chrono::steady_clock::time_point m_lastChangeAt;
+    std::chrono::milliseconds m_saveDelay{ 500 };
+    std::chrono::milliseconds m_maxSaveDelay{ 5000 };
+    std::map<int64_t, int64_t> m_loadedDays; // Loaded day ranges, first -> last, disjoint
+    bool m_openTasksLoaded = false;
+    int m_unloadedTaskCount = 0;      // Stored tasks not loaded yet, for the statistics
+    int m_unloadedCompletedCount = 0;
+    static constexpr int LOAD_WINDOW_DAYS = 42; // Either side of the current date; covers a month grid
+    
     // Event callbacks
     TaskCallback m_onTaskUpdated;
     TaskCallback m_onTaskCompleted;
     DayCallback m_onDayChanged;
     
     // Helper methods
-    void EnsureDayExists(const std::string& date);
-    std::string GetDataFilePath() const;
+    static int64_t ToDayNumber(const std::string& date); // NO_DUE_DAY if not a date
+    std::vector<std::unique_ptr<Todo::DayTasks>>::const_iterator LowerBoundDay(int64_t day) const;
+    Todo::DayTasks* FindDay(int64_t day) const;
+    Todo::DayTasks& GetOrCreateDay(const std::string& date);
+    const TaskSlot* LocateTask(const std::string& taskId) const;
+    void IndexDay(Todo::DayTasks& dayTasks, size_t firstSlot = 0); // Re-records slots from firstSlot on
+    Series* FindSeries(const std::string& taskId, int64_t& occurrenceDay); // NO_DUE_DAY for the series itself
+    void FillOccurrence(Todo::Task& occurrence, const Series& series, int64_t day) const;
+    void SetOccurrenceStatus(Series& series, int64_t day, Todo::Status status);
+    std::shared_ptr<Todo::Task> DetachOccurrence(Series& series, int64_t day, const Todo::Task& fields, const std::string& date);
+    void NoteUnsavedChange();
+    void MarkDayDirty(int64_t day);
+    void MarkSeriesDirty(const std::string& seriesId, int64_t day = NO_DUE_DAY); // day: the one occurrence changed
+    void InvalidateGridDay(int64_t day); // NO_DUE_DAY: every cell
+    void SummarizeDay(Todo::DaySummary& summary, int64_t today) const;
+    void MarkTaskDeleted(const std::string& taskId);
     void NotifyTaskUpdated(std::shared_ptr<Todo::Task> task);
     void NotifyTaskCompleted(std::shared_ptr<Todo::Task> task);
     void NotifyDayChanged(const std::string& date);
     
     // Date utilities
     bool IsValidDate(const std::string& date) const;
-    std::tm ParseDate(const std::string& date) const;
-    std::string FormatDate(const std::tm& date) const;
 };
\ No newline at end of file
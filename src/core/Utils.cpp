@@ -1,45 +1,31 @@
 // src/core/Utils.cpp - FINAL VERSION (No warnings)
 #include "Utils.h"
-#include <windows.h>
-#include <shlobj.h>
-#include <shellapi.h>
-
-// CRITICAL: Undefine Windows macros that conflict with our method names
-// #ifdef GetTempPath
-// #undef GetTempPath
-// #endif
+#include "platform/Platform.h"
 
 #include <filesystem>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
 #include <chrono>
+#include <cstdio>
 
 bool Utils::FileExists(const std::string& path)
 {
-    DWORD attributes = GetFileAttributesA(path.c_str());
-    return (attributes != INVALID_FILE_ATTRIBUTES) && 
-           !(attributes & FILE_ATTRIBUTE_DIRECTORY);
+    std::error_code ec;
+    return std::filesystem::is_regular_file(path, ec);
 }
 
 bool Utils::DirectoryExists(const std::string& path)
 {
-    DWORD attributes = GetFileAttributesA(path.c_str());
-    return (attributes != INVALID_FILE_ATTRIBUTES) && 
-           (attributes & FILE_ATTRIBUTE_DIRECTORY);
+    std::error_code ec;
+    return std::filesystem::is_directory(path, ec);
 }
 
 uint64_t Utils::GetFileSize(const std::string& path)
 {
-    WIN32_FILE_ATTRIBUTE_DATA fileInfo;
-    if (GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &fileInfo))
-    {
-        LARGE_INTEGER size;
-        size.HighPart = fileInfo.nFileSizeHigh;
-        size.LowPart = fileInfo.nFileSizeLow;
-        return static_cast<uint64_t>(size.QuadPart);
-    }
-    return 0;
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    return ec ? 0 : static_cast<uint64_t>(size);
 }
 
 std::string Utils::GetFileName(const std::string& path)
@@ -151,7 +137,7 @@ std::string Utils::JoinPath(const std::string& path1, const std::string& path2)
     char lastChar = path1.back();
     if (lastChar != '\\' && lastChar != '/')
     {
-        return path1 + "\\" + path2;
+        return path1 + Platform::GetPathSeparator() + path2;
     }
     
     return path1 + path2;
@@ -159,46 +145,25 @@ std::string Utils::JoinPath(const std::string& path1, const std::string& path2)
 
 std::string Utils::GetAppDataPath()
 {
-    char* appData = nullptr;
-    size_t len = 0;
-    if (_dupenv_s(&appData, &len, "APPDATA") == 0 && appData != nullptr)
-    {
-        std::string result(appData);
-        free(appData);
-        return JoinPath(result, "Potensio");
-    }
-    return "AppData";
+    return Platform::GetAppDataPath();
 }
 
 std::string Utils::GetTempPath()
 {
-    char* temp = nullptr;
-    size_t len = 0;
-    
-    if (_dupenv_s(&temp, &len, "TEMP") == 0 && temp != nullptr)
-    {
-        std::string result(temp);
-        free(temp);
-        return result;
-    }
-    
-    if (_dupenv_s(&temp, &len, "TMP") == 0 && temp != nullptr)
-    {
-        std::string result(temp);
-        free(temp);
-        return result;
-    }
-    
-    return "C:\\Windows\\Temp";
+    return Platform::GetTempDirectory();
 }
 
 std::string Utils::GetCurrentTimeString()
 {
     auto now = std::chrono::system_clock::now();
     auto time_t = std::chrono::system_clock::to_time_t(now);
-    
+    return FormatTime(time_t);
+}
+
+std::string Utils::FormatTime(time_t time)
+{
     struct tm timeinfo;
-    if (localtime_s(&timeinfo, &time_t) == 0)
+    if (Platform::LocalTime(time, timeinfo))
     {
         std::stringstream ss;
         ss << std::put_time(&timeinfo, "%Y-%m-%d %H:%M:%S");
@@ -207,27 +172,96 @@ std::string Utils::GetCurrentTimeString()
     return "Unknown Time";
 }
 
-std::string Utils::FormatTime(time_t time)
+int64_t Utils::ToEpochMs(const std::chrono::system_clock::time_point& timePoint)
 {
-    struct tm timeinfo;
-    if (localtime_s(&timeinfo, &time) == 0)
+    return std::chrono::duration_cast<std::chrono::milliseconds>(timePoint.time_since_epoch()).count();
+}
+
+std::chrono::system_clock::time_point Utils::FromEpochMs(int64_t epochMs)
+{
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds(epochMs)));
+}
+
+int64_t Utils::DaysFromCivil(int year, int month, int day)
+{
+    const int y = year - (month <= 2 ? 1 : 0);
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const int yearOfEra = y - era * 400;
+    const int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return static_cast<int64_t>(era) * 146097 + dayOfEra - 719468;
+}
+
+bool Utils::ParseDayNumber(const std::string& date, int64_t& dayNumber)
+{
+    auto digits = [&date](size_t pos, size_t count, int& value) {
+        value = 0;
+        for (size_t i = pos; i < pos + count; ++i)
+        {
+            if (date[i] < '0' || date[i] > '9') return false;
+            value = value * 10 + (date[i] - '0');
+        }
+        return true;
+    };
+
+    int year, month, day;
+    if (date.size() < 10 || date[4] != '-' || date[7] != '-' ||
+        !digits(0, 4, year) || !digits(5, 2, month) || !digits(8, 2, day) ||
+        month < 1 || month > 12 || day < 1 || day > 31)
     {
-        std::stringstream ss;
-        ss << std::put_time(&timeinfo, "%Y-%m-%d %H:%M:%S");
-        return ss.str();
+        return false;
     }
-    return "Unknown Time";
+
+    dayNumber = DaysFromCivil(year, month, day);
+    return true;
+}
+
+void Utils::CivilFromDays(int64_t dayNumber, int& year, int& month, int& day)
+{
+    // Inverse of DaysFromCivil
+    const int64_t z = dayNumber + 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const int64_t dayOfEra = z - era * 146097;
+    const int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const int64_t mp = (5 * dayOfYear + 2) / 153;
+    day = static_cast<int>(dayOfYear - (153 * mp + 2) / 5 + 1);
+    month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+    year = static_cast<int>(yearOfEra + era * 400 + (month <= 2 ? 1 : 0));
+}
+
+int Utils::GetWeekday(int64_t dayNumber)
+{
+    // Day 0 (1970-01-01) was a Thursday
+    return static_cast<int>(((dayNumber + 3) % 7 + 7) % 7);
+}
+
+std::string Utils::FormatDayNumber(int64_t dayNumber)
+{
+    int year, month, day;
+    CivilFromDays(dayNumber, year, month, day);
+
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d", year, month, day);
+    return buffer;
+}
+
+int64_t Utils::GetTodayDayNumber()
+{
+    std::tm tm = {};
+    Platform::LocalTime(std::time(nullptr), tm);
+    return DaysFromCivil(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday);
 }
 
 void Utils::OpenFileInExplorer(const std::string& path)
 {
-    std::string command = "explorer.exe /select,\"" + path + "\"";
-    system(command.c_str());
+    Platform::OpenFileInExplorer(path);
 }
 
 void Utils::OpenUrl(const std::string& url)
 {
-    ShellExecuteA(nullptr, "open", url.c_str(), nullptr, nullptr, SW_SHOWNORMAL);
+    Platform::OpenUrl(url);
 }
 
 bool Utils::CreateDirectoryRecursive(const std::string& path)
@@ -245,48 +279,15 @@ bool Utils::CreateDirectoryRecursive(const std::string& path)
 
 void Utils::ShowPasteCompleteNotification(const std::string& folderPath)
 {
-    // Create a hidden window for notification (needed for NOTIFYICONDATA)
-    static HWND hwnd = GetConsoleWindow(); // Or use your main window handle
-
-    NOTIFYICONDATAA nid = { sizeof(nid) };
-    nid.hWnd = hwnd;
-    nid.uID = 1001;
-    nid.uFlags = NIF_INFO;
-    std::string title = "Potensio";
-    std::string message = "Files pasted successfully!\nClick to open folder";
-    strncpy_s(nid.szInfoTitle, title.c_str(), sizeof(nid.szInfoTitle) - 1);
-    strncpy_s(nid.szInfo, message.c_str(), sizeof(nid.szInfo) - 1);
-    nid.dwInfoFlags = NIIF_INFO;
-
-    Shell_NotifyIconA(NIM_ADD, &nid);
-
-    // Optional: handle click to open folder
-    // Simplest: just launch folder after showing the notification
-    ShellExecuteA(nullptr, "open", folderPath.c_str(), nullptr, nullptr, SW_SHOWDEFAULT);
+    Platform::ShowPasteCompleteNotification(folderPath);
 }
 
 std::wstring Utils::UTF8ToWide(const std::string& utf8)
 {
-    if (utf8.empty()) return std::wstring();
-    
-    int size = MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), -1, nullptr, 0);
-    if (size == 0) return std::wstring();
-    
-    std::wstring result(size - 1, 0);
-    MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), -1, &result[0], size);
-    
-    return result;
+    return Platform::UTF8ToWide(utf8);
 }
 
 std::string Utils::WideToUTF8(const std::wstring& wide)
 {
-    if (wide.empty()) return std::string();
-    
-    int size = WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), -1, nullptr, 0, nullptr, nullptr);
-    if (size == 0) return std::string();
-    
-    std::string result(size - 1, 0);
-    WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), -1, &result[0], size, nullptr, nullptr);
-    
-    return result;
-}
\ No newline at end of file
+    return Platform::WideToUTF8(wide);
+}
@@ -4,9 +4,8 @@
 #include <string>
 #include <vector>
 #include <ctime>  // Added for time_t
-#include <windows.h>
-#include <shellapi.h>
-#include <string>
+#include <cstdint>
+#include <chrono>
 
 class Utils
 {
@@ -34,6 +33,17 @@ public:
     // Time utilities
     static std::string GetCurrentTimeString();
     static std::string FormatTime(time_t time);
+
+    // Integer time keys used by the database: epoch milliseconds for instants and day
+    // numbers (days since 1970-01-01, proleptic Gregorian) for calendar dates
+    static int64_t ToEpochMs(const std::chrono::system_clock::time_point& timePoint);
+    static std::chrono::system_clock::time_point FromEpochMs(int64_t epochMs);
+    static int64_t DaysFromCivil(int year, int month, int day);
+    static void CivilFromDays(int64_t dayNumber, int& year, int& month, int& day);
+    static int GetWeekday(int64_t dayNumber);                                 // 0 = Monday
+    static bool ParseDayNumber(const std::string& date, int64_t& dayNumber); // "YYYY-MM-DD[...]"
+    static std::string FormatDayNumber(int64_t dayNumber);                   // "YYYY-MM-DD"
+    static int64_t GetTodayDayNumber();                                       // Local calendar
     
     // System utilities
     static void OpenFileInExplorer(const std::string& path);
@@ -0,0 +1,51 @@
+// src/platform/ClipboardBackend.h
+#pragma once
+
+#include "core/Clipboard/ClipboardManager.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Clipboard
+{
+    // Raw clipboard contents as read from the OS
+    struct ClipboardSnapshot
+    {
+        ClipboardFormat format = ClipboardFormat::Unknown;
+        std::string text;                     // Text / rich text payload
+        std::vector<unsigned char> imageData; // DIB bytes for images
+        std::vector<std::string> filePaths;   // Dropped file list
+    };
+
+    // OS clipboard access used by ClipboardManager. The Win32 implementation lives in
+    // platform/windows/WindowsClipboard.cpp; other platforms get a headless in-process
+    // clipboard so the manager (and its benchmarks) run everywhere.
+    class ClipboardBackend
+    {
+    public:
+        using ChangeCallback = std::function<void()>;
+
+        virtual ~ClipboardBackend() = default;
+
+        // Lifecycle - onChange fires whenever the system clipboard content changes
+        virtual bool Initialize(ChangeCallback onChange) = 0;
+        virtual void Shutdown() = 0;
+        virtual bool StartMonitoring() = 0;
+        virtual void StopMonitoring() = 0;
+
+        // Reading - images and file lists are only extracted when requested
+        virtual bool Read(ClipboardSnapshot& snapshot, bool readImages, bool readFiles) = 0;
+        virtual std::string ReadText() = 0;
+
+        // Writing
+        virtual bool WriteText(const std::string& text) = 0;
+
+        // Environment
+        virtual std::string GetActiveWindowTitle() const = 0;
+        virtual void SendPasteShortcut() = 0;
+    };
+
+    // Implemented once per platform
+    std::unique_ptr<ClipboardBackend> CreateClipboardBackend();
+}
@@ -0,0 +1,39 @@
+// src/platform/Platform.h
+#pragma once
+
+#include <string>
+#include <ctime>
+
+// Thin OS abstraction used by the core library. Each platform provides its own
+// implementation (platform/windows/WindowsPlatform.cpp, platform/posix/PosixPlatform.cpp)
+// so that nothing under src/core has to include <windows.h>.
+class Platform
+{
+public:
+    // Time
+    static bool LocalTime(std::time_t time, std::tm& result);
+    static bool UtcTime(std::time_t time, std::tm& result);
+
+    // Environment and paths
+    static std::string GetEnv(const std::string& name);
+    static std::string GetExecutableDirectory();
+    static std::string GetAppDataPath();
+    static std::string GetTempDirectory();
+    static char GetPathSeparator();
+
+    // Shell integration
+    static void OpenFileInExplorer(const std::string& path);
+    static void OpenUrl(const std::string& url);
+    static void ShowPasteCompleteNotification(const std::string& folderPath);
+
+    // Diagnostics (debugger output window on Windows, no-op elsewhere)
+    static void WriteDebugOutput(const std::string& line);
+
+    // Encoding
+    static std::wstring UTF8ToWide(const std::string& utf8);
+    static std::string WideToUTF8(const std::wstring& wide);
+
+private:
+    Platform() = delete;
+    ~Platform() = delete;
+};
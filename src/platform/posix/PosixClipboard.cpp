@@ -0,0 +1,85 @@
+// src/platform/posix/PosixClipboard.cpp
+#include "platform/ClipboardBackend.h"
+
+#include <mutex>
+
+namespace
+{
+    // In-process clipboard used where no native integration exists yet. Writes are
+    // reported through the change callback exactly like the Win32 viewer chain does,
+    // so ClipboardManager's self-change suppression behaves the same everywhere.
+    class HeadlessClipboard : public Clipboard::ClipboardBackend
+    {
+    public:
+        bool Initialize(ChangeCallback onChange) override
+        {
+            m_onChange = std::move(onChange);
+            return true;
+        }
+
+        void Shutdown() override
+        {
+            StopMonitoring();
+        }
+
+        bool StartMonitoring() override
+        {
+            m_isMonitoring = true;
+            return true;
+        }
+
+        void StopMonitoring() override
+        {
+            m_isMonitoring = false;
+        }
+
+        bool Read(Clipboard::ClipboardSnapshot& snapshot, bool, bool) override
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            snapshot.format = m_text.empty() ? Clipboard::ClipboardFormat::Unknown
+                                             : Clipboard::ClipboardFormat::Text;
+            snapshot.text = m_text;
+            return true;
+        }
+
+        std::string ReadText() override
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_text;
+        }
+
+        bool WriteText(const std::string& text) override
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_text = text;
+            }
+
+            if (m_isMonitoring && m_onChange)
+                m_onChange();
+            return true;
+        }
+
+        std::string GetActiveWindowTitle() const override
+        {
+            return "";
+        }
+
+        void SendPasteShortcut() override
+        {
+            // No synthetic input without a display server integration
+        }
+
+    private:
+        ChangeCallback m_onChange;
+        bool m_isMonitoring = false;
+
+        mutable std::mutex m_mutex;
+        std::string m_text;
+    };
+}
+
+std::unique_ptr<Clipboard::ClipboardBackend> Clipboard::CreateClipboardBackend()
+{
+    return std::make_unique<HeadlessClipboard>();
+}
@@ -0,0 +1,155 @@
+// src/platform/posix/PosixPlatform.cpp
+#include "platform/Platform.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <system_error>
+#include <time.h>
+
+bool Platform::LocalTime(std::time_t time, std::tm& result)
+{
+    return localtime_r(&time, &result) != nullptr;
+}
+
+bool Platform::UtcTime(std::time_t time, std::tm& result)
+{
+    return gmtime_r(&time, &result) != nullptr;
+}
+
+std::string Platform::GetEnv(const std::string& name)
+{
+    const char* value = std::getenv(name.c_str());
+    return value ? std::string(value) : std::string();
+}
+
+std::string Platform::GetExecutableDirectory()
+{
+    std::error_code ec;
+    std::filesystem::path exePath = std::filesystem::read_symlink("/proc/self/exe", ec);
+    if (ec)
+    {
+        return std::filesystem::current_path(ec).string();
+    }
+    return exePath.parent_path().string();
+}
+
+std::string Platform::GetAppDataPath()
+{
+    std::string configHome = GetEnv("XDG_CONFIG_HOME");
+    if (!configHome.empty())
+    {
+        return configHome + "/potensio";
+    }
+
+    std::string home = GetEnv("HOME");
+    if (!home.empty())
+    {
+        return home + "/.config/potensio";
+    }
+    return "AppData";
+}
+
+std::string Platform::GetTempDirectory()
+{
+    std::string temp = GetEnv("TMPDIR");
+    return temp.empty() ? std::string("/tmp") : temp;
+}
+
+char Platform::GetPathSeparator()
+{
+    return '/';
+}
+
+void Platform::OpenFileInExplorer(const std::string& path)
+{
+    std::string command = "xdg-open \"" + std::filesystem::path(path).parent_path().string() + "\" >/dev/null 2>&1 &";
+    (void)std::system(command.c_str());
+}
+
+void Platform::OpenUrl(const std::string& url)
+{
+    std::string command = "xdg-open \"" + url + "\" >/dev/null 2>&1 &";
+    (void)std::system(command.c_str());
+}
+
+void Platform::ShowPasteCompleteNotification(const std::string& folderPath)
+{
+    // No tray balloon outside Windows; just reveal the folder
+    OpenUrl(folderPath);
+}
+
+void Platform::WriteDebugOutput(const std::string&)
+{
+    // Console output from Logger is all we have here
+}
+
+std::wstring Platform::UTF8ToWide(const std::string& utf8)
+{
+    // wchar_t is UTF-32 on POSIX targets
+    std::wstring result;
+    result.reserve(utf8.size());
+
+    size_t i = 0;
+    while (i < utf8.size())
+    {
+        unsigned char c = static_cast<unsigned char>(utf8[i]);
+        char32_t codePoint = 0;
+        size_t extra = 0;
+
+        if (c < 0x80)                { codePoint = c; extra = 0; }
+        else if ((c & 0xE0) == 0xC0) { codePoint = c & 0x1F; extra = 1; }
+        else if ((c & 0xF0) == 0xE0) { codePoint = c & 0x0F; extra = 2; }
+        else if ((c & 0xF8) == 0xF0) { codePoint = c & 0x07; extra = 3; }
+        else                         { ++i; continue; } // Skip invalid lead byte
+
+        if (i + extra >= utf8.size())
+        {
+            break; // Truncated sequence
+        }
+
+        for (size_t k = 1; k <= extra; ++k)
+        {
+            codePoint = (codePoint << 6) | (static_cast<unsigned char>(utf8[i + k]) & 0x3F);
+        }
+
+        result.push_back(static_cast<wchar_t>(codePoint));
+        i += extra + 1;
+    }
+
+    return result;
+}
+
+std::string Platform::WideToUTF8(const std::wstring& wide)
+{
+    std::string result;
+    result.reserve(wide.size());
+
+    for (wchar_t wc : wide)
+    {
+        char32_t cp = static_cast<char32_t>(wc);
+        if (cp < 0x80)
+        {
+            result.push_back(static_cast<char>(cp));
+        }
+        else if (cp < 0x800)
+        {
+            result.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            result.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else if (cp < 0x10000)
+        {
+            result.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            result.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            result.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else
+        {
+            result.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            result.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            result.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            result.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,385 @@
+// src/platform/windows/WindowsClipboard.cpp
+#include "WindowsClipboard.h"
+#include "platform/Platform.h"
+#include "core/Logger.h"
+#include <shellapi.h>
+#include <cstring>
+
+// Windows compatibility defines
+#ifndef CF_DIBV5
+#define CF_DIBV5 17
+#endif
+
+std::unique_ptr<Clipboard::ClipboardBackend> Clipboard::CreateClipboardBackend()
+{
+    return std::make_unique<WindowsClipboard>();
+}
+
+WindowsClipboard::~WindowsClipboard()
+{
+    Shutdown();
+}
+
+bool WindowsClipboard::Initialize(ChangeCallback onChange)
+{
+    m_onChange = std::move(onChange);
+
+    // Create hidden window for clipboard monitoring
+    WNDCLASSW wc = {};
+    wc.lpfnWndProc = WindowProc;
+    wc.hInstance = GetModuleHandle(nullptr);
+    wc.lpszClassName = L"PotensioClipboardWindow";
+
+    if (!RegisterClassW(&wc))
+    {
+        Logger::Error("Failed to register clipboard window class");
+        return false;
+    }
+
+    m_hwnd = CreateWindowExW(
+        0,
+        L"PotensioClipboardWindow",
+        L"Potensio Clipboard Monitor",
+        0,
+        0, 0, 0, 0,
+        HWND_MESSAGE, // Message-only window
+        nullptr,
+        GetModuleHandle(nullptr),
+        this
+    );
+
+    if (!m_hwnd)
+    {
+        Logger::Error("Failed to create clipboard monitor window");
+        return false;
+    }
+
+    return true;
+}
+
+void WindowsClipboard::Shutdown()
+{
+    StopMonitoring();
+
+    // Cleanup window
+    if (m_hwnd)
+    {
+        DestroyWindow(m_hwnd);
+        m_hwnd = nullptr;
+    }
+}
+
+bool WindowsClipboard::StartMonitoring()
+{
+    if (!m_hwnd || m_isMonitoring) return m_isMonitoring;
+
+    // Add to clipboard viewer chain
+    m_nextViewer = SetClipboardViewer(m_hwnd);
+    m_isMonitoring = true;
+    return true;
+}
+
+void WindowsClipboard::StopMonitoring()
+{
+    if (!m_isMonitoring) return;
+
+    // Remove from clipboard viewer chain
+    ChangeClipboardChain(m_hwnd, m_nextViewer);
+    m_nextViewer = nullptr;
+    m_isMonitoring = false;
+}
+
+LRESULT CALLBACK WindowsClipboard::WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+{
+    if (uMsg == WM_CREATE)
+    {
+        CREATESTRUCT* pCreate = reinterpret_cast<CREATESTRUCT*>(lParam);
+        WindowsClipboard* pClipboard = reinterpret_cast<WindowsClipboard*>(pCreate->lpCreateParams);
+        SetWindowLongPtr(hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(pClipboard));
+        return 0;
+    }
+
+    WindowsClipboard* pClipboard = reinterpret_cast<WindowsClipboard*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
+    if (pClipboard)
+    {
+        return pClipboard->HandleMessage(hwnd, uMsg, wParam, lParam);
+    }
+
+    return DefWindowProc(hwnd, uMsg, wParam, lParam);
+}
+
+LRESULT WindowsClipboard::HandleMessage(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+{
+    switch (uMsg)
+    {
+        case WM_DRAWCLIPBOARD:
+            if (m_onChange)
+                m_onChange();
+
+            // Pass message to next viewer
+            if (m_nextViewer)
+                SendMessage(m_nextViewer, uMsg, wParam, lParam);
+            return 0;
+
+        case WM_CHANGECBCHAIN:
+            if ((HWND)wParam == m_nextViewer)
+                m_nextViewer = (HWND)lParam;
+            else if (m_nextViewer)
+                SendMessage(m_nextViewer, uMsg, wParam, lParam);
+            return 0;
+    }
+
+    return DefWindowProc(hwnd, uMsg, wParam, lParam);
+}
+
+bool WindowsClipboard::Read(Clipboard::ClipboardSnapshot& snapshot, bool readImages, bool readFiles)
+{
+    if (!OpenClipboard(m_hwnd))
+    {
+        return false;
+    }
+
+    snapshot.format = DetectFormat();
+
+    switch (snapshot.format)
+    {
+        case Clipboard::ClipboardFormat::Text:
+        case Clipboard::ClipboardFormat::RichText:
+            snapshot.text = ExtractTextData();
+            break;
+
+        case Clipboard::ClipboardFormat::Image:
+            if (readImages)
+                snapshot.imageData = ExtractImageData();
+            break;
+
+        case Clipboard::ClipboardFormat::Files:
+            if (readFiles)
+                snapshot.filePaths = ExtractFileData();
+            break;
+
+        default:
+            break;
+    }
+
+    CloseClipboard();
+    return true;
+}
+
+std::string WindowsClipboard::ReadText()
+{
+    if (!OpenClipboard(m_hwnd))
+        return "";
+
+    std::string result = ExtractTextData();
+    CloseClipboard();
+    return result;
+}
+
+bool WindowsClipboard::WriteText(const std::string& text)
+{
+    if (!OpenClipboard(m_hwnd))
+    {
+        return false;
+    }
+
+    EmptyClipboard();
+
+    // Convert to wide string
+    int size = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, nullptr, 0);
+    HGLOBAL hGlobal = GlobalAlloc(GMEM_MOVEABLE, size * sizeof(wchar_t));
+
+    bool written = false;
+    if (hGlobal)
+    {
+        wchar_t* pGlobal = static_cast<wchar_t*>(GlobalLock(hGlobal));
+        MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, pGlobal, size);
+        GlobalUnlock(hGlobal);
+
+        written = SetClipboardData(CF_UNICODETEXT, hGlobal) != nullptr;
+    }
+
+    CloseClipboard();
+    return written;
+}
+
+std::string WindowsClipboard::GetActiveWindowTitle() const
+{
+    HWND hwnd = GetForegroundWindow();
+    if (!hwnd) return "";
+
+    wchar_t title[256];
+    if (GetWindowTextW(hwnd, title, sizeof(title) / sizeof(wchar_t)))
+    {
+        return Platform::WideToUTF8(title);
+    }
+
+    return "";
+}
+
+void WindowsClipboard::SendPasteShortcut()
+{
+    // Simulate Ctrl+V paste
+    INPUT inputs[4] = {};
+
+    // Ctrl down
+    inputs[0].type = INPUT_KEYBOARD;
+    inputs[0].ki.wVk = VK_CONTROL;
+
+    // V down
+    inputs[1].type = INPUT_KEYBOARD;
+    inputs[1].ki.wVk = 'V';
+
+    // V up
+    inputs[2].type = INPUT_KEYBOARD;
+    inputs[2].ki.wVk = 'V';
+    inputs[2].ki.dwFlags = KEYEVENTF_KEYUP;
+
+    // Ctrl up
+    inputs[3].type = INPUT_KEYBOARD;
+    inputs[3].ki.wVk = VK_CONTROL;
+    inputs[3].ki.dwFlags = KEYEVENTF_KEYUP;
+
+    SendInput(4, inputs, sizeof(INPUT));
+}
+
+Clipboard::ClipboardFormat WindowsClipboard::DetectFormat() const
+{
+    // Check for files first (highest priority)
+    if (IsClipboardFormatAvailable(CF_HDROP))
+        return Clipboard::ClipboardFormat::Files;
+
+    // Check for images
+    if (IsClipboardFormatAvailable(CF_BITMAP) ||
+        IsClipboardFormatAvailable(CF_DIB) ||
+        IsClipboardFormatAvailable(CF_DIBV5))
+        return Clipboard::ClipboardFormat::Image;
+
+    // Check for rich text formats
+    UINT rtfFormat = RegisterClipboardFormatW(L"Rich Text Format");
+    UINT htmlFormat = RegisterClipboardFormatW(L"HTML Format");
+
+    if (IsClipboardFormatAvailable(rtfFormat) || IsClipboardFormatAvailable(htmlFormat))
+        return Clipboard::ClipboardFormat::RichText;
+
+    // Check for Unicode text (preferred)
+    if (IsClipboardFormatAvailable(CF_UNICODETEXT))
+        return Clipboard::ClipboardFormat::Text;
+
+    // Check for ANSI text
+    if (IsClipboardFormatAvailable(CF_TEXT))
+        return Clipboard::ClipboardFormat::Text;
+
+    return Clipboard::ClipboardFormat::Unknown;
+}
+
+std::string WindowsClipboard::ExtractTextData() const
+{
+    // Try rich text first
+    UINT rtfFormat = RegisterClipboardFormatW(L"Rich Text Format");
+    if (IsClipboardFormatAvailable(rtfFormat))
+    {
+        HANDLE hData = GetClipboardData(rtfFormat);
+        if (hData)
+        {
+            char* pRtfText = static_cast<char*>(GlobalLock(hData));
+            if (pRtfText)
+            {
+                std::string result(pRtfText);
+                GlobalUnlock(hData);
+                return result;
+            }
+        }
+    }
+
+    // Try HTML format
+    UINT htmlFormat = RegisterClipboardFormatW(L"HTML Format");
+    if (IsClipboardFormatAvailable(htmlFormat))
+    {
+        HANDLE hData = GetClipboardData(htmlFormat);
+        if (hData)
+        {
+            char* pHtmlText = static_cast<char*>(GlobalLock(hData));
+            if (pHtmlText)
+            {
+                std::string result(pHtmlText);
+                GlobalUnlock(hData);
+                return result;
+            }
+        }
+    }
+
+    // Fall back to Unicode text
+    HANDLE hData = GetClipboardData(CF_UNICODETEXT);
+    if (!hData)
+    {
+        hData = GetClipboardData(CF_TEXT);
+        if (!hData) return "";
+    }
+
+    if (IsClipboardFormatAvailable(CF_UNICODETEXT))
+    {
+        wchar_t* pszText = static_cast<wchar_t*>(GlobalLock(hData));
+        if (pszText)
+        {
+            std::string result = Platform::WideToUTF8(pszText);
+            GlobalUnlock(hData);
+            return result;
+        }
+    }
+    else
+    {
+        char* pszText = static_cast<char*>(GlobalLock(hData));
+        if (pszText)
+        {
+            std::string result(pszText);
+            GlobalUnlock(hData);
+            return result;
+        }
+    }
+
+    return "";
+}
+
+std::vector<unsigned char> WindowsClipboard::ExtractImageData() const
+{
+    std::vector<unsigned char> result;
+
+    HANDLE hData = GetClipboardData(CF_DIB);
+    if (hData)
+    {
+        BITMAPINFO* pBitmapInfo = static_cast<BITMAPINFO*>(GlobalLock(hData));
+        if (pBitmapInfo)
+        {
+            DWORD dataSize = static_cast<DWORD>(GlobalSize(hData));
+            result.resize(dataSize);
+            memcpy(result.data(), pBitmapInfo, dataSize);
+            GlobalUnlock(hData);
+        }
+    }
+
+    return result;
+}
+
+std::vector<std::string> WindowsClipboard::ExtractFileData() const
+{
+    std::vector<std::string> result;
+
+    HANDLE hData = GetClipboardData(CF_HDROP);
+    if (hData)
+    {
+        HDROP hDrop = static_cast<HDROP>(hData);
+        UINT fileCount = DragQueryFileW(hDrop, 0xFFFFFFFF, nullptr, 0);
+
+        for (UINT i = 0; i < fileCount; ++i)
+        {
+            UINT pathLength = DragQueryFileW(hDrop, i, nullptr, 0);
+            std::wstring wPath(pathLength, 0);
+            DragQueryFileW(hDrop, i, &wPath[0], pathLength + 1);
+
+            result.push_back(Platform::WideToUTF8(wPath));
+        }
+    }
+
+    return result;
+}
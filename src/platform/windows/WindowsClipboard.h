@@ -0,0 +1,40 @@
+// src/platform/windows/WindowsClipboard.h
+#pragma once
+
+#include "platform/ClipboardBackend.h"
+#include <windows.h>
+
+class WindowsClipboard : public Clipboard::ClipboardBackend
+{
+public:
+    WindowsClipboard() = default;
+    ~WindowsClipboard() override;
+
+    bool Initialize(ChangeCallback onChange) override;
+    void Shutdown() override;
+    bool StartMonitoring() override;
+    void StopMonitoring() override;
+
+    bool Read(Clipboard::ClipboardSnapshot& snapshot, bool readImages, bool readFiles) override;
+    std::string ReadText() override;
+    bool WriteText(const std::string& text) override;
+
+    std::string GetActiveWindowTitle() const override;
+    void SendPasteShortcut() override;
+
+private:
+    HWND m_hwnd = nullptr;
+    HWND m_nextViewer = nullptr;
+    bool m_isMonitoring = false;
+    ChangeCallback m_onChange;
+
+    // Window message handling
+    static LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
+    LRESULT HandleMessage(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
+
+    // Data conversion helpers (clipboard must be open)
+    Clipboard::ClipboardFormat DetectFormat() const;
+    std::string ExtractTextData() const;
+    std::vector<unsigned char> ExtractImageData() const;
+    std::vector<std::string> ExtractFileData() const;
+};
@@ -0,0 +1,142 @@
+// src/platform/windows/WindowsPlatform.cpp
+#include "platform/Platform.h"
+
+#include <windows.h>
+#include <shlobj.h>
+#include <shellapi.h>
+
+#include <cstdlib>
+#include <cstring>
+
+bool Platform::LocalTime(std::time_t time, std::tm& result)
+{
+    return localtime_s(&result, &time) == 0;
+}
+
+bool Platform::UtcTime(std::time_t time, std::tm& result)
+{
+    return gmtime_s(&result, &time) == 0;
+}
+
+std::string Platform::GetEnv(const std::string& name)
+{
+    char* value = nullptr;
+    size_t len = 0;
+    if (_dupenv_s(&value, &len, name.c_str()) == 0 && value != nullptr)
+    {
+        std::string result(value);
+        free(value);
+        return result;
+    }
+    return "";
+}
+
+std::string Platform::GetExecutableDirectory()
+{
+    char exePath[MAX_PATH];
+    GetModuleFileNameA(NULL, exePath, MAX_PATH);
+
+    std::string path(exePath);
+
+    // Strip off the executable name, leaving only the directory
+    size_t pos = path.find_last_of("\\/");
+    if (pos != std::string::npos)
+    {
+        path = path.substr(0, pos);
+    }
+
+    return path;
+}
+
+std::string Platform::GetAppDataPath()
+{
+    std::string appData = GetEnv("APPDATA");
+    if (!appData.empty())
+    {
+        return appData + "\\Potensio";
+    }
+    return "AppData";
+}
+
+std::string Platform::GetTempDirectory()
+{
+    std::string temp = GetEnv("TEMP");
+    if (!temp.empty())
+        return temp;
+
+    temp = GetEnv("TMP");
+    if (!temp.empty())
+        return temp;
+
+    return "C:\\Windows\\Temp";
+}
+
+char Platform::GetPathSeparator()
+{
+    return '\\';
+}
+
+void Platform::OpenFileInExplorer(const std::string& path)
+{
+    std::string command = "explorer.exe /select,\"" + path + "\"";
+    system(command.c_str());
+}
+
+void Platform::OpenUrl(const std::string& url)
+{
+    ShellExecuteA(nullptr, "open", url.c_str(), nullptr, nullptr, SW_SHOWNORMAL);
+}
+
+void Platform::ShowPasteCompleteNotification(const std::string& folderPath)
+{
+    // Create a hidden window for notification (needed for NOTIFYICONDATA)
+    static HWND hwnd = GetConsoleWindow(); // Or use your main window handle
+
+    NOTIFYICONDATAA nid = { sizeof(nid) };
+    nid.hWnd = hwnd;
+    nid.uID = 1001;
+    nid.uFlags = NIF_INFO;
+    std::string title = "Potensio";
+    std::string message = "Files pasted successfully!\nClick to open folder";
+    strncpy_s(nid.szInfoTitle, title.c_str(), sizeof(nid.szInfoTitle) - 1);
+    strncpy_s(nid.szInfo, message.c_str(), sizeof(nid.szInfo) - 1);
+    nid.dwInfoFlags = NIIF_INFO;
+
+    Shell_NotifyIconA(NIM_ADD, &nid);
+
+    // Optional: handle click to open folder
+    // Simplest: just launch folder after showing the notification
+    ShellExecuteA(nullptr, "open", folderPath.c_str(), nullptr, nullptr, SW_SHOWDEFAULT);
+}
+
+void Platform::WriteDebugOutput(const std::string& line)
+{
+    // Also output to debug console in Visual Studio
+    OutputDebugStringA((line + "\n").c_str());
+}
+
+std::wstring Platform::UTF8ToWide(const std::string& utf8)
+{
+    if (utf8.empty()) return std::wstring();
+
+    int size = MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), -1, nullptr, 0);
+    if (size == 0) return std::wstring();
+
+    std::wstring result(size - 1, 0);
+    MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), -1, &result[0], size);
+
+    return result;
+}
+
+std::string Platform::WideToUTF8(const std::wstring& wide)
+{
+    if (wide.empty()) return std::string();
+
+    int size = WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), -1, nullptr, 0, nullptr, nullptr);
+    if (size == 0) return std::string();
+
+    std::string result(size - 1, 0);
+    WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), -1, &result[0], size, nullptr, nullptr);
+
+    return result;
+}
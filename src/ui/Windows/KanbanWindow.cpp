@@ -1,6 +1,7 @@
 #include "ui/Windows/KanbanWindow.h"
 #include "app/AppConfig.h"
 #include "core/Logger.h"
+#include "core/Utils.h"
 #include <imgui.h>
 #include <algorithm>
 
@@ -80,6 +81,12 @@ void KanbanWindow::RenderSettingsWindow()
                 ImGui::EndTabItem();
             }
             
+            if (ImGui::BeginTabItem("Archive"))
+            {
+                RenderArchive();
+                ImGui::EndTabItem();
+            }
+            
             // if (ImGui::BeginTabItem("Import/Export"))
             // {
             //     RenderImportExport();
@@ -950,4 +957,131 @@ void KanbanWindow::OpenExportBoardDialog()
 {
     Logger::Info("Export board dialog requested");
     // TODO: Implement export dialog
-}
\ No newline at end of file
+}
+void KanbanWindow::RenderArchive()
+{
+    if (!m_kanbanManager)
+    {
+        ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.5f, 1.0f), "Kanban Manager not available");
+        return;
+    }
+    
+    int archiveAfterDays = m_kanbanManager->GetArchiveAfterDays();
+    ImGui::SetNextItemWidth(120.0f);
+    if (ImGui::InputInt("Archive completed cards after (days)", &archiveAfterDays))
+    {
+        m_kanbanManager->SetArchiveAfterDays(archiveAfterDays);
+        m_settingsChanged = true;
+    }
+    ImGui::TextDisabled("Completed and archived cards left unchanged this long leave the board. 0 keeps them.");
+    
+    ImGui::BeginDisabled(archiveAfterDays <= 0);
+    if (ImGui::Button("Archive Now"))
+    {
+        size_t archived = m_kanbanManager->ArchiveStaleCards();
+        Logger::Info("Archived {} cards", archived);
+        m_archivePage.isValid = false;
+    }
+    ImGui::EndDisabled();
+    
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+    
+    auto currentBoard = m_kanbanManager->GetCurrentBoard();
+    if (!currentBoard)
+    {
+        ImGui::Text("No board selected");
+        return;
+    }
+    
+    // Archived cards stay on disk; only the page on screen is read
+    if (!m_archivePage.isValid || m_archivePage.boardId != currentBoard->id)
+    {
+        if (m_archivePage.boardId != currentBoard->id)
+        {
+            m_archivePage.page = 0;
+        }
+        m_archivePage.boardId = currentBoard->id;
+        m_archivePage.totalCount = m_kanbanManager->GetArchivedCardCount();
+        
+        const int pageCount = std::max(1, (m_archivePage.totalCount + ARCHIVE_PAGE_SIZE - 1) / ARCHIVE_PAGE_SIZE);
+        m_archivePage.page = std::min(m_archivePage.page, pageCount - 1);
+        m_archivePage.cards = m_kanbanManager->GetArchivedCards(
+            static_cast<size_t>(m_archivePage.page) * ARCHIVE_PAGE_SIZE, ARCHIVE_PAGE_SIZE);
+        m_archivePage.isValid = true;
+    }
+    
+    const int pageCount = std::max(1, (m_archivePage.totalCount + ARCHIVE_PAGE_SIZE - 1) / ARCHIVE_PAGE_SIZE);
+    ImGui::Text("Archived in %s: %d", currentBoard->name.c_str(), m_archivePage.totalCount);
+    ImGui::SameLine();
+    ImGui::BeginDisabled(m_archivePage.page == 0);
+    if (ImGui::ArrowButton("##ArchivePrev", ImGuiDir_Left))
+    {
+        --m_archivePage.page;
+        m_archivePage.isValid = false;
+    }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::Text("Page %d of %d", m_archivePage.page + 1, pageCount);
+    ImGui::SameLine();
+    ImGui::BeginDisabled(m_archivePage.page + 1 >= pageCount);
+    if (ImGui::ArrowButton("##ArchiveNext", ImGuiDir_Right))
+    {
+        ++m_archivePage.page;
+        m_archivePage.isValid = false;
+    }
+    ImGui::EndDisabled();
+    
+    if (ImGui::BeginTable("ArchivedCards", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_ScrollY))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Title", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Column", ImGuiTableColumnFlags_WidthFixed, 120.0f);
+        ImGui::TableSetupColumn("Archived", ImGuiTableColumnFlags_WidthFixed, 140.0f);
+        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_WidthFixed, 120.0f);
+        ImGui::TableHeadersRow();
+        
+        const Kanban::ArchivedCard* restore = nullptr;
+        const Kanban::ArchivedCard* remove = nullptr;
+        for (const auto& archived : m_archivePage.cards)
+        {
+            ImGui::PushID(archived.card.id.c_str());
+            ImGui::TableNextRow();
+            
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(archived.card.title.c_str());
+            
+            ImGui::TableNextColumn();
+            const Kanban::Column* column = currentBoard->FindColumn(archived.columnId);
+            ImGui::TextUnformatted(column ? column->name.c_str() : "?");
+            
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(Utils::FormatTime(std::chrono::system_clock::to_time_t(archived.archivedAt)).c_str());
+            
+            ImGui::TableNextColumn();
+            if (ImGui::SmallButton("Restore"))
+            {
+                restore = &archived;
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Delete"))
+            {
+                remove = &archived;
+            }
+            ImGui::PopID();
+        }
+        ImGui::EndTable();
+        
+        if (restore)
+        {
+            m_kanbanManager->RestoreArchivedCard(*restore);
+            m_archivePage.isValid = false;
+        }
+        else if (remove)
+        {
+            m_kanbanManager->DeleteArchivedCard(remove->card.id);
+            m_archivePage.isValid = false;
+        }
+    }
+}
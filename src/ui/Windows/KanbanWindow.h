@@ -42,6 +42,7 @@ private:
     void RenderAppearanceSettings();
     void RenderImportExport();
     void RenderStatistics();
+    void RenderArchive();
     
     // Project/Board management helpers
     void RenderProjectList();
@@ -135,6 +136,17 @@ private:
         bool compactMode = false;
     } m_appearanceSettings;
     
+    // One page of the current board's archive, read when the tab shows it
+    struct ArchivePage
+    {
+        std::string boardId;
+        std::vector<Kanban::ArchivedCard> cards;
+        int totalCount = 0;
+        int page = 0;
+        bool isValid = false;
+    } m_archivePage;
+    static constexpr int ARCHIVE_PAGE_SIZE = 50;
+    
     // Window sizing
     static constexpr float SETTINGS_WINDOW_WIDTH = 700.0f;
     static constexpr float SETTINGS_WINDOW_HEIGHT = 600.0f;
@@ -15,6 +15,8 @@
 #include "core/Database/DatabaseManager.h"
 #include "core/Database/PomodoroDatabase.h"
 #include "core/Database/KanbanDatabase.h"
+#include "core/Database/TodoDatabase.h"
+#include "core/Database/PersistenceWorker.h"
 
 #include "core/Utils.h"
 #include "core/Notify.h"
@@ -124,6 +126,7 @@ bool MainWindow::Initialize(AppConfig* config)
     
     // Initialize Kanban manager and window
     m_kanbanManager = std::make_unique<KanbanManager>(*m_kanbanDatabase);
+    m_kanbanManager->SetPersistenceWorker(m_persistenceWorker.get());
     m_kanbanSettingsWindow = std::make_unique<KanbanWindow>();    
 
     // Initialize Kanban components
@@ -165,6 +168,8 @@ bool MainWindow::Initialize(AppConfig* config)
 
     // Initialize Todo manager
     m_todoManager = std::make_unique<TodoManager>();
+    m_todoManager->SetDatabase(m_todoDatabase.get());
+    m_todoManager->SetPersistenceWorker(m_persistenceWorker.get());
     
     // Initialize Todo components
     if (!m_todoManager->Initialize(config))
@@ -262,6 +267,9 @@ bool MainWindow::Initialize(AppConfig* config)
 
 void MainWindow::Shutdown()
 {
+    // End any active session (needs the timer, so before it is destroyed)
+    OnPomodoroSessionEnd(false); // Not completed
+
     if (m_pomodoroSettingsWindow)
         m_pomodoroSettingsWindow->Shutdown();
     
@@ -292,19 +300,19 @@ void MainWindow::Shutdown()
     m_clipboardManager.reset();
     m_fileConverter.reset();
 
-    // End any active session
-    if (m_currentSessionId != -1 && m_pomodoroDatabase)
+    // Commit every queued write before the connection goes away
+    if (m_persistenceWorker)
     {
-        auto sessionInfo = m_pomodoroTimer->GetCurrentSession();
-        int pausedSeconds = static_cast<int>(sessionInfo.pausedTime.count());
-        
-        m_pomodoroDatabase->EndSession(m_currentSessionId, false, pausedSeconds); // Not completed
-        m_currentSessionId = -1;
+        m_persistenceWorker->Stop();
     }
 
     // Shutdown database -> Make sure it's destroyed after KanbanManager, since KanbanManager reference it
     if (m_databaseManager)
     {
+        if (m_databaseManager->IsProfilingEnabled())
+        {
+            m_databaseManager->DumpQueryProfile("logs/sql_profile.json");
+        }
         m_databaseManager->Shutdown();
     }
 }
@@ -328,6 +336,15 @@ void MainWindow::Update(float deltaTime)
     {
         m_pomodoroTimer->Update();
     }
+
+    // Write todo edits once they settle
+    if (m_todoManager)
+    {
+        m_todoManager->Update();
+    }
+
+    // Convert rows left over from schema upgrades in the background
+    PumpSchemaBackfill();
     
     // Update settings windows if visible
     if (m_pomodoroSettingsWindow && m_showPomodoroSettings)
@@ -507,6 +524,21 @@ void MainWindow::RenderKanbanModule()
     {
         RenderCardEditDialog();
     }
+    else if (ImGui::GetIO().KeyCtrl && !ImGui::GetIO().WantTextInput)
+    {
+        // Ctrl+Z undoes the last card change, Ctrl+Y or Ctrl+Shift+Z redoes it
+        if (ImGui::IsKeyPressed(ImGuiKey_Z, false))
+        {
+            if (ImGui::GetIO().KeyShift)
+                m_kanbanManager->Redo();
+            else
+                m_kanbanManager->Undo();
+        }
+        else if (ImGui::IsKeyPressed(ImGuiKey_Y, false))
+        {
+            m_kanbanManager->Redo();
+        }
+    }
     
     ImGui::PopStyleVar();
 }
@@ -517,7 +549,7 @@ void MainWindow::RenderKanbanHeader()
     auto currentBoard = m_kanbanManager->GetCurrentBoard();
     
     float availableWidth = ImGui::GetContentRegionAvail().x;
-    float buttonAreaWidth = 280.0f; // Reserve space for buttons
+    float buttonAreaWidth = 375.0f; // Reserve space for buttons
     float infoAreaWidth = availableWidth - buttonAreaWidth - 20.0f; // 20px for spacing
     
     // Start horizontal layout
@@ -563,7 +595,15 @@ void MainWindow::RenderKanbanHeader()
         ImGui::SameLine(); ImGui::Text("  |  "); ImGui::SameLine();
         ImGui::Text("Cards:");
         ImGui::SameLine();
-        ImGui::TextColored(ImVec4(0.8f, 0.9f, 1.0f, 1.0f), "%d", currentBoard->GetTotalCardCount());
+        if (currentBoard->HasFilter())
+        {
+            ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.4f, 1.0f), "%zu of %d", currentBoard->GetVisibleCardCount(),
+                               currentBoard->GetTotalCardCount());
+        }
+        else
+        {
+            ImGui::TextColored(ImVec4(0.8f, 0.9f, 1.0f, 1.0f), "%d", currentBoard->GetTotalCardCount());
+        }
         
         // Completed count
         ImGui::SameLine(); ImGui::Text("  |  "); ImGui::SameLine();
@@ -765,6 +805,28 @@ void MainWindow::RenderKanbanHeader()
     
     ImGui::SameLine(0, buttonSpacing);
     
+    // Filter button - highlighted while a filter hides cards
+    if (!currentBoard) ImGui::BeginDisabled();
+    
+    const bool filtered = currentBoard && currentBoard->HasFilter();
+    ImGui::PushStyleColor(ImGuiCol_Button, filtered ? ImVec4(0.8f, 0.6f, 0.2f, 0.8f) : ImVec4(0.4f, 0.4f, 0.5f, 0.8f));
+    ImGui::PushStyleColor(ImGuiCol_ButtonHovered, filtered ? ImVec4(0.9f, 0.7f, 0.3f, 1.0f) : ImVec4(0.5f, 0.5f, 0.6f, 1.0f));
+    ImGui::PushStyleColor(ImGuiCol_ButtonActive, filtered ? ImVec4(0.7f, 0.5f, 0.1f, 1.0f) : ImVec4(0.3f, 0.3f, 0.4f, 1.0f));
+    
+    if (ImGui::Button("Filter", ImVec2(buttonWidth, 28.0f)))
+    {
+        ImGui::OpenPopup("Card Filter");
+    }
+    if (currentBoard)
+    {
+        RenderKanbanFilterPopup(currentBoard);
+    }
+    ImGui::PopStyleColor(3);
+    
+    if (!currentBoard) ImGui::EndDisabled();
+    
+    ImGui::SameLine(0, buttonSpacing);
+    
     // Settings button
     ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.6f, 0.6f, 0.6f, 0.8f));
     ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0.7f, 0.7f, 0.7f, 1.0f));
@@ -781,6 +843,74 @@ void MainWindow::RenderKanbanHeader()
     ImGui::EndGroup();
 }
 
+void MainWindow::RenderKanbanFilterPopup(Kanban::Board* board)
+{
+    if (!ImGui::BeginPopup("Card Filter"))
+    {
+        return;
+    }
+
+    static const char* priorityNames[] = { "Low", "Medium", "High", "Urgent" };
+    static const char* statusNames[] = { "Active", "Completed", "Archived" };
+    auto& state = m_cardFilterState;
+
+    ImGui::Text("Priority");
+    for (int i = 0; i < 4; ++i)
+    {
+        if (i > 0) ImGui::SameLine();
+        ImGui::Checkbox(priorityNames[i], &state.priorities[i]);
+    }
+    ImGui::Text("Status");
+    for (int i = 0; i < 3; ++i)
+    {
+        if (i > 0) ImGui::SameLine();
+        ImGui::Checkbox(statusNames[i], &state.statuses[i]);
+    }
+    ImGui::Checkbox("Overdue only", &state.overdueOnly);
+
+    ImGui::SetNextItemWidth(220.0f);
+    ImGui::InputText("Assignee", state.assigneeBuffer, IM_ARRAYSIZE(state.assigneeBuffer));
+    ImGui::SetNextItemWidth(220.0f);
+    ImGui::InputText("Tags", state.tagsBuffer, IM_ARRAYSIZE(state.tagsBuffer));
+    ImGui::SetNextItemWidth(105.0f);
+    ImGui::InputTextWithHint("##DueFrom", "YYYY-MM-DD", state.dueFromBuffer, IM_ARRAYSIZE(state.dueFromBuffer));
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(105.0f);
+    ImGui::InputTextWithHint("Due##DueTo", "YYYY-MM-DD", state.dueToBuffer, IM_ARRAYSIZE(state.dueToBuffer));
+
+    if (ImGui::Button("Clear", ImVec2(80, 0)))
+    {
+        state = CardFilterState();
+    }
+
+    // Rebuilt every frame the popup is open; the board ignores a filter that did not change
+    Kanban::CardFilter filter;
+    for (int i = 0; i < 4; ++i)
+    {
+        filter.priorities |= state.priorities[i] ? (1u << i) : 0;
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        filter.statuses |= state.statuses[i] ? (1u << i) : 0;
+    }
+    filter.overdueOnly = state.overdueOnly;
+    filter.assignee = Utils::Trim(state.assigneeBuffer);
+    for (const std::string& tag : Utils::Split(state.tagsBuffer, ','))
+    {
+        const std::string trimmed = Utils::Trim(tag);
+        if (!trimmed.empty())
+        {
+            filter.tags.push_back(trimmed);
+        }
+    }
+    int64_t day = 0;
+    if (Utils::ParseDayNumber(state.dueFromBuffer, day)) filter.dueFrom = day;
+    if (Utils::ParseDayNumber(state.dueToBuffer, day)) filter.dueTo = day;
+    board->SetFilter(filter);
+
+    ImGui::EndPopup();
+}
+
 void MainWindow::RenderKanbanBoard()
 {
     auto currentBoard = m_kanbanManager->GetCurrentBoard();
@@ -899,8 +1029,14 @@ void MainWindow::RenderKanbanColumn(Kanban::Column* column, int columnIndex, flo
     float countYPos = columnWidth < 120.0f ? ImGui::GetCursorPosY() + 2 : padding + 18;
     ImGui::SetCursorPos(ImVec2(padding, countYPos));
     
+    auto board = m_kanbanManager->GetCurrentBoard();
+    
     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.6f, 0.6f, 0.6f, 1.0f));
-    if (column->cardLimit > 0)
+    if (board && board->HasFilter())
+    {
+        ImGui::Text("(%zu of %zu)", board->GetVisibleCards(*column).size(), column->cards.size());
+    }
+    else if (column->cardLimit > 0)
     {
         if (static_cast<int>(column->cards.size()) >= column->cardLimit)
         {
@@ -948,13 +1084,22 @@ void MainWindow::RenderKanbanColumn(Kanban::Column* column, int columnIndex, flo
     ImGui::BeginChild(("##CardsArea" + column->id).c_str(), cardsAreaSize, false, 
                      ImGuiWindowFlags_AlwaysVerticalScrollbar);
     
-    // Render cards with proper spacing
-    for (size_t cardIndex = 0; cardIndex < column->cards.size(); ++cardIndex)
+    // Render cards with proper spacing - with a board filter only its matches, which keep
+    // their column positions for drag and drop
+    const std::vector<size_t>* visible = board && board->HasFilter() ? &board->GetVisibleCards(*column) : nullptr;
+    const size_t shownCount = visible ? visible->size() : column->cards.size();
+    for (size_t i = 0; i < shownCount; ++i)
     {
+        const size_t cardIndex = visible ? (*visible)[i] : i;
+        if (cardIndex >= column->cards.size())
+        {
+            break; // A card was dropped or deleted this frame
+        }
+        
         auto card = column->cards[cardIndex];
         if (card)
         {
-            if (cardIndex > 0)
+            if (i > 0)
             {
                 ImGui::Spacing();
             }
@@ -1525,14 +1670,15 @@ void MainWindow::StopEditingCard(bool save)
         auto card = m_kanbanManager->FindCard(m_cardEditState.cardId);
         if (card)
         {
-            // Update card with edited data
-            card->title = m_cardEditState.titleBuffer;
-            card->description = m_cardEditState.descriptionBuffer;
-            card->dueDate = m_cardEditState.dueDateBuffer;
-            card->assignee = m_cardEditState.assigneeBuffer;
-            card->priority = static_cast<Kanban::Priority>(m_cardEditState.priority);
+            // Edit a copy so the manager can journal what changed
+            Kanban::Card edited = *card;
+            edited.title = m_cardEditState.titleBuffer;
+            edited.description = m_cardEditState.descriptionBuffer;
+            edited.dueDate = m_cardEditState.dueDateBuffer;
+            edited.assignee = m_cardEditState.assigneeBuffer;
+            edited.priority = static_cast<Kanban::Priority>(m_cardEditState.priority);
             
-            m_kanbanManager->UpdateCard(card);
+            m_kanbanManager->EditCard(edited);
         }
     }
     
@@ -1982,14 +2128,7 @@ void MainWindow::OnPomodoroSessionComplete(int sessionType)
     }
     
     // End current session in database
-    if (m_currentSessionId != -1 && m_pomodoroDatabase)
-    {
-        auto sessionInfo = m_pomodoroTimer->GetCurrentSession();
-        int pausedSeconds = static_cast<int>(sessionInfo.pausedTime.count());
-        
-        m_pomodoroDatabase->EndSession(m_currentSessionId, true, pausedSeconds);
-        m_currentSessionId = -1;
-    }
+    OnPomodoroSessionEnd(true);
     
     Logger::Info("Pomodoro: {}", message);
 }
@@ -1999,14 +2138,7 @@ void MainWindow::OnPomodoroAllComplete()
     Logger::Info("Pomodoro: All sessions completed! Excellent work!");
     
     // End current session if any
-    if (m_currentSessionId != -1 && m_pomodoroDatabase)
-    {
-        auto sessionInfo = m_pomodoroTimer->GetCurrentSession();
-        int pausedSeconds = static_cast<int>(sessionInfo.pausedTime.count());
-        
-        m_pomodoroDatabase->EndSession(m_currentSessionId, true, pausedSeconds);
-        m_currentSessionId = -1;
-    }
+    OnPomodoroSessionEnd(true);
 }
 
 void MainWindow::OnPomodoroTick()
@@ -3324,7 +3456,12 @@ void MainWindow::RenderTodoSidebar()
 void MainWindow::RenderTodoDailyView()
 {
     std::string currentDate = m_todoManager->GetCurrentDate();
-    auto dayTasks = m_todoManager->GetTasksForDate(currentDate);
+    int64_t currentDay = 0;
+    Utils::ParseDayNumber(currentDate, currentDay);
+    
+    // Repeating tasks are expanded for the shown day only
+    m_todoManager->SetVisibleDays(currentDay, currentDay);
+    auto tasks = m_todoManager->GetAgendaForDay(currentDay);
     
     // Date header with quick add
     ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[0]); // Could use larger font
@@ -3352,9 +3489,9 @@ void MainWindow::RenderTodoDailyView()
     // ImGui::Spacing();
     
     // Tasks list
-    if (dayTasks && !dayTasks->tasks.empty())
+    if (!tasks.empty())
     {
-        RenderTodoTaskList(currentDate, dayTasks->tasks);
+        RenderTodoTaskList(currentDate, tasks);
     }
     else
     {
@@ -3369,16 +3506,139 @@ void MainWindow::RenderTodoDailyView()
 
 void MainWindow::RenderTodoWeeklyView()
 {
-    // Implementation for weekly view
-    ImGui::Text("Weekly View - Coming Soon");
-    ImGui::Text("This will show a week layout with tasks for each day");
+    int64_t firstDay = 0;
+    if (!Utils::ParseDayNumber(m_todoManager->GetWeekStart(m_todoManager->GetCurrentDate()), firstDay))
+        return;
+    
+    // One column per day, Monday first; repeating tasks are expanded for these seven days
+    m_todoManager->SetVisibleDays(firstDay, firstDay + 6);
+    const int64_t today = Utils::GetTodayDayNumber();
+    const char* dayNames[] = { "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun" };
+    
+    ImGui::Columns(7, "WeekColumns", true);
+    for (int i = 0; i < 7; i++)
+    {
+        const int64_t day = firstDay + i;
+        const std::string date = Utils::FormatDayNumber(day);
+        ImGui::PushID(i);
+        
+        // Day header - click to open the day
+        if (day == today)
+            ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.4f, 0.8f, 0.4f, 1.0f));
+        if (ImGui::Selectable((std::string(dayNames[i]) + " " + date.substr(8)).c_str()))
+        {
+            m_todoManager->SetCurrentDate(date);
+            m_todoManager->SetViewMode(TodoManager::ViewMode::Daily);
+        }
+        if (day == today)
+            ImGui::PopStyleColor();
+        ImGui::Separator();
+        
+        for (const auto& task : m_todoManager->GetAgendaForDay(day))
+        {
+            ImGui::PushID(task->id.c_str());
+            
+            bool completed = task->IsCompleted();
+            if (ImGui::Checkbox("##completed", &completed))
+            {
+                m_todoManager->ToggleTaskStatus(task->id);
+            }
+            ImGui::SameLine();
+            ImGui::TextWrapped("%s%s", task->IsOccurrence() ? "🔁 " : "", task->title.c_str());
+            
+            // Double-click to edit
+            if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+            {
+                StartEditingTask(task);
+            }
+            
+            ImGui::PopID();
+        }
+        
+        ImGui::PopID();
+        ImGui::NextColumn();
+    }
+    ImGui::Columns(1);
 }
 
 void MainWindow::RenderTodoCalendarView()
 {
-    // Implementation for calendar view
-    ImGui::Text("Calendar View - Coming Soon");
-    ImGui::Text("This will show a monthly calendar with task indicators");
+    int64_t currentDay = 0;
+    if (!Utils::ParseDayNumber(m_todoManager->GetCurrentDate(), currentDay))
+        return;
+    
+    int year, month, day;
+    Utils::CivilFromDays(currentDay, year, month, day);
+    
+    // Six Monday-first weeks covering the month, summed per day by the manager's cache
+    const Todo::MonthGrid& grid = m_todoManager->GetMonthGrid(year, month);
+    
+    const char* monthNames[] = {
+        "January", "February", "March", "April", "May", "June",
+        "July", "August", "September", "October", "November", "December"
+    };
+    ImGui::Text("📆 %s %d", monthNames[month - 1], year);
+    ImGui::Spacing();
+    
+    // Day headers
+    const char* dayNames[] = { "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun" };
+    ImGui::Columns(7, "MonthHeaders", false);
+    for (int i = 0; i < 7; i++)
+    {
+        ImGui::Text("%s", dayNames[i]);
+        ImGui::NextColumn();
+    }
+    ImGui::Columns(1);
+    ImGui::Separator();
+    
+    // Day cells - number, then pending/total tasks; click to open the day
+    ImGui::Columns(7, "MonthGrid", false);
+    for (int cell = 0; cell < Todo::MonthGrid::CELLS; cell++)
+    {
+        const Todo::DaySummary& summary = grid.days[cell];
+        
+        std::string label = std::to_string(summary.dayOfMonth);
+        if (summary.total > 0)
+        {
+            label += "\n" + std::to_string(summary.total - summary.completed) + "/" + std::to_string(summary.total);
+        }
+        
+        int pushedColors = 0;
+        if (summary.isToday)
+        {
+            ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.2f, 0.6f, 0.2f, 0.8f));
+            pushedColors++;
+        }
+        else if (summary.overdue)
+        {
+            ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.5f, 0.2f, 0.2f, 0.8f));
+            pushedColors++;
+        }
+        if (!summary.inMonth)
+        {
+            ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.5f, 0.5f, 1.0f));
+            pushedColors++;
+        }
+        
+        if (ImGui::Button((label + "##cell" + std::to_string(cell)).c_str(), ImVec2(-1, 48.0f)))
+        {
+            m_todoManager->SetCurrentDate(Utils::FormatDayNumber(summary.day));
+            m_todoManager->SetViewMode(TodoManager::ViewMode::Daily);
+        }
+        
+        // Most urgent open task, as a bar along the bottom of the cell
+        if (summary.highestPriority >= 0)
+        {
+            ImVec2 cellMin = ImGui::GetItemRectMin();
+            ImVec2 cellMax = ImGui::GetItemRectMax();
+            ImGui::GetWindowDrawList()->AddRectFilled(ImVec2(cellMin.x + 4, cellMax.y - 4), ImVec2(cellMax.x - 4, cellMax.y - 2),
+                                                      ImGui::GetColorU32(GetPriorityColor(summary.highestPriority)));
+        }
+        
+        ImGui::PopStyleColor(pushedColors);
+        ImGui::NextColumn();
+    }
+    ImGui::Columns(1);
 }
 
 void MainWindow::RenderTodoTaskList(const std::string& date, const std::vector<std::shared_ptr<Todo::Task>>& tasks)
@@ -3434,17 +3694,17 @@ void MainWindow::RenderTodoTask(std::shared_ptr<Todo::Task> task, int taskIndex,
     else
     {
         taskBgColor = IM_COL32(
-            static_cast<int>(priorityColor.x * 80 + 30),
-            static_cast<int>(priorityColor.y * 80 + 30),
-            static_cast<int>(priorityColor.z * 80 + 30),
+            static_cast<int>(priorityColor.r * 80 + 30),
+            static_cast<int>(priorityColor.g * 80 + 30),
+            static_cast<int>(priorityColor.b * 80 + 30),
             255
         );
     }
     
     ImU32 taskBorderColor = IM_COL32(
-        static_cast<int>(priorityColor.x * 150 + 60),
-        static_cast<int>(priorityColor.y * 150 + 60),
-        static_cast<int>(priorityColor.z * 150 + 60),
+        static_cast<int>(priorityColor.r * 150 + 60),
+        static_cast<int>(priorityColor.g * 150 + 60),
+        static_cast<int>(priorityColor.b * 150 + 60),
         255
     );
     
@@ -3531,7 +3791,7 @@ void MainWindow::RenderTodoTask(std::shared_ptr<Todo::Task> task, int taskIndex,
                               taskMin.y + taskContentHeight - windowPos.y - lineHeight - taskPadding));
     
     // Priority indicator
-    ImGui::PushStyleColor(ImGuiCol_Text, priorityColor);
+    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(priorityColor.r, priorityColor.g, priorityColor.b, priorityColor.a));
     ImGui::Text("● %s", GetPriorityName(static_cast<int>(task->priority)));
     ImGui::PopStyleColor();
     
@@ -3544,11 +3804,18 @@ void MainWindow::RenderTodoTask(std::shared_ptr<Todo::Task> task, int taskIndex,
         ImGui::PopStyleColor();
     }
     
+    // Repeating task marker
+    if (task->IsOccurrence())
+    {
+        ImGui::SameLine();
+        ImGui::TextColored(ImVec4(0.6f, 0.7f, 0.9f, 1.0f), " 🔁");
+    }
+    
     // Status indicator
     if (task->status != Todo::Status::Pending)
     {
         ImGui::SameLine();
-        ImGui::PushStyleColor(ImGuiCol_Text, statusColor);
+        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(statusColor.r, statusColor.g, statusColor.b, statusColor.a));
         ImGui::Text(" [%s]", GetStatusName(static_cast<int>(task->status)));
         ImGui::PopStyleColor();
     }
@@ -3809,6 +4076,62 @@ void MainWindow::RenderTaskEditDialog()
         ImGui::Text("Category:");
         ImGui::InputText("##category", m_taskEditState.categoryBuffer, sizeof(m_taskEditState.categoryBuffer));
         
+        // Repeat - an occurrence is edited on its own; the rule belongs to its series
+        if (!m_taskEditState.seriesId.empty())
+        {
+            ImGui::TextColored(ImVec4(0.6f, 0.7f, 0.9f, 1.0f), "🔁 One occurrence of a repeating task");
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Edit series"))
+            {
+                auto series = m_todoManager->FindTask(m_taskEditState.seriesId);
+                StopEditingTask(false);
+                StartEditingTask(series);
+            }
+        }
+        else
+        {
+            ImGui::Text("Repeat:");
+            const char* repeatNames[] = { "Never", "Daily", "Weekly", "Monthly" };
+            ImGui::Combo("##repeat", &m_taskEditState.repeat, repeatNames, IM_ARRAYSIZE(repeatNames));
+            
+            if (m_taskEditState.repeat != static_cast<int>(Todo::Repeat::None))
+            {
+                const char* unitNames[] = { "", "day(s)", "week(s)", "month(s)" };
+                ImGui::Text("Every");
+                ImGui::SameLine();
+                ImGui::SetNextItemWidth(100);
+                ImGui::InputInt("##repeatinterval", &m_taskEditState.repeatInterval);
+                if (m_taskEditState.repeatInterval < 1) m_taskEditState.repeatInterval = 1;
+                ImGui::SameLine();
+                ImGui::Text("%s", unitNames[m_taskEditState.repeat]);
+                
+                if (m_taskEditState.repeat == static_cast<int>(Todo::Repeat::Weekly))
+                {
+                    const char* weekdayNames[] = { "Mo", "Tu", "We", "Th", "Fr", "Sa", "Su" };
+                    for (int i = 0; i < 7; i++)
+                    {
+                        if (i > 0) ImGui::SameLine();
+                        ImGui::Checkbox(weekdayNames[i], &m_taskEditState.repeatWeekdays[i]);
+                    }
+                }
+                else if (m_taskEditState.repeat == static_cast<int>(Todo::Repeat::Monthly))
+                {
+                    ImGui::Text("On day");
+                    ImGui::SameLine();
+                    ImGui::SetNextItemWidth(100);
+                    ImGui::InputInt("##repeatmonthday", &m_taskEditState.repeatMonthDay);
+                    m_taskEditState.repeatMonthDay = std::clamp(m_taskEditState.repeatMonthDay, 0, 31);
+                    ImGui::SameLine();
+                    ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "(0 = the due date's day)");
+                }
+                
+                ImGui::Text("Until:");
+                ImGui::InputText("##repeatuntil", m_taskEditState.repeatUntilBuffer, sizeof(m_taskEditState.repeatUntilBuffer));
+                ImGui::SameLine();
+                ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "(YYYY-MM-DD, empty = forever)");
+            }
+        }
+        
         ImGui::Spacing();
         ImGui::Separator();
         ImGui::Spacing();
@@ -3863,6 +4186,22 @@ void MainWindow::StartEditingTask(std::shared_ptr<Todo::Task> task)
     m_taskEditState.priority = static_cast<int>(task->priority);
     m_taskEditState.status = static_cast<int>(task->status);
     m_taskEditState.isAllDay = task->isAllDay;
+    
+    // Repeat rule
+    const Todo::Recurrence& recurrence = task->recurrence;
+    m_taskEditState.seriesId = task->seriesId;
+    m_taskEditState.repeat = static_cast<int>(recurrence.frequency);
+    m_taskEditState.repeatInterval = recurrence.interval;
+    for (int i = 0; i < 7; i++)
+    {
+        m_taskEditState.repeatWeekdays[i] = (recurrence.weekdays >> i) & 1;
+    }
+    m_taskEditState.repeatMonthDay = recurrence.monthDay;
+    if (recurrence.untilDay)
+    {
+        strncpy_s(m_taskEditState.repeatUntilBuffer, Utils::FormatDayNumber(*recurrence.untilDay).c_str(),
+                  sizeof(m_taskEditState.repeatUntilBuffer) - 1);
+    }
 }
 
 void MainWindow::StopEditingTask(bool save)
@@ -3893,6 +4232,30 @@ void MainWindow::StopEditingTask(bool save)
             {
                 m_todoManager->UpdateTask(task);
             }
+            
+            // Repeat rule - applied after the move, so a new series starts on the new date
+            if (!task->IsOccurrence())
+            {
+                Todo::Recurrence recurrence;
+                recurrence.frequency = static_cast<Todo::Repeat>(m_taskEditState.repeat);
+                recurrence.interval = m_taskEditState.repeatInterval;
+                for (int i = 0; i < 7; i++)
+                {
+                    if (recurrence.frequency == Todo::Repeat::Weekly && m_taskEditState.repeatWeekdays[i])
+                        recurrence.weekdays |= static_cast<uint8_t>(1u << i);
+                }
+                if (recurrence.frequency == Todo::Repeat::Monthly)
+                    recurrence.monthDay = m_taskEditState.repeatMonthDay;
+                
+                int64_t untilDay = 0;
+                if (Utils::ParseDayNumber(m_taskEditState.repeatUntilBuffer, untilDay))
+                    recurrence.untilDay = untilDay;
+                
+                if (recurrence != task->recurrence)
+                {
+                    m_todoManager->SetRecurrence(task->id, recurrence);
+                }
+            }
         }
     }
     
@@ -3970,45 +4333,6 @@ std::string MainWindow::FormatDateComponents(int year, int month, int day) const
     return std::string(buffer);
 }
 
-int MainWindow::GetDaysInMonth(int year, int month) const
-{
-    const int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-    
-    if (month == 1) // February
-    {
-        // Check for leap year
-        if ((year % 4 == 0 && year % 100 != 0) || (year % 400 == 0))
-            return 29;
-        else
-            return 28;
-    }
-    
-    return daysInMonth[month];
-}
-
-int MainWindow::GetFirstDayOfWeek(int year, int month) const
-{
-    // Simple algorithm to get day of week for first day of month
-    // This is a simplified version - you might want to use a more robust date library
-    int totalDays = 0;
-    
-    // Days from year 1900 (known Sunday = 0)
-    for (int y = 1900; y < year; y++)
-    {
-        totalDays += 365;
-        if ((y % 4 == 0 && y % 100 != 0) || (y % 400 == 0))
-            totalDays += 1; // Leap year
-    }
-    
-    // Days from months in current year
-    for (int m = 0; m < month; m++)
-    {
-        totalDays += GetDaysInMonth(year, m);
-    }
-    
-    return totalDays % 7;
-}
-
 void MainWindow::RenderDatePicker()
 {
     if (!m_datePickerState.isOpen)
@@ -4087,8 +4411,8 @@ void MainWindow::RenderDatePicker()
         ImGui::Separator();
         ImGui::Spacing();
         
-        // Calendar grid
-        const char* dayNames[] = {"Su", "Mo", "Tu", "We", "Th", "Fr", "Sa"};
+        // Calendar grid - Monday first, like the month view
+        const char* dayNames[] = {"Mo", "Tu", "We", "Th", "Fr", "Sa", "Su"};
         
         // Day headers
         ImGui::Columns(7, "DayHeaders", false);
@@ -4101,29 +4425,28 @@ void MainWindow::RenderDatePicker()
         
         ImGui::Separator();
         
-        // Calendar days
-        int daysInMonth = GetDaysInMonth(m_datePickerState.displayYear, m_datePickerState.displayMonth);
-        int firstDayOfWeek = GetFirstDayOfWeek(m_datePickerState.displayYear, m_datePickerState.displayMonth);
+        // Calendar days, from the manager's cached month grid
+        const Todo::MonthGrid& grid = m_todoManager->GetMonthGrid(m_datePickerState.displayYear,
+                                                                  m_datePickerState.displayMonth + 1);
         
         ImGui::Columns(7, "Calendar", false);
         
-        // Empty cells before first day
-        for (int i = 0; i < firstDayOfWeek; i++)
-        {
-            ImGui::NextColumn();
-        }
-        
-        // Days of the month
-        for (int day = 1; day <= daysInMonth; day++)
+        for (const Todo::DaySummary& summary : grid.days)
         {
+            // Empty cells before the first and after the last day
+            if (!summary.inMonth)
+            {
+                ImGui::NextColumn();
+                continue;
+            }
+            
+            const int day = summary.dayOfMonth;
             bool isSelected = (day == m_datePickerState.selectedDay &&
                              m_datePickerState.displayMonth == m_datePickerState.selectedMonth &&
                              m_datePickerState.displayYear == m_datePickerState.selectedYear);
             
             // Highlight today
-            std::string todayDate = m_todoManager->GetTodayDate();
-            std::string thisDate = FormatDateComponents(m_datePickerState.displayYear, m_datePickerState.displayMonth, day);
-            bool isToday = (thisDate == todayDate);
+            bool isToday = summary.isToday;
             
             if (isToday)
             {
@@ -4154,6 +4477,15 @@ void MainWindow::RenderDatePicker()
                 m_datePickerState.isOpen = false;
             }
             
+            // Dot for days with open tasks, colored by the most urgent
+            if (summary.highestPriority >= 0)
+            {
+                ImVec2 cellMin = ImGui::GetItemRectMin();
+                ImVec2 cellMax = ImGui::GetItemRectMax();
+                ImGui::GetWindowDrawList()->AddCircleFilled(ImVec2(cellMax.x - 5, cellMin.y + 5), 2.5f,
+                                                            ImGui::GetColorU32(GetPriorityColor(summary.highestPriority)));
+            }
+            
             if (isToday || isSelected)
             {
                 ImGui::PopStyleColor(2);
@@ -6547,6 +6879,26 @@ void MainWindow::OnPomodoroSessionStart()
     Logger::Debug("Started tracking Pomodoro session {} (ID: {})", sessionTypeStr, m_currentSessionId);
 }
 
+void MainWindow::OnPomodoroSessionEnd(bool completed)
+{
+    if (m_currentSessionId == -1 || !m_pomodoroDatabase || !m_pomodoroTimer) return;
+
+    auto sessionInfo = m_pomodoroTimer->GetCurrentSession();
+    int pausedSeconds = static_cast<int>(sessionInfo.pausedTime.count());
+
+    // EndSession also rebuilds the day's statistics, so keep it off the UI thread
+    auto write = [database = m_pomodoroDatabase, sessionId = m_currentSessionId, completed, pausedSeconds]() {
+        return database->EndSession(sessionId, completed, pausedSeconds);
+    };
+
+    if (m_persistenceWorker)
+        m_persistenceWorker->Enqueue(write, "end pomodoro session");
+    else
+        write();
+
+    m_currentSessionId = -1;
+}
+
 bool MainWindow::InitializeDatabase()
 {
     // Create database manager
@@ -6554,6 +6906,16 @@ bool MainWindow::InitializeDatabase()
     
     // Determine database path (in user's app data directory)
     std::string databasePath = GetDatabasePath();
+
+    // SQLite tuning profile
+    std::string profile = m_config ? m_config->GetValue("database.profile", std::string("balanced")) : "balanced";
+    DatabaseTuning tuning;
+    if (!DatabaseTuning::FromProfile(profile, tuning))
+    {
+        Logger::Warning("Unknown database profile '{}', using balanced", profile);
+        tuning = DatabaseTuning::Balanced();
+    }
+    m_databaseManager->SetTuning(tuning);
     
     if (!m_databaseManager->Initialize(databasePath))
     {
@@ -6579,12 +6941,54 @@ bool MainWindow::InitializeDatabase()
         return false;
     }
 
-    // Initialize Todos database
-    
+    // Initialize Todo database
+    m_todoDatabase = std::make_shared<TodoDatabase>(m_databaseManager);
+
+    if (!m_todoDatabase->Initialize())
+    {
+        Logger::Error("Failed to initialize Todo database");
+        return false;
+    }
+
+    // Statistics and search queries read through their own connections
+    if (!m_databaseManager->OpenReadConnections(2))
+    {
+        Logger::Warning("Read connections not opened - reads share the writer connection");
+    }
+
+    if (m_config && m_config->GetValue("database.profiling", false))
+    {
+        m_databaseManager->EnableProfiling(true, static_cast<double>(m_config->GetValue("database.slowQueryMs", 50)));
+    }
+
+    // Start the write-behind worker once every schema exists
+    m_persistenceWorker = std::make_unique<PersistenceWorker>(m_databaseManager);
+    if (!m_persistenceWorker->Start())
+    {
+        Logger::Warning("Persistence worker not started - database writes stay synchronous");
+    }
+
     Logger::Info("Database initialized successfully");
     return true;
 }
 
+void MainWindow::PumpSchemaBackfill()
+{
+    if (!m_databaseManager || !m_persistenceWorker || m_databaseManager->GetSchemaBackfill().IsComplete())
+        return;
+
+    // One batch at a time, only while no user writes are waiting, so the conversion
+    // never delays them by more than a single batch
+    if (m_persistenceWorker->GetStats().pending > 0)
+        return;
+
+    const size_t batchRows = static_cast<size_t>(m_config ? m_config->GetValue("database.backfillBatchRows", 2000) : 2000);
+    std::shared_ptr<DatabaseManager> databaseManager = m_databaseManager;
+    m_persistenceWorker->Enqueue([databaseManager, batchRows]() {
+        return databaseManager->GetSchemaBackfill().Step(batchRows);
+    }, "schema backfill");
+}
+
 std::string MainWindow::GetDatabasePath()
 {
     char exePath[MAX_PATH];
@@ -8,6 +8,8 @@
 #include <functional>
 #include <fstream>
 #include <cstdlib>
+#include <windows.h>
+#include <shellapi.h>
 
 #include "imgui.h"
 
@@ -36,6 +38,7 @@ class DatabaseManager;
 class PomodoroDatabase;
 class KanbanDatabase;
 class TodoDatabase;
+class PersistenceWorker;
 
 enum class ModulePage
 {
@@ -187,6 +190,18 @@ private:
         char dueDateBuffer[32] = "";
         char assigneeBuffer[128] = "";
     } m_cardEditState;
+
+    // Card filter popup (Kanban header) - applied to the current board as it is edited
+    struct CardFilterState
+    {
+        bool priorities[4] = {};
+        bool statuses[3] = {};
+        bool overdueOnly = false;
+        char assigneeBuffer[128] = "";
+        char tagsBuffer[256] = "";    // Comma separated, all required
+        char dueFromBuffer[32] = "";  // YYYY-MM-DD
+        char dueToBuffer[32] = "";
+    } m_cardFilterState;
     
     // Task editing state (for Todo)
     struct TaskEditState
@@ -201,6 +216,12 @@ private:
         char dueTimeBuffer[16] = "";
         bool isAllDay = true;
         char categoryBuffer[128] = "";
+        int repeat = 0;               // Todo::Repeat
+        int repeatInterval = 1;
+        bool repeatWeekdays[7] = {};  // Monday first
+        int repeatMonthDay = 0;       // 0 = the due date's day
+        char repeatUntilBuffer[32] = "";
+        std::string seriesId;         // Set when editing one occurrence of a repeating task
     } m_taskEditState;
 
     // Clipboard UI state
@@ -357,6 +378,7 @@ private:
     void RenderKanbanHeader();
     void RenderKanbanBoard();
     void RenderKanbanColumn(class Kanban::Column* column, int columnIndex, float columnWidth, float columnHeight);
+    void RenderKanbanFilterPopup(class Kanban::Board* board);
     void RenderQuickAddCard(const std::string& columnId, float maxWidth = 0.0f);
     void RenderKanbanCard(std::shared_ptr<class Kanban::Card> card, int cardIndex, const std::string& columnId);
     void RenderCardEditDialog();
@@ -409,8 +431,6 @@ private:
     // Date picker helper methods
     void GetCurrentDateComponents(int& year, int& month, int& day) const;
     std::string FormatDateComponents(int year, int month, int day) const;
-    int GetDaysInMonth(int year, int month) const;
-    int GetFirstDayOfWeek(int year, int month) const;
     void RenderDatePicker();
 
     // Clipboard - Main Interface
@@ -475,6 +495,8 @@ private:
     std::shared_ptr<DatabaseManager> m_databaseManager;
     std::shared_ptr<PomodoroDatabase> m_pomodoroDatabase;
     std::shared_ptr<KanbanDatabase> m_kanbanDatabase;
+    std::shared_ptr<TodoDatabase> m_todoDatabase;
+    std::unique_ptr<PersistenceWorker> m_persistenceWorker; // Write-behind for UI-thread mutations
 
     // Change listener
     bool m_kanbanChanged = false;
@@ -499,10 +521,12 @@ private:
     
     // Helper methods
     bool InitializeDatabase();
+    void PumpSchemaBackfill();
     std::string GetDatabasePath();
     void LoadPomodoroConfiguration();
     void SavePomodoroConfiguration(const PomodoroTimer::PomodoroConfig& config);
     void OnPomodoroSessionStart();
+    void OnPomodoroSessionEnd(bool completed);
 
 private:
     // Icon textures